@@ -5,14 +5,19 @@
 #endif
 #include "core/engine.hh"
 #include "core/fission.hh"
+#include "core/profiler.hh"
 #include "core/settings.hh"
+#include "ecs/components.hh"
+#include "math/math_utils.hh"
 
 #include "renderer/base_renderer.hh"
 
 #include <algorithm>
+#include <cstdlib>
+#include <cstring>
 #include <vector>
 
-int main() {
+int main( int argc, char **argv ) {
 
   std::shared_ptr<fn::Settings> settings = std::make_shared<fn::Settings>();
   settings->setWidth( 1440 );
@@ -21,6 +26,23 @@ int main() {
 
   fn::Engine *engine = fn::Engine::getInstance();
   engine->setRenderer( std::make_shared<fn::VulkanBase>( settings ) );
+
+  // The chalet model, standing up and scaled to the scene
+  fn::ecs::LocalTransform chalet;
+  chalet.rotation = fn::Quat::fromAxisAngle( fn::Vec3( 0.0f, 0.0f, 1.0f ), fn::Math::radians( 90.0f ) );
+  chalet.scale = fn::Vec3( 0.4f );
+  engine->getWorld().create( chalet, fn::ecs::WorldTransform{}, fn::ecs::Renderable{} );
+
+  // --pipelined simulates the next frame while the render thread draws,
+  // --profile <frames> traces startup and the first frames to fission_trace.json
+  for ( int i = 1; i < argc; i++ ) {
+    if ( std::strcmp( argv[ i ], "--pipelined" ) == 0 ) {
+      engine->setThreadingMode( fn::ThreadingMode::Pipelined );
+    } else if ( std::strcmp( argv[ i ], "--profile" ) == 0 && i + 1 < argc ) {
+      const auto frames = static_cast<uint32_t>( std::strtoul( argv[ ++i ], nullptr, 10 ) );
+      fn::Profiler::captureFrames( frames, "fission_trace.json" );
+    }
+  }
   engine->run();
   engine->destroy();
 
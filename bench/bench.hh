@@ -0,0 +1,142 @@
+/* =======================================================================
+   $File: bench.hh
+   $Date: 16/10/2026
+   $Revision:
+   $Creator: Rostislav Orestis Stelmach
+   $Notice:  This file is a part of Thesis project ( stracer ) for
+   the Technical Educational Institute of Western Macedonia
+   Supervisor: Dr. George Sisias
+   ======================================================================== */
+
+#ifndef PROJECT_BENCH_HPP
+#define PROJECT_BENCH_HPP
+
+//C++ Includes
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace fn {
+
+  namespace bench {
+
+    //
+    // Minimal microbenchmark harness.
+    //
+    // Every benchmark has a pinned iteration count, so two runs do the same
+    // amount of work and can be compared directly. A benchmark is warmed up
+    // with a tenth of its iterations, then timed `samples` times; the median is reported
+    // as ns per operation and, when the benchmark declares how many bytes one
+    // operation touches, as GB/s.
+    //
+    // Command line:
+    //   --filter <text>   only run benchmarks whose name contains <text>
+    //   --json <file>     write the results to <file>
+    //   --samples <n>     timed samples per benchmark ( default 5 )
+    //   --scale <x>       multiply every iteration count, for quick runs
+    //
+
+    // Keeps the compiler from removing a computation whose result is unused
+    template <typename T>
+    inline void doNotOptimize(const T& value) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+      asm volatile("" : : "g"(&value) : "memory");
+#else
+      static volatile const void* sink;
+      sink = &value;
+#endif
+    }
+
+    struct Result {
+      std::string name;
+      size_t iterations;
+      size_t opsPerIteration;
+      double nsPerOp;
+      double gbPerSecond;
+    };
+
+    class Runner {
+    public:
+      Runner(int argc, char** argv) {
+        for ( int i = 1; i + 1 < argc; i += 2 ) {
+          const char* key = argv[i];
+          const char* value = argv[i + 1];
+          if ( std::strcmp(key, "--filter") == 0 ) m_filter = value;
+          else if ( std::strcmp(key, "--json") == 0 ) m_json = value;
+          else if ( std::strcmp(key, "--samples") == 0 ) m_samples = std::max(1, std::atoi(value));
+          else if ( std::strcmp(key, "--scale") == 0 ) m_scale = std::max(1e-3, std::atof(value));
+          else std::fprintf(stderr, "unknown option %s\n", key);
+        }
+        std::printf("%-48s %12s %12s %10s\n", "benchmark", "iterations", "ns/op", "GB/s");
+      }
+
+      //
+      // Times `iterations` calls of body(), each doing `opsPerIteration`
+      // operations of `bytesPerOp` bytes ( 0 when bandwidth is meaningless ).
+      //
+      template <typename Body>
+      void run(const std::string& name, size_t iterations, size_t opsPerIteration,
+               size_t bytesPerOp, Body body) {
+        if ( !m_filter.empty() && name.find(m_filter) == std::string::npos ) return;
+
+        const size_t count = std::max<size_t>(1, static_cast<size_t>(static_cast<double>(iterations) * m_scale));
+        for ( size_t i = 0; i < std::max<size_t>(1, count / 10); i++ ) body();
+
+        std::vector<double> samples(static_cast<size_t>(m_samples));
+        for ( double& sample : samples ) {
+          const auto start = std::chrono::steady_clock::now();
+          for ( size_t i = 0; i < count; i++ ) body();
+          const auto stop = std::chrono::steady_clock::now();
+          sample = std::chrono::duration<double, std::nano>(stop - start).count();
+        }
+        std::nth_element(samples.begin(), samples.begin() + static_cast<long>(samples.size() / 2), samples.end());
+        const double median = samples[samples.size() / 2];
+
+        const double ops = static_cast<double>(count) * static_cast<double>(opsPerIteration);
+        const double nsPerOp = median / ops;
+        // bytes per ns is GB per second
+        const double gbPerSecond = bytesPerOp ? static_cast<double>(bytesPerOp) / nsPerOp : 0.0;
+
+        std::printf("%-48s %12zu %12.3f %10.2f\n", name.c_str(), count, nsPerOp, gbPerSecond);
+        m_results.push_back({ name, count, opsPerIteration, nsPerOp, gbPerSecond });
+      }
+
+      // Writes the JSON report when --json was given. Returns false on I/O errors.
+      bool finish() const {
+        if ( m_json.empty() ) return true;
+
+        std::FILE* file = std::fopen(m_json.c_str(), "w");
+        if ( !file ) {
+          std::fprintf(stderr, "cannot open %s\n", m_json.c_str());
+          return false;
+        }
+        std::fprintf(file, "{\n  \"samples\": %d,\n  \"benchmarks\": [\n", m_samples);
+        for ( size_t i = 0; i < m_results.size(); i++ ) {
+          const Result& r = m_results[i];
+          std::fprintf(file,
+                       "    { \"name\": \"%s\", \"iterations\": %zu, \"ops_per_iteration\": %zu, "
+                       "\"ns_per_op\": %.4f, \"gb_per_s\": %.4f }%s\n",
+                       r.name.c_str(), r.iterations, r.opsPerIteration, r.nsPerOp, r.gbPerSecond,
+                       i + 1 < m_results.size() ? "," : "");
+        }
+        std::fprintf(file, "  ]\n}\n");
+        return std::fclose(file) == 0;
+      }
+
+      const std::vector<Result>& results() const noexcept { return m_results; }
+
+    private:
+      std::string m_filter;
+      std::string m_json;
+      int m_samples = 5;
+      double m_scale = 1.0;
+      std::vector<Result> m_results;
+    };
+  }
+}
+
+#endif //PROJECT_BENCH_HPP
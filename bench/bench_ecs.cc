@@ -0,0 +1,131 @@
+/* =======================================================================
+   $File: bench_ecs.cc
+   $Date: 16/10/2026
+   $Revision:
+   $Creator: Rostislav Orestis Stelmach
+   $Notice:  This file is a part of Thesis project ( stracer ) for
+   the Technical Educational Institute of Western Macedonia
+   Supervisor: Dr. George Sisias
+   ======================================================================== */
+
+//
+// Transform update of a scene, heap objects against ECS chunks.
+//
+//   bench_ecs.x [--filter <text>] [--json <file>] [--samples <n>] [--scale <x>]
+//
+// The object baseline is one heap allocation per entity updated through a
+// virtual call, the way Object derived scene nodes would be. The ECS runs
+// the same math over SoA chunks, on one thread and on every hardware thread,
+// then adds the bounds update and the gather of the renderer.
+//
+
+//Engine Internal
+#include "bench.hh"
+#include "core/job_system.hh"
+#include "ecs/components.hh"
+#include "ecs/systems.hh"
+#include "ecs/world.hh"
+#include "math/math_utils.hh"
+
+//C++ Includes
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+  class SceneNode {
+  public:
+    virtual ~SceneNode() = default;
+    virtual void update() = 0;
+
+    fn::ecs::LocalTransform local;
+    fn::ecs::WorldTransform world;
+    fn::ecs::LocalBounds bounds;
+  };
+
+  class MeshNode : public SceneNode {
+  public:
+    void update() override {
+      world.matrix = fn::Affine3::fromTRS(local.position, local.rotation, local.scale);
+    }
+  };
+
+  fn::ecs::LocalTransform randomTransform(std::mt19937& rng) {
+    std::uniform_real_distribution<float> position(-100.0f, 100.0f);
+    std::uniform_real_distribution<float> angle(0.0f, 2.0f * fn::Math::PI);
+    fn::ecs::LocalTransform local;
+    local.position = fn::Vec3(position(rng), position(rng), position(rng));
+    local.rotation = fn::Quat::fromAxisAngle(fn::Vec3(0.0f, 1.0f, 0.0f), angle(rng));
+    local.scale = fn::Vec3(1.5f);
+    return local;
+  }
+
+  std::string name(const char* workload, size_t entities) {
+    return std::string(workload) + " / " + std::to_string(entities / 1000) + "k";
+  }
+
+  void sceneBenchmarks(fn::bench::Runner& runner, size_t entities) {
+    const fn::AABB box(fn::Vec3(-0.5f), fn::Vec3(0.5f));
+
+    std::mt19937 rng(1);
+    std::vector<std::unique_ptr<SceneNode>> nodes;
+    for ( size_t i = 0; i < entities; i++ ) {
+      nodes.push_back(std::make_unique<MeshNode>());
+      nodes.back()->local = randomTransform(rng);
+      nodes.back()->bounds.box = box;
+    }
+    // Scene graphs are built in any order, so are their allocations
+    std::shuffle(nodes.begin(), nodes.end(), rng);
+    runner.run(name("heap objects", entities), 20, entities, sizeof(MeshNode), [&] {
+      for ( auto& node : nodes ) node->update();
+      fn::bench::doNotOptimize(nodes);
+    });
+    nodes.clear();
+
+    rng.seed(1);
+    fn::ecs::World world;
+    for ( size_t i = 0; i < entities; i++ ) {
+      world.create(randomTransform(rng), fn::ecs::WorldTransform{}, fn::ecs::LocalBounds{box},
+                   fn::ecs::WorldBounds{}, fn::ecs::Renderable{});
+    }
+
+    const uint32_t hardware = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<uint32_t> counts = { 1 };
+    if ( hardware > 1 ) counts.push_back(hardware);
+
+    const size_t bytes = sizeof(fn::ecs::LocalTransform) + sizeof(fn::ecs::WorldTransform);
+    for ( uint32_t threads : counts ) {
+      fn::JobSystem jobs(threads);
+      const std::string suffix = " / " + std::to_string(threads) + " threads";
+      runner.run(name(("ECS transforms" + suffix).c_str(), entities), 20, entities, bytes, [&] {
+        fn::ecs::updateTransforms(world, jobs);
+      });
+
+      // What the engine does every frame
+      fn::ecs::SystemScheduler systems;
+      fn::ecs::addTransformSystems(systems);
+      std::vector<glm::mat4> transforms;
+      runner.run(name(("ECS frame" + suffix).c_str(), entities), 20, entities, 0, [&] {
+        systems.run(world, jobs);
+        fn::ecs::gatherRenderables(world, nullptr, transforms);
+        fn::bench::doNotOptimize(transforms);
+      });
+    }
+  }
+
+}
+
+int main(int argc, char** argv) {
+
+  fn::bench::Runner runner(argc, argv);
+
+  for ( size_t entities : { size_t(100000), size_t(400000) } ) {
+    sceneBenchmarks(runner, entities);
+  }
+
+  return runner.finish() ? 0 : 1;
+}
@@ -0,0 +1,128 @@
+/* =======================================================================
+   $File: bench_jobs.cc
+   $Date: 16/10/2026
+   $Revision:
+   $Creator: Rostislav Orestis Stelmach
+   $Notice:  This file is a part of Thesis project ( stracer ) for
+   the Technical Educational Institute of Western Macedonia
+   Supervisor: Dr. George Sisias
+   ======================================================================== */
+
+//
+// JobSystem scaling, the same workloads on 1 to N threads.
+//
+//   bench_jobs.x [--filter <text>] [--json <file>] [--samples <n>] [--scale <x>]
+//
+// Each workload runs once per thread count, 1, 2, 4, ... and the hardware
+// thread count, then the speedup over one thread is printed. A transform
+// batch that is memory bound flattens out long before a compute bound one.
+//
+
+//Engine Internal
+#include "bench.hh"
+#include "core/job_system.hh"
+#include "math/batch.hh"
+#include "math/math_utils.hh"
+
+//C++ Includes
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+  // Large enough that every worker gets many grains
+  constexpr size_t N = 1 << 16;
+
+  std::vector<fn::Matrix4> matrices(std::mt19937& rng) {
+    std::uniform_real_distribution<float> dist(-2.0f, 2.0f);
+    std::vector<fn::Matrix4> m(N);
+    for ( fn::Matrix4& a : m ) {
+      float e[16];
+      for ( float& x : e ) x = dist(rng);
+      a = fn::Matrix4(e[0], e[1], e[2], e[3], e[4], e[5], e[6], e[7],
+                      e[8], e[9], e[10], e[11], e[12], e[13], e[14], e[15]);
+    }
+    return m;
+  }
+
+  std::vector<uint32_t> threadCounts() {
+    const uint32_t hardware = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<uint32_t> counts;
+    for ( uint32_t t = 1; t < hardware; t *= 2 ) counts.push_back(t);
+    counts.push_back(hardware);
+    return counts;
+  }
+
+  std::string name(const char* workload, uint32_t threads) {
+    return std::string(workload) + " / " + std::to_string(threads) + " threads";
+  }
+
+  void scalingBenchmarks(fn::bench::Runner& runner, fn::JobSystem& jobs, std::mt19937& rng) {
+    const uint32_t threads = jobs.threadCount();
+
+    const std::vector<fn::Matrix4> a = matrices(rng);
+    const std::vector<fn::Matrix4> b = matrices(rng);
+    std::vector<fn::Matrix4> out(N);
+    runner.run(name("Math::multiply batch", threads), 50, N, 3 * sizeof(fn::Matrix4), [&] {
+      jobs.parallelFor(N, 1024, [&](size_t begin, size_t end) {
+        fn::Math::multiply(&a[begin], &b[begin], &out[begin], end - begin);
+      });
+      fn::bench::doNotOptimize(out);
+    });
+
+    // A few hundred cycles per element, no memory traffic to speak of
+    std::uniform_real_distribution<float> dist(-10.0f, 10.0f);
+    std::vector<float> x(N), y(N);
+    for ( float& v : x ) v = dist(rng);
+    runner.run(name("fastSinCos series", threads), 20, N, 0, [&] {
+      jobs.parallelFor(N, 256, [&](size_t i) {
+        float s = 0.0f, c = 0.0f, acc = 0.0f;
+        for ( int k = 0; k < 32; k++ ) {
+          fn::Math::fastSinCos(x[i] + static_cast<float>(k) * 0.1f, s, c);
+          acc += s * c;
+        }
+        y[i] = acc;
+      });
+      fn::bench::doNotOptimize(y);
+    });
+
+    // Many tiny jobs, mostly scheduling overhead
+    runner.run(name("empty jobs", threads), 200, 1024, 0, [&] {
+      fn::JobCounter counter;
+      for ( int i = 0; i < 1024; i++ ) jobs.schedule(counter, [] {});
+      jobs.wait(counter);
+    });
+  }
+
+}
+
+int main(int argc, char** argv) {
+
+  fn::bench::Runner runner(argc, argv);
+
+  const std::vector<uint32_t> counts = threadCounts();
+  for ( uint32_t threads : counts ) {
+    // Same inputs for every thread count
+    std::mt19937 rng(1);
+    fn::JobSystem jobs(threads);
+    scalingBenchmarks(runner, jobs, rng);
+  }
+
+  // Speedup of every result over the one thread run of the same workload
+  std::printf("\n%-48s %12s\n", "benchmark", "speedup");
+  const std::vector<fn::bench::Result>& results = runner.results();
+  for ( const fn::bench::Result& r : results ) {
+    const std::string workload = r.name.substr(0, r.name.find(" / "));
+    for ( const fn::bench::Result& base : results ) {
+      if ( base.name == name(workload.c_str(), 1) ) {
+        std::printf("%-48s %11.2fx\n", r.name.c_str(), base.nsPerOp / r.nsPerOp);
+      }
+    }
+  }
+
+  return runner.finish() ? 0 : 1;
+}
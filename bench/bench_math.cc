@@ -0,0 +1,293 @@
+/* =======================================================================
+   $File: bench_math.cc
+   $Date: 16/10/2026
+   $Revision:
+   $Creator: Rostislav Orestis Stelmach
+   $Notice:  This file is a part of Thesis project ( stracer ) for
+   the Technical Educational Institute of Western Macedonia
+   Supervisor: Dr. George Sisias
+   ======================================================================== */
+
+//
+// Math kernel microbenchmarks, fn:: against glm:: and libm.
+//
+//   bench_math.x [--filter <text>] [--json <file>] [--samples <n>] [--scale <x>]
+//
+// Inputs come from fixed seeds and every benchmark has a pinned iteration
+// count, so results from two builds or two machines can be diffed directly.
+// The vector expression group is most telling at -O1 / -Og, where the
+// operator temporaries of def_vector.hh are not optimized away.
+//
+
+//Engine Internal
+#include "bench.hh"
+#include "math/batch.hh"
+#include "math/math_utils.hh"
+#include "math/matrix_transformations.hh"
+#include "math/vector_expr.hh"
+
+//OpenGL Includes
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+//C++ Includes
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace {
+
+  // Working set of one benchmark, small enough to stay in L2
+  constexpr size_t N = 1024;
+
+  std::vector<float> uniform(std::mt19937& rng, float lo, float hi, size_t n = N) {
+    std::uniform_real_distribution<float> dist(lo, hi);
+    std::vector<float> v(n);
+    for ( float& x : v ) x = dist(rng);
+    return v;
+  }
+
+  std::vector<fn::Matrix4> matrices(std::mt19937& rng) {
+    std::vector<fn::Matrix4> m(N);
+    for ( fn::Matrix4& a : m ) {
+      const std::vector<float> e = uniform(rng, -2.0f, 2.0f, 16);
+      a = fn::Matrix4(e[0], e[1], e[2], e[3], e[4], e[5], e[6], e[7],
+                      e[8], e[9], e[10], e[11], e[12], e[13], e[14], e[15]);
+      a[0][0] += 4.0f;
+      a[1][1] += 4.0f;
+      a[2][2] += 4.0f;
+      a[3][3] += 4.0f;
+    }
+    return m;
+  }
+
+  std::vector<glm::mat4> toGlm(std::vector<fn::Matrix4> m) {
+    std::vector<glm::mat4> out;
+    out.reserve(m.size());
+    for ( fn::Matrix4& a : m ) out.push_back(static_cast<glm::mat4>(a));
+    return out;
+  }
+
+  void matrixBenchmarks(fn::bench::Runner& runner, std::mt19937& rng) {
+    const std::vector<fn::Matrix4> a = matrices(rng);
+    const std::vector<fn::Matrix4> b = matrices(rng);
+    const std::vector<glm::mat4> ga = toGlm(a);
+    const std::vector<glm::mat4> gb = toGlm(b);
+    std::vector<fn::Matrix4> out(N);
+    std::vector<glm::mat4> gout(N);
+
+    constexpr size_t MAT = sizeof(fn::Matrix4);
+
+    runner.run("Matrix4 multiply", 2000, N, 3 * MAT, [&] {
+      for ( size_t i = 0; i < N; i++ ) out[i] = a[i] * b[i];
+      fn::bench::doNotOptimize(out);
+    });
+    runner.run("glm::mat4 multiply", 2000, N, 3 * MAT, [&] {
+      for ( size_t i = 0; i < N; i++ ) gout[i] = ga[i] * gb[i];
+      fn::bench::doNotOptimize(gout);
+    });
+    runner.run("Math::multiply batch", 2000, N, 3 * MAT, [&] {
+      fn::Math::multiply(a.data(), b.data(), out.data(), N);
+      fn::bench::doNotOptimize(out);
+    });
+
+    runner.run("Matrix4 inversed", 1000, N, 2 * MAT, [&] {
+      for ( size_t i = 0; i < N; i++ ) out[i] = a[i].inversed();
+      fn::bench::doNotOptimize(out);
+    });
+    runner.run("glm::inverse", 1000, N, 2 * MAT, [&] {
+      for ( size_t i = 0; i < N; i++ ) gout[i] = glm::inverse(ga[i]);
+      fn::bench::doNotOptimize(gout);
+    });
+    runner.run("Math::inverseBatch", 1000, N, 2 * MAT, [&] {
+      fn::Math::inverseBatch(a.data(), out.data(), N);
+      fn::bench::doNotOptimize(out);
+    });
+    runner.run("Math::inverseAffineBatch", 1000, N, 2 * MAT, [&] {
+      fn::Math::inverseAffineBatch(a.data(), out.data(), N);
+      fn::bench::doNotOptimize(out);
+    });
+
+    const std::vector<float> angles = uniform(rng, -3.0f, 3.0f);
+    runner.run("Math::rotate", 1000, N, 2 * MAT, [&] {
+      for ( size_t i = 0; i < N; i++ ) out[i] = fn::Math::rotate(a[i], fn::Vec3(1.0f, 2.0f, 3.0f), angles[i]);
+      fn::bench::doNotOptimize(out);
+    });
+    runner.run("glm::rotate", 1000, N, 2 * MAT, [&] {
+      for ( size_t i = 0; i < N; i++ ) gout[i] = glm::rotate(ga[i], angles[i], glm::vec3(1.0f, 2.0f, 3.0f));
+      fn::bench::doNotOptimize(gout);
+    });
+  }
+
+  void vectorBenchmarks(fn::bench::Runner& runner, std::mt19937& rng) {
+    const std::vector<float> x = uniform(rng, -10.0f, 10.0f);
+    const std::vector<float> y = uniform(rng, -10.0f, 10.0f);
+    const std::vector<float> z = uniform(rng, -10.0f, 10.0f);
+
+    std::vector<fn::Vec3> v(N), w(N), out(N);
+    std::vector<glm::vec3> gv(N), gw(N), gout(N);
+    for ( size_t i = 0; i < N; i++ ) {
+      v[i] = fn::Vec3(x[i], y[i], z[i]);
+      w[i] = fn::Vec3(z[i], x[i], y[i]);
+      gv[i] = glm::vec3(x[i], y[i], z[i]);
+      gw[i] = glm::vec3(z[i], x[i], y[i]);
+    }
+    std::vector<float> d(N);
+
+    constexpr size_t VEC = sizeof(fn::Vec3);
+
+    runner.run("tVec3 normalized", 5000, N, 2 * VEC, [&] {
+      for ( size_t i = 0; i < N; i++ ) out[i] = v[i].normalized();
+      fn::bench::doNotOptimize(out);
+    });
+    runner.run("glm::normalize", 5000, N, 2 * VEC, [&] {
+      for ( size_t i = 0; i < N; i++ ) gout[i] = glm::normalize(gv[i]);
+      fn::bench::doNotOptimize(gout);
+    });
+    runner.run("tVec3 crossProduct", 5000, N, 3 * VEC, [&] {
+      for ( size_t i = 0; i < N; i++ ) out[i] = fn::crossProduct(v[i], w[i]);
+      fn::bench::doNotOptimize(out);
+    });
+    runner.run("glm::cross", 5000, N, 3 * VEC, [&] {
+      for ( size_t i = 0; i < N; i++ ) gout[i] = glm::cross(gv[i], gw[i]);
+      fn::bench::doNotOptimize(gout);
+    });
+    runner.run("tVec3 dotProduct", 5000, N, 2 * VEC + sizeof(float), [&] {
+      for ( size_t i = 0; i < N; i++ ) d[i] = fn::dotProduct(v[i], w[i]);
+      fn::bench::doNotOptimize(d);
+    });
+    runner.run("glm::dot", 5000, N, 2 * VEC + sizeof(float), [&] {
+      for ( size_t i = 0; i < N; i++ ) d[i] = glm::dot(gv[i], gw[i]);
+      fn::bench::doNotOptimize(d);
+    });
+
+    std::vector<float> sx = x, sy = y, sz = z;
+    const fn::Math::Vec3Stream stream = { sx.data(), sy.data(), sz.data() };
+    runner.run("Math::normalize stream", 5000, N, 2 * VEC, [&] {
+      fn::Math::normalize(stream, N);
+      fn::bench::doNotOptimize(sx);
+    });
+    const fn::Matrix4 m = fn::Math::rotate(fn::Matrix4(1.0f), fn::Vec3(0.0f, 1.0f, 0.0f), 0.5f);
+    runner.run("Math::transformPoints stream", 5000, N, 2 * VEC, [&] {
+      fn::Math::transformPoints(m, stream, stream, N);
+      fn::bench::doNotOptimize(sx);
+    });
+  }
+
+  // a * s0 + b * s1 + c * s2 + d, the column expression of Math::translate
+  void expressionBenchmarks(fn::bench::Runner& runner, std::mt19937& rng) {
+    const std::vector<float> e = uniform(rng, -10.0f, 10.0f, 4 * N + 3);
+    std::vector<fn::Vec4> a(N), b(N), c(N), d(N), out(N);
+    for ( size_t i = 0; i < N; i++ ) {
+      a[i] = fn::Vec4(e[i], e[i + 1], e[i + 2], e[i + 3]);
+      b[i] = fn::Vec4(e[N + i], e[N + i + 1], e[N + i + 2], e[N + i + 3]);
+      c[i] = fn::Vec4(e[2 * N + i], e[2 * N + i + 1], e[2 * N + i + 2], e[2 * N + i + 3]);
+      d[i] = fn::Vec4(e[3 * N + i], e[3 * N + i + 1], e[3 * N + i + 2], e[3 * N + i + 3]);
+    }
+    const float s0 = e[0], s1 = e[1], s2 = e[2];
+
+    constexpr size_t VEC = sizeof(fn::Vec4);
+
+    runner.run("tVec4 chain operators", 5000, N, 5 * VEC, [&] {
+      for ( size_t i = 0; i < N; i++ ) out[i] = a[i] * s0 + b[i] * s1 + c[i] * s2 + d[i];
+      fn::bench::doNotOptimize(out);
+    });
+    runner.run("tVec4 chain expr::eval", 5000, N, 5 * VEC, [&] {
+      for ( size_t i = 0; i < N; i++ ) {
+        out[i] = fn::expr::eval(fn::expr::ref(a[i]) * s0 + fn::expr::ref(b[i]) * s1 +
+                                fn::expr::ref(c[i]) * s2 + d[i]);
+      }
+      fn::bench::doNotOptimize(out);
+    });
+
+    const std::vector<fn::Matrix4> m = matrices(rng);
+    std::vector<fn::Matrix4> mout(N);
+    runner.run("Math::translate", 5000, N, 2 * sizeof(fn::Matrix4), [&] {
+      for ( size_t i = 0; i < N; i++ ) mout[i] = fn::Math::translate(m[i], fn::Vec3(s0, s1, s2));
+      fn::bench::doNotOptimize(mout);
+    });
+  }
+
+  void fastMathBenchmarks(fn::bench::Runner& runner, std::mt19937& rng) {
+    const std::vector<float> x = uniform(rng, -10.0f, 10.0f);
+    const std::vector<float> y = uniform(rng, -10.0f, 10.0f);
+    const std::vector<float> u = uniform(rng, -1.0f, 1.0f);
+    std::vector<float> s(N), c(N);
+
+    constexpr size_t F = sizeof(float);
+
+    runner.run("std::sin + std::cos", 5000, N, 3 * F, [&] {
+      for ( size_t i = 0; i < N; i++ ) {
+        s[i] = std::sin(x[i]);
+        c[i] = std::cos(x[i]);
+      }
+      fn::bench::doNotOptimize(s);
+    });
+    runner.run("Math::fastSinCos", 5000, N, 3 * F, [&] {
+      for ( size_t i = 0; i < N; i++ ) fn::Math::fastSinCos(x[i], s[i], c[i]);
+      fn::bench::doNotOptimize(s);
+    });
+    runner.run("Math::sinCosBatch", 5000, N, 3 * F, [&] {
+      fn::Math::sinCosBatch(x.data(), s.data(), c.data(), N);
+      fn::bench::doNotOptimize(s);
+    });
+
+    runner.run("std::atan2", 5000, N, 3 * F, [&] {
+      for ( size_t i = 0; i < N; i++ ) s[i] = std::atan2(y[i], x[i]);
+      fn::bench::doNotOptimize(s);
+    });
+    runner.run("Math::fastAtan2", 5000, N, 3 * F, [&] {
+      for ( size_t i = 0; i < N; i++ ) s[i] = fn::Math::fastAtan2(y[i], x[i]);
+      fn::bench::doNotOptimize(s);
+    });
+    runner.run("Math::atan2Batch", 5000, N, 3 * F, [&] {
+      fn::Math::atan2Batch(y.data(), x.data(), s.data(), N);
+      fn::bench::doNotOptimize(s);
+    });
+
+    runner.run("std::acos", 5000, N, 2 * F, [&] {
+      for ( size_t i = 0; i < N; i++ ) s[i] = std::acos(u[i]);
+      fn::bench::doNotOptimize(s);
+    });
+    runner.run("Math::fastAcos", 5000, N, 2 * F, [&] {
+      for ( size_t i = 0; i < N; i++ ) s[i] = fn::Math::fastAcos(u[i]);
+      fn::bench::doNotOptimize(s);
+    });
+    runner.run("Math::acosBatch", 5000, N, 2 * F, [&] {
+      fn::Math::acosBatch(u.data(), s.data(), N);
+      fn::bench::doNotOptimize(s);
+    });
+
+    const std::vector<float> p = uniform(rng, 1e-3f, 1e3f);
+    runner.run("1 / std::sqrt", 5000, N, 2 * F, [&] {
+      for ( size_t i = 0; i < N; i++ ) s[i] = 1.0f / std::sqrt(p[i]);
+      fn::bench::doNotOptimize(s);
+    });
+    runner.run("Math::fastRsqrt", 5000, N, 2 * F, [&] {
+      for ( size_t i = 0; i < N; i++ ) s[i] = fn::Math::fastRsqrt(p[i]);
+      fn::bench::doNotOptimize(s);
+    });
+    runner.run("Math::rsqrtBatch", 5000, N, 2 * F, [&] {
+      fn::Math::rsqrtBatch(p.data(), s.data(), N);
+      fn::bench::doNotOptimize(s);
+    });
+  }
+
+}
+
+int main(int argc, char** argv) {
+
+  fn::bench::Runner runner(argc, argv);
+
+  // One generator per group, so filtering does not change the inputs
+  std::mt19937 matrixRng(1);
+  std::mt19937 vectorRng(2);
+  std::mt19937 fastMathRng(3);
+  std::mt19937 expressionRng(4);
+  matrixBenchmarks(runner, matrixRng);
+  vectorBenchmarks(runner, vectorRng);
+  expressionBenchmarks(runner, expressionRng);
+  fastMathBenchmarks(runner, fastMathRng);
+
+  return runner.finish() ? 0 : 1;
+}
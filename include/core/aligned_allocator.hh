@@ -0,0 +1,83 @@
+#if !defined(ALIGNED_ALLOCATOR_H)
+/* ========================================================================
+   $File: aligned_allocator.hh $
+   $Date: Fri Oct 16 2026 $
+   $Revision: $
+   $Creator: Ro Stelmach $
+   $Notice: (C) Copyright 2019 by Ro Orestis Stelmach. All Rights Reserved. $
+   ======================================================================== */
+
+#define ALIGNED_ALLOCATOR_H
+
+#include "core/memory_tracker.hh"
+
+#include <cstddef>
+#include <limits>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+namespace fn {
+
+  ///
+  /// STL allocator that places every block on an `Alignment` byte boundary.
+  ///
+  /// std::allocator only honours alignof( T ), so a std::vector<float> or a
+  /// std::vector<Vec4> can start anywhere on a 4 byte boundary. With
+  /// AlignedAllocator<float, 32> the data of a SoA stream starts on an AVX
+  /// register boundary, and with 64 every Matrix4 sits in its own cache line.
+  ///
+  template <typename T, std::size_t Alignment = alignof( T )>
+  class AlignedAllocator {
+    static_assert( ( Alignment & ( Alignment - 1 ) ) == 0, "alignment must be a power of two" );
+    static_assert( Alignment >= alignof( T ), "alignment must not be below alignof( T )" );
+
+  public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using is_always_equal = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+
+    static constexpr std::size_t alignment = Alignment;
+
+    template <typename U>
+    struct rebind {
+      using other = AlignedAllocator<U, ( Alignment > alignof( U ) ? Alignment : alignof( U ) )>;
+    };
+
+    constexpr AlignedAllocator() noexcept = default;
+
+    template <typename U, std::size_t A>
+    constexpr AlignedAllocator( const AlignedAllocator<U, A> & ) noexcept {}
+
+    [[nodiscard]] T *allocate( std::size_t n ) {
+      if ( n > std::numeric_limits<std::size_t>::max() / sizeof( T ) ) {
+        throw std::bad_array_new_length();
+      }
+      // SoA streams and transform arrays of the math code
+      FN_MEMORY_SCOPE( Math );
+      return static_cast<T *>( ::operator new( n * sizeof( T ), std::align_val_t( Alignment ) ) );
+    }
+
+    void deallocate( T *p, std::size_t ) noexcept {
+      ::operator delete( p, std::align_val_t( Alignment ) );
+    }
+  };
+
+  template <typename T, std::size_t A, typename U, std::size_t B>
+  constexpr bool operator==( const AlignedAllocator<T, A> &, const AlignedAllocator<U, B> & ) noexcept {
+    return A == B;
+  }
+
+  template <typename T, std::size_t A, typename U, std::size_t B>
+  constexpr bool operator!=( const AlignedAllocator<T, A> &, const AlignedAllocator<U, B> & ) noexcept {
+    return A != B;
+  }
+
+  template <typename T, std::size_t Alignment = alignof( T )>
+  using AlignedVector = std::vector<T, AlignedAllocator<T, Alignment>>;
+
+}    // namespace fn
+
+#endif
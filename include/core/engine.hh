@@ -1,20 +1,67 @@
 #pragma once
 
+#include <atomic>
 #include <memory>
 
+#include "core/frame_clock.hh"
+#include "core/frame_pipeline.hh"
+#include "core/frame_state.hh"
+#include "core/job_system.hh"
+#include "core/memory_tracker.hh"
+#include "ecs/scheduler.hh"
+#include "ecs/world.hh"
+#include "resources/resource_manager.hh"
+
 namespace fn {
 
   class BaseRenderer;
 
+  /// How the main loop spreads a frame over threads.
+  enum class ThreadingMode {
+    /// update, capture and render one after the other on the main thread.
+    Serial,
+    /// The main thread simulates frame N + 1 while a render thread draws
+    /// frame N, one frame of latency for up to twice the throughput.
+    Pipelined
+  };
+
   class Engine {
   private:
     Engine() noexcept;
     static Engine *m_instance;
 
+    // Allocations live before the engine, the ones left after destroy() leaked
+    static MemoryTracker::Snapshot m_memoryAtStart;
+
     // Renderer used by the engine ( OpenGL or Vulkan )
     std::shared_ptr<BaseRenderer> m_renderer;
 
+    // Drives the fixed timestep of update() and the alpha of render()
+    FrameClock m_clock;
+
+    // Read at every frame, so the mode can change while running
+    std::atomic<ThreadingMode> m_threadingMode{ThreadingMode::Serial};
+
+    // Frame of the serial loop and the handoff of the pipelined one
+    FrameState m_frame;
+    FramePipeline<FrameState> m_pipeline;
+
+    // Workers are spawned by the main thread, which stays worker 0
+    JobSystem m_jobs;
+
+    // Entities of the scene and the systems run on them every frame, on
+    // the main thread: the render thread only sees the captured FrameState
+    ecs::World m_world;
+    ecs::SystemScheduler m_systems;
+
+    // Assets of the renderer and the scene, decoded on loader threads
+    ResourceManager m_resources;
+
     void mainLoop() noexcept;
+    void runSerial() noexcept;
+    void runPipelined() noexcept;
+    void simulate( FrameState &frame ) noexcept;
+    bool keepRunning( ThreadingMode mode ) const noexcept;
 
   public:
     static Engine *getInstance() noexcept;
@@ -31,6 +78,36 @@ namespace fn {
     std::shared_ptr<BaseRenderer> getRenderer() const noexcept {
       return m_renderer;
     }
+
+    FrameClock &getFrameClock() noexcept {
+      return m_clock;
+    }
+
+    JobSystem &getJobSystem() noexcept {
+      return m_jobs;
+    }
+
+    ResourceManager &getResources() noexcept {
+      return m_resources;
+    }
+
+    ecs::World &getWorld() noexcept {
+      return m_world;
+    }
+
+    /// Transform and bounds systems are registered, more run after them.
+    ecs::SystemScheduler &getSystems() noexcept {
+      return m_systems;
+    }
+
+    /// Takes effect at the next frame, from any thread.
+    void setThreadingMode( ThreadingMode mode ) noexcept {
+      m_threadingMode.store( mode );
+    }
+
+    ThreadingMode getThreadingMode() const noexcept {
+      return m_threadingMode.load();
+    }
   };
 
 }    // namespace fn
@@ -0,0 +1,128 @@
+#if !defined( FRAME_ARENA_H )
+/* ========================================================================
+   $File: frame_arena.hh $
+   $Date: Fri Oct 16 2026 $
+   $Revision: $
+   $Creator: Ro Stelmach $
+   $Notice: (C) Copyright 2019 by Ro Orestis Stelmach. All Rights Reserved. $
+   ======================================================================== */
+
+#define FRAME_ARENA_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <type_traits>
+
+// Debug builds fill fresh allocations and released memory with marker bytes,
+// so reads of uninitialized or stale transient data stand out
+#if !defined( FN_ARENA_POISON ) && !defined( NDEBUG )
+#define FN_ARENA_POISON
+#endif
+
+namespace fn {
+
+  ///
+  /// Linear allocator for data that lives until the end of a frame.
+  ///
+  /// Allocating bumps a pointer, freeing does nothing, and reset() takes
+  /// everything back at once. It is a std::pmr::memory_resource, so the
+  /// standard containers can use it directly:
+  ///
+  ///   std::pmr::vector<VkWriteDescriptorSet> writes( &arena );
+  ///   std::pmr::string name( "pass ", &arena );
+  ///
+  /// Memory is never returned before reset() and destructors never run, keep
+  /// nothing in an arena that owns a resource. Not thread safe, use one
+  /// arena per thread, and one per frame in flight for data the GPU reads.
+  ///
+  /// A frame that does not fit spills into heap blocks. reset() frees them
+  /// and grows the arena to the high water mark, so it settles at the size
+  /// of the largest frame after a few frames.
+  ///
+  class FrameArena : public std::pmr::memory_resource {
+  public:
+    static constexpr uint8_t ALLOCATED_BYTE = 0xCD;
+    static constexpr uint8_t RELEASED_BYTE = 0xDD;
+
+    explicit FrameArena( std::size_t capacity = 64 * 1024 );
+
+    /// Starts in a caller owned buffer, e.g. on the stack, and only touches
+    /// the heap when that is full.
+    FrameArena( void *buffer, std::size_t size ) noexcept;
+
+    ~FrameArena() noexcept override;
+
+    FrameArena( const FrameArena & ) = delete;
+    FrameArena &operator=( const FrameArena & ) = delete;
+
+    /// Uninitialized room for count objects of T.
+    template <typename T>
+    [[nodiscard]] T *allocateArray( std::size_t count ) {
+      static_assert( std::is_trivially_destructible_v<T>, "the arena never runs destructors" );
+      return static_cast<T *>( allocate( count * sizeof( T ), alignof( T ) ) );
+    }
+
+    /// Releases every allocation. Pointers into the arena dangle afterwards.
+    void reset();
+
+    /// Bytes handed out since reset(), alignment padding included.
+    std::size_t used() const noexcept {
+      return m_used;
+    }
+
+    /// Bytes of the main block, what a frame can use without the heap.
+    std::size_t capacity() const noexcept {
+      return m_capacity;
+    }
+
+    /// Largest used() seen at a reset() or now.
+    std::size_t highWaterMark() const noexcept {
+      return m_used > m_highWaterMark ? m_used : m_highWaterMark;
+    }
+
+    /// How often a frame spilled into the heap.
+    uint32_t overflowCount() const noexcept {
+      return m_overflowCount;
+    }
+
+    /// Logs the high water mark against the capacity.
+    void report( const char *name ) const noexcept;
+
+    static constexpr bool poisoning() noexcept {
+#if defined( FN_ARENA_POISON )
+      return true;
+#else
+      return false;
+#endif
+    }
+
+  private:
+    struct Block;
+
+    void *do_allocate( std::size_t bytes, std::size_t alignment ) override;
+    void do_deallocate( void *, std::size_t, std::size_t ) noexcept override {}
+    bool do_is_equal( const std::pmr::memory_resource &other ) const noexcept override {
+      return this == &other;
+    }
+
+    unsigned char *bump( std::size_t bytes, std::size_t alignment ) noexcept;
+    void releaseOverflow() noexcept;
+
+    unsigned char *m_begin;
+    unsigned char *m_cursor;
+    unsigned char *m_end;
+    std::size_t m_capacity;
+    bool m_ownsBuffer;
+
+    // Heap blocks of the current frame, newest first
+    Block *m_overflow = nullptr;
+
+    std::size_t m_used = 0;
+    std::size_t m_highWaterMark = 0;
+    uint32_t m_overflowCount = 0;
+  };
+
+}    // namespace fn
+
+#endif
@@ -0,0 +1,141 @@
+#if !defined( FRAME_CLOCK_H )
+/* ========================================================================
+   $File: frame_clock.hh $
+   $Date: Fri Oct 16 2026 $
+   $Revision: $
+   $Creator: Ro Stelmach $
+   $Notice: (C) Copyright 2019 by Ro Orestis Stelmach. All Rights Reserved. $
+   ======================================================================== */
+
+#define FRAME_CLOCK_H
+
+#include <chrono>
+#include <cstdint>
+
+namespace fn {
+
+  ///
+  /// Monotonic frame clock with a fixed timestep accumulator.
+  ///
+  /// Every frame adds the measured wall time to an accumulator, and the
+  /// simulation consumes it in steps of exactly fixedStep(), so update cost
+  /// and results do not depend on the frame rate. What is left over becomes
+  /// alpha(), the fraction of a step the renderer should interpolate by.
+  ///
+  ///   clock.beginFrame();
+  ///   while ( clock.step() ) update( clock.fixedStep() );
+  ///   render( clock.alpha() );
+  ///   clock.endFrame();
+  ///
+  /// A long frame ( a breakpoint, a window drag ) is clamped to
+  /// maxFrameTime() and at most maxSteps() updates run per frame, the rest of
+  /// the backlog is dropped, so a slow simulation cannot spiral. endFrame()
+  /// optionally caps the frame rate, sleeping for most of the wait and
+  /// spinning for the last part, since sleeps overshoot by up to a
+  /// scheduler tick.
+  ///
+  class FrameClock {
+  public:
+    using clock = std::chrono::steady_clock;
+    using duration = std::chrono::nanoseconds;
+
+    explicit FrameClock( double fixedStep = 1.0 / 60.0 ) noexcept;
+
+    ///
+    /// Setters, times in seconds
+    ///
+    void setFixedStep( double seconds ) noexcept;
+    void setMaxFrameTime( double seconds ) noexcept;
+    void setMaxSteps( uint32_t steps ) noexcept;
+
+    /// 0 disables the cap, vsync then paces the frames.
+    void setTargetFrameRate( double framesPerSecond ) noexcept;
+
+    /// Time left to the cap that is spun instead of slept.
+    void setSpinTime( double seconds ) noexcept;
+
+    /// Restarts the clock, the next frame measures from now.
+    void reset() noexcept;
+
+    /// Measures the time since the previous frame and feeds the accumulator.
+    void beginFrame() noexcept;
+
+    /// Same, with an explicit frame time, for replays and tests.
+    void beginFrame( duration elapsed ) noexcept;
+
+    /// Consumes one fixed step, false once less than a step is left.
+    bool step() noexcept;
+
+    /// Waits for the frame rate cap, if any.
+    void endFrame() noexcept;
+
+    ///
+    /// Getters
+    ///
+    double fixedStep() const noexcept {
+      return seconds( m_fixedStep );
+    }
+
+    double maxFrameTime() const noexcept {
+      return seconds( m_maxFrameTime );
+    }
+
+    uint32_t maxSteps() const noexcept {
+      return m_maxSteps;
+    }
+
+    /// Interpolation factor between the last two simulation states, in [0, 1).
+    double alpha() const noexcept {
+      return static_cast<double>( m_accumulator.count() ) / static_cast<double>( m_fixedStep.count() );
+    }
+
+    /// Measured time of the current frame, before clamping.
+    double frameTime() const noexcept {
+      return seconds( m_frameTime );
+    }
+
+    /// Simulated time, the sum of all steps taken.
+    double simulationTime() const noexcept {
+      return seconds( m_simulationTime );
+    }
+
+    /// Time thrown away by the clamp and the step limit since reset().
+    double droppedTime() const noexcept {
+      return seconds( m_droppedTime );
+    }
+
+    uint64_t frameIndex() const noexcept {
+      return m_frameIndex;
+    }
+
+    uint32_t stepsThisFrame() const noexcept {
+      return m_stepsThisFrame;
+    }
+
+  private:
+    static double seconds( duration d ) noexcept {
+      return std::chrono::duration<double>( d ).count();
+    }
+
+    static duration fromSeconds( double s ) noexcept {
+      return std::chrono::duration_cast<duration>( std::chrono::duration<double>( s ) );
+    }
+
+    duration m_fixedStep;
+    duration m_maxFrameTime;
+    duration m_targetFrameTime;
+    duration m_spinTime;
+    uint32_t m_maxSteps;
+
+    clock::time_point m_frameStart;
+    duration m_frameTime;
+    duration m_accumulator;
+    duration m_simulationTime;
+    duration m_droppedTime;
+    uint64_t m_frameIndex;
+    uint32_t m_stepsThisFrame;
+  };
+
+}    // namespace fn
+
+#endif
@@ -0,0 +1,127 @@
+#if !defined( FRAME_PIPELINE_H )
+/* ========================================================================
+   $File: frame_pipeline.hh $
+   $Date: Fri Oct 16 2026 $
+   $Revision: $
+   $Creator: Ro Stelmach $
+   $Notice: (C) Copyright 2019 by Ro Orestis Stelmach. All Rights Reserved. $
+   ======================================================================== */
+
+#define FRAME_PIPELINE_H
+
+#include <array>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+namespace fn {
+
+  ///
+  /// Ring of N frame slots between one producer and one consumer thread.
+  ///
+  /// The producer fills the slot of frame n while the consumer reads the
+  /// slot of an older frame, then hands it over with endWrite(). A slot is
+  /// only written again once the consumer released it, so a reader always
+  /// sees an immutable, complete frame. With N = 2 the producer runs at most
+  /// one frame ahead, every extra slot allows one more frame of latency.
+  ///
+  ///   // producer                            // consumer
+  ///   while ( T *frame = p.beginWrite() ) {   while ( const T *frame = p.beginRead() ) {
+  ///     fill( *frame );                         draw( *frame );
+  ///     p.endWrite();                           p.endRead();
+  ///   }                                       }
+  ///
+  /// close() ends both loops, the consumer after the last published frame.
+  ///
+  /// Slots are reused, not reconstructed, so containers in T keep their
+  /// capacity from one frame to the next.
+  ///
+  template <typename T, std::size_t N = 2>
+  class FramePipeline {
+    static_assert( N >= 2, "a pipeline needs a slot to write and a slot to read" );
+
+  public:
+    FramePipeline() noexcept = default;
+    FramePipeline( const FramePipeline & ) = delete;
+    FramePipeline &operator=( const FramePipeline & ) = delete;
+
+    /// Slot of the next frame, blocks while every slot is written or read.
+    /// nullptr once the pipeline is closed.
+    T *beginWrite() noexcept {
+      std::unique_lock<std::mutex> lock( m_mutex );
+      m_changed.wait( lock, [this] { return m_closed || m_written - m_read < N; } );
+      return m_closed ? nullptr : &m_slots[ m_written % N ];
+    }
+
+    /// Publishes the slot returned by beginWrite().
+    void endWrite() noexcept {
+      {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        m_written++;
+      }
+      m_changed.notify_all();
+    }
+
+    /// Oldest published frame, blocks until there is one. nullptr once the
+    /// pipeline is closed and every published frame has been read.
+    const T *beginRead() noexcept {
+      std::unique_lock<std::mutex> lock( m_mutex );
+      m_changed.wait( lock, [this] { return m_closed || m_read < m_written; } );
+      return m_read < m_written ? &m_slots[ m_read % N ] : nullptr;
+    }
+
+    /// Releases the slot returned by beginRead() to the producer.
+    void endRead() noexcept {
+      {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        m_read++;
+      }
+      m_changed.notify_all();
+    }
+
+    /// Wakes both sides, the consumer still drains the published frames.
+    void close() noexcept {
+      {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        m_closed = true;
+      }
+      m_changed.notify_all();
+    }
+
+    /// Opens a closed pipeline again, neither side may be inside a frame.
+    void reset() noexcept {
+      std::lock_guard<std::mutex> lock( m_mutex );
+      m_written = 0;
+      m_read = 0;
+      m_closed = false;
+    }
+
+    /// Frames published and frames released since reset().
+    uint64_t written() const noexcept {
+      std::lock_guard<std::mutex> lock( m_mutex );
+      return m_written;
+    }
+
+    uint64_t read() const noexcept {
+      std::lock_guard<std::mutex> lock( m_mutex );
+      return m_read;
+    }
+
+    static constexpr std::size_t slotCount() noexcept {
+      return N;
+    }
+
+  private:
+    std::array<T, N> m_slots{};
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_changed;
+    uint64_t m_written = 0;
+    uint64_t m_read = 0;
+    bool m_closed = false;
+  };
+
+}    // namespace fn
+
+#endif
@@ -0,0 +1,89 @@
+#if !defined( FRAME_STATE_H )
+/* ========================================================================
+   $File: frame_state.hh $
+   $Date: Fri Oct 16 2026 $
+   $Revision: $
+   $Creator: Ro Stelmach $
+   $Notice: (C) Copyright 2019 by Ro Orestis Stelmach. All Rights Reserved. $
+   ======================================================================== */
+
+#define FRAME_STATE_H
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+namespace fn {
+
+  ///
+  /// Input as it was when a frame was captured, so the renderer never reads
+  /// IOManager while the simulation polls the next events.
+  ///
+  struct InputSnapshot {
+    double mouseX = 0.0;
+    double mouseY = 0.0;
+    bool leftMouse = false;
+    bool rightMouse = false;
+    bool middleMouse = false;
+
+    /// Keys held down, in no particular order.
+    std::vector<int> heldKeys;
+
+    bool isKeyHeld( int key ) const noexcept {
+      return std::find( heldKeys.begin(), heldKeys.end(), key ) != heldKeys.end();
+    }
+  };
+
+  ///
+  /// Where the camera is and where it looks after one simulation step.
+  ///
+  struct CameraState {
+    glm::vec3 position = glm::vec3( 0.0f );
+    glm::vec3 front = glm::vec3( 0.0f, 0.0f, -1.0f );
+    glm::vec3 up = glm::vec3( 0.0f, 1.0f, 0.0f );
+  };
+
+  ///
+  /// Everything the renderer needs from the simulation for one frame.
+  ///
+  /// BaseRenderer::captureFrame() fills it on the simulation thread after
+  /// the update steps, BaseRenderer::render() draws from it. In pipelined
+  /// mode the renderer reads one FrameState while the simulation writes the
+  /// next, so render() must not touch simulation state directly.
+  ///
+  struct FrameState {
+    uint64_t frameIndex = 0;
+    double simulationTime = 0.0;
+
+    /// Fraction of a step between the last two simulation states, in [0, 1).
+    float alpha = 0.0f;
+
+    /// 0 while the window is minimized, the renderer then skips the frame.
+    uint32_t framebufferWidth = 0;
+    uint32_t framebufferHeight = 0;
+
+    /// The camera after the last step and the one before it.
+    CameraState camera;
+    CameraState previousCamera;
+
+    /// View matrix alpha of the way from the previous camera to the current
+    /// one, so the camera moves smoothly when frames outpace the steps.
+    glm::mat4 view() const noexcept {
+      const glm::vec3 position = glm::mix( previousCamera.position, camera.position, alpha );
+      const glm::vec3 front = glm::mix( previousCamera.front, camera.front, alpha );
+      const glm::vec3 up = glm::mix( previousCamera.up, camera.up, alpha );
+      return glm::lookAt( position, position + front, up );
+    }
+
+    /// Model matrices of the objects to draw.
+    std::vector<glm::mat4> transforms;
+
+    InputSnapshot input;
+  };
+
+}    // namespace fn
+
+#endif
@@ -2,6 +2,7 @@
 
 // Project Headers
 #include "core/fission.hh"
+#include "core/frame_state.hh"
 
 // GLFW Headers
 #include <GLFW/glfw3.h>
@@ -66,6 +67,9 @@ namespace fn {
 
     double getMousePosX() const noexcept;
     double getMousePosY() const noexcept;
+
+    // Copies the current input state, reusing the storage of input
+    void snapshot( InputSnapshot &input ) const noexcept;
   };
 
 }    // namespace fn
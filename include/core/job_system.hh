@@ -0,0 +1,170 @@
+#if !defined( JOB_SYSTEM_H )
+/* ========================================================================
+   $File: job_system.hh $
+   $Date: Fri Oct 16 2026 $
+   $Revision: $
+   $Creator: Ro Stelmach $
+   $Notice: (C) Copyright 2019 by Ro Orestis Stelmach. All Rights Reserved. $
+   ======================================================================== */
+
+#define JOB_SYSTEM_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+namespace fn {
+
+  ///
+  /// Number of unfinished jobs in a group. Every job scheduled with a counter
+  /// adds one and removes it when it is done, JobSystem::wait() returns once
+  /// the counter is back to zero. A counter can be reused after that.
+  ///
+  class JobCounter {
+  public:
+    JobCounter() noexcept = default;
+    JobCounter( const JobCounter & ) = delete;
+    JobCounter &operator=( const JobCounter & ) = delete;
+
+    bool done() const noexcept {
+      return m_pending.load( std::memory_order_acquire ) == 0;
+    }
+
+    uint32_t pending() const noexcept {
+      return m_pending.load( std::memory_order_acquire );
+    }
+
+  private:
+    friend class JobSystem;
+    std::atomic<uint32_t> m_pending{0};
+  };
+
+  ///
+  /// Work stealing job system.
+  ///
+  /// One worker per hardware thread, the thread that creates the system
+  /// being worker 0. Each worker owns a lock free Chase-Lev deque: it pushes
+  /// and pops its own jobs at the bottom, idle workers steal from the top of
+  /// the others, and workers that find nothing sleep on a condition variable.
+  /// A thread that waits on a counter runs jobs meanwhile instead of blocking.
+  ///
+  /// Jobs are small copies of trivially copyable callables, capture what
+  /// they need by reference or pointer:
+  ///
+  ///   JobCounter loaded;
+  ///   jobs.schedule( loaded, [&model] { model.load(); } );
+  ///   jobs.parallelFor( transforms.size(), 256, [&]( size_t begin, size_t end ) {
+  ///     Math::multiply( &parents[ begin ], &locals[ begin ], &transforms[ begin ], end - begin );
+  ///   } );
+  ///   jobs.wait( loaded );
+  ///
+  /// parallelFor bodies take either a ( begin, end ) range or one index.
+  /// Ranges are split in halves down to `grain` elements as workers pick
+  /// them up, so thieves take big pieces first.
+  ///
+  /// Jobs may be scheduled from worker 0 and from inside other jobs. Calls
+  /// from any other thread run the job inline.
+  ///
+  class JobSystem {
+  public:
+    /// 0 picks one thread per hardware thread, the calling thread included.
+    explicit JobSystem( uint32_t threadCount = 0 ) noexcept;
+    ~JobSystem() noexcept;
+
+    JobSystem( const JobSystem & ) = delete;
+    JobSystem &operator=( const JobSystem & ) = delete;
+
+    uint32_t threadCount() const noexcept {
+      return static_cast<uint32_t>( m_workers.size() );
+    }
+
+    /// Index of the calling worker, or threadCount() for other threads.
+    uint32_t currentThread() const noexcept;
+
+    template <typename F>
+    void schedule( JobCounter &counter, const F &function ) noexcept {
+      checkCallable<F>();
+      submit( counter, &invokeTask<F>, &function, sizeof( F ), 0, 1, 1 );
+    }
+
+    /// Runs body over [ 0, count ) in the background, body is copied.
+    template <typename F>
+    void parallelFor( JobCounter &counter, std::size_t count, std::size_t grain, const F &body ) noexcept {
+      checkCallable<F>();
+      if ( count == 0 ) return;
+      submit( counter, &invokeRange<F>, &body, sizeof( F ), 0, count, grain ? grain : 1 );
+    }
+
+    /// Runs body over [ 0, count ) and returns when every index is done.
+    template <typename F>
+    void parallelFor( std::size_t count, std::size_t grain, const F &body ) noexcept {
+      const F *pointer = &body;
+      JobCounter counter;
+      parallelFor( counter, count, grain, [pointer]( std::size_t begin, std::size_t end ) {
+        invokeRange<F>( pointer, begin, end );
+      } );
+      wait( counter );
+    }
+
+    void wait( const JobCounter &counter ) noexcept;
+
+    struct Job;
+    struct Worker;
+
+  private:
+    using Function = void ( * )( const void *storage, std::size_t begin, std::size_t end );
+
+    /// Room for the captures of one job.
+    static constexpr std::size_t STORAGE_SIZE = 48;
+
+    template <typename F>
+    static constexpr void checkCallable() noexcept {
+      static_assert( std::is_trivially_copyable_v<F>,
+                     "jobs must be trivially copyable, capture by reference or pointer" );
+      static_assert( sizeof( F ) <= STORAGE_SIZE && alignof( F ) <= alignof( std::max_align_t ),
+                     "job captures are too large, capture a pointer to a struct instead" );
+    }
+
+    template <typename F>
+    static void invokeTask( const void *storage, std::size_t, std::size_t ) {
+      ( *static_cast<const F *>( storage ) )();
+    }
+
+    template <typename F>
+    static void invokeRange( const void *storage, std::size_t begin, std::size_t end ) {
+      const F &body = *static_cast<const F *>( storage );
+      if constexpr ( std::is_invocable_v<const F &, std::size_t, std::size_t> ) {
+        body( begin, end );
+      } else {
+        for ( std::size_t i = begin; i < end; i++ ) body( i );
+      }
+    }
+
+    void submit( JobCounter &counter, Function function, const void *storage, std::size_t size,
+                 std::size_t begin, std::size_t end, std::size_t grain ) noexcept;
+
+    Worker *currentWorker() const noexcept;
+    Job *allocate( Worker &worker ) noexcept;
+    void push( Worker &worker, Job *job ) noexcept;
+    Job *findJob( Worker &worker ) noexcept;
+    void execute( Worker &worker, Job *job ) noexcept;
+    void workerLoop( Worker &worker ) noexcept;
+
+    std::vector<std::unique_ptr<Worker>> m_workers;
+
+    // Jobs sitting in a deque, an idle worker only sleeps when there are none
+    std::atomic<int64_t> m_queued{0};
+    std::atomic<uint32_t> m_sleeping{0};
+    std::atomic<bool> m_stop{false};
+    std::mutex m_sleepMutex;
+    std::condition_variable m_wake;
+  };
+
+}    // namespace fn
+
+#endif
@@ -12,6 +12,10 @@
 #include <cstdarg>
 #include <fstream>
 #include <iostream>
+#include <string>
+
+#include "core/frame_arena.hh"
+#include "core/memory_tracker.hh"
 
 // TODO: create a regular methods that outputs mesg to a std stream
 // also create a method that takes as input a stream ( file for example )
@@ -40,15 +44,16 @@ namespace fn {
     };
 
     template <typename... Args>
-    extern std::string generic_print_func(const std::string &str,
-                                          va_list args) noexcept {
+    extern std::pmr::string generic_print_func(const char *format, va_list args,
+                                               std::pmr::memory_resource *memory) noexcept {
       va_list argsCopy;
       va_copy(argsCopy, args);
-      auto size = vsnprintf(nullptr, 0, str.c_str(), args) + 1;
+      auto size = vsnprintf(nullptr, 0, format, args) + 1;
 
-      std::string tmp;
+      std::pmr::string tmp(memory);
       tmp.resize(static_cast<long unsigned>(size));
-      vsnprintf(&tmp[0], static_cast<size_t>(size), str.c_str(), argsCopy);
+      vsnprintf(&tmp[0], static_cast<size_t>(size), format, argsCopy);
+      va_end(argsCopy);
       tmp.pop_back(); // remove trailing NULL
 
       return tmp;
@@ -57,9 +62,15 @@ namespace fn {
     template <typename... Args>
     extern size_t process_log(LogType type, const char *format,
                               va_list args) noexcept {
+      FN_MEMORY_SCOPE(Logging);
+
+      // Typical messages are formatted without touching the heap
+      alignas(std::max_align_t) char stack[1024];
+      FrameArena arena(stack, sizeof(stack));
 
-      std::string info_string;
-      std::string args_str = generic_print_func(format, args);
+      std::pmr::string info_string(&arena);
+      std::pmr::string args_str = generic_print_func(format, args, &arena);
+      info_string.reserve(args_str.size() + 32);
 
       /**
          Maybe abstract somehow this swith statement away?
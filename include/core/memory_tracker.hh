@@ -0,0 +1,129 @@
+#if !defined( MEMORY_TRACKER_H )
+/* ========================================================================
+   $File: memory_tracker.hh $
+   $Date: Sat Oct 17 2026 $
+   $Revision: $
+   $Creator: Ro Stelmach $
+   $Notice: (C) Copyright 2019 by Ro Orestis Stelmach. All Rights Reserved. $
+   ======================================================================== */
+
+#define MEMORY_TRACKER_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace fn {
+
+  /// Subsystem the bytes of an allocation are charged to.
+  enum class MemoryTag : uint8_t { General, Renderer, Math, Assets, Logging, Ecs, Count };
+
+  constexpr std::size_t MEMORY_TAG_COUNT = static_cast<std::size_t>( MemoryTag::Count );
+
+  const char *memoryTagName( MemoryTag tag ) noexcept;
+
+  struct MemoryStats {
+    /// Bytes held now and at most so far.
+    std::size_t current = 0;
+    std::size_t peak = 0;
+
+    /// Allocations made so far, and the ones not freed yet.
+    std::size_t allocations = 0;
+    std::size_t live = 0;
+
+    /// 0 for none.
+    std::size_t budget = 0;
+  };
+
+  ///
+  /// Host memory per subsystem.
+  ///
+  ///   void VulkanBase::loadModel() noexcept {
+  ///     FN_MEMORY_SCOPE( Renderer );
+  ///     vertices.reserve( count );    // charged to MemoryTag::Renderer
+  ///   }
+  ///
+  /// With the MEMORY_TRACKING option on, FN_MEMORY_TRACKING is defined and
+  /// the global new and delete go through allocate() and deallocate(): every
+  /// allocation is charged to the innermost FN_MEMORY_SCOPE of its thread,
+  /// General outside of any, and freeing it credits the same tag wherever
+  /// that happens. The C libraries that take allocator hooks, stb_image, use
+  /// allocate() as well. Without the option scopes compile to nothing and
+  /// only what calls allocate() directly is counted.
+  ///
+  /// Each block carries a small header with its size and tag, so tracking
+  /// costs a few bytes and a handful of relaxed atomics per allocation.
+  ///
+  class MemoryTracker {
+  public:
+#if defined( FN_MEMORY_TRACKING )
+    static constexpr bool enabled = true;
+#else
+    static constexpr bool enabled = false;
+#endif
+
+    /// Live allocations and bytes per tag at some point, see reportLeaks().
+    struct Snapshot {
+      std::array<std::size_t, MEMORY_TAG_COUNT> live{};
+      std::array<std::size_t, MEMORY_TAG_COUNT> bytes{};
+    };
+
+    /// nullptr when out of memory. `alignment` is a power of two.
+    static void *allocate( std::size_t size, std::size_t alignment, MemoryTag tag ) noexcept;
+    static void deallocate( void *memory ) noexcept;
+
+    /// realloc() for C hooks, the block keeps its tag. `tag` is for a null
+    /// `memory` only.
+    static void *reallocate( void *memory, std::size_t size, MemoryTag tag ) noexcept;
+
+    static MemoryTag currentTag() noexcept;
+    static void setCurrentTag( MemoryTag tag ) noexcept;
+
+    static MemoryStats stats( MemoryTag tag ) noexcept;
+
+    /// Bytes a tag should stay under, 0 removes the budget.
+    static void setBudget( MemoryTag tag, std::size_t bytes ) noexcept;
+
+    /// Logs the tags that went over their budget since the last call, false
+    /// if any is over. Allocations never fail because of a budget.
+    static bool checkBudgets() noexcept;
+
+    static Snapshot snapshot() noexcept;
+
+    /// Logs the tags holding more allocations than at `since` and returns
+    /// the bytes they hold on top. Blocks meant to live until exit, thread
+    /// caches and the profiler buffers, show up under General.
+    static std::size_t reportLeaks( const Snapshot &since ) noexcept;
+
+    /// Logs current, peak and allocation count of every tag.
+    static void report() noexcept;
+  };
+
+  class MemoryScope {
+  public:
+    explicit MemoryScope( MemoryTag tag ) noexcept : m_previous( MemoryTracker::currentTag() ) {
+      MemoryTracker::setCurrentTag( tag );
+    }
+
+    ~MemoryScope() noexcept {
+      MemoryTracker::setCurrentTag( m_previous );
+    }
+
+    MemoryScope( const MemoryScope & ) = delete;
+    MemoryScope &operator=( const MemoryScope & ) = delete;
+
+  private:
+    MemoryTag m_previous;
+  };
+
+}    // namespace fn
+
+#if defined( FN_MEMORY_TRACKING )
+#define FN_MEMORY_CONCAT_( a, b ) a##b
+#define FN_MEMORY_CONCAT( a, b ) FN_MEMORY_CONCAT_( a, b )
+#define FN_MEMORY_SCOPE( tag ) fn::MemoryScope FN_MEMORY_CONCAT( fnMemoryScope, __LINE__ )( fn::MemoryTag::tag )
+#else
+#define FN_MEMORY_SCOPE( tag ) static_cast<void>( 0 )
+#endif
+
+#endif
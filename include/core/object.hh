@@ -1,7 +1,11 @@
 #pragma once
 
+#include "core/pool_allocator.hh"
+
 namespace fn {
 
+  /// Base of engine objects. Derived classes that are created and destroyed
+  /// in large numbers can opt into a pool with FN_POOLED( Class ).
   class Object {
   private:
   public:
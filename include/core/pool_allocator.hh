@@ -0,0 +1,293 @@
+#if !defined( POOL_ALLOCATOR_H )
+/* ========================================================================
+   $File: pool_allocator.hh $
+   $Date: Fri Oct 16 2026 $
+   $Revision: $
+   $Creator: Ro Stelmach $
+   $Notice: (C) Copyright 2019 by Ro Orestis Stelmach. All Rights Reserved. $
+   ======================================================================== */
+
+#define POOL_ALLOCATOR_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace fn {
+
+  struct PoolStats {
+    /// Chunks taken from the heap and the slots they hold.
+    std::size_t chunks = 0;
+    std::size_t capacity = 0;
+
+    /// Slots handed out, live objects plus the slots parked in thread caches.
+    std::size_t outstanding = 0;
+    std::size_t peakOutstanding = 0;
+
+    /// Trips to the shared free list, one per batch when thread caches are on.
+    std::size_t refills = 0;
+  };
+
+  ///
+  /// Fixed size allocator for objects of type T.
+  ///
+  /// Slots come from chunks of `slotsPerChunk` objects and go back to an
+  /// intrusive free list, so objects of one type sit together in memory and
+  /// churn never fragments the heap. Chunks are only returned when the pool
+  /// is destroyed.
+  ///
+  /// Every call locks the pool, except on shared(): the per type pool that
+  /// FN_POOLED classes and PoolStdAllocator use keeps a small cache of free
+  /// slots per thread and only locks to move a batch of them, so threads
+  /// streaming resources in and out do not contend on one lock.
+  ///
+  template <typename T>
+  class PoolAllocator {
+  public:
+    static constexpr std::size_t slotSize = sizeof( T ) > sizeof( void * ) ? sizeof( T ) : sizeof( void * );
+    static constexpr std::size_t slotAlignment = alignof( T ) > alignof( void * ) ? alignof( T ) : alignof( void * );
+
+    /// Slots of the thread caches of shared(), and how many move at once.
+    static constexpr uint32_t CACHE_SIZE = 64;
+    static constexpr uint32_t CACHE_BATCH = CACHE_SIZE / 2;
+
+    explicit PoolAllocator( std::size_t slotsPerChunk = defaultSlotsPerChunk() ) noexcept
+        : m_slotsPerChunk( std::max<std::size_t>( slotsPerChunk, 1 ) ) {}
+
+    ~PoolAllocator() noexcept {
+      for ( void *chunk : m_chunks ) {
+        ::operator delete( chunk, std::align_val_t( slotAlignment ) );
+      }
+    }
+
+    PoolAllocator( const PoolAllocator & ) = delete;
+    PoolAllocator &operator=( const PoolAllocator & ) = delete;
+
+    /// The pool of T for FN_POOLED and PoolStdAllocator, with thread caches.
+    /// It is never destroyed, so objects may outlive static destruction.
+    static PoolAllocator &shared() noexcept {
+      static PoolAllocator *pool = new PoolAllocator( defaultSlotsPerChunk(), true );
+      return *pool;
+    }
+
+    /// Uninitialized storage for one T.
+    [[nodiscard]] void *allocate() {
+      if ( m_threadCache ) {
+        ThreadCache &cache = threadCache();
+        if ( cache.count == 0 ) {
+          cache.count = acquire( cache.slots, CACHE_BATCH );
+        }
+        return cache.slots[ --cache.count ];
+      }
+
+      void *slot = nullptr;
+      acquire( &slot, 1 );
+      return slot;
+    }
+
+    /// Gives back storage from allocate(), of this pool but any thread.
+    void deallocate( void *slot ) noexcept {
+      if ( m_threadCache ) {
+        ThreadCache &cache = threadCache();
+        if ( cache.count == CACHE_SIZE ) {
+          cache.count -= CACHE_BATCH;
+          release( cache.slots + cache.count, CACHE_BATCH );
+        }
+        cache.slots[ cache.count++ ] = slot;
+        return;
+      }
+
+      release( &slot, 1 );
+    }
+
+    template <typename... Args>
+    [[nodiscard]] T *create( Args &&... args ) {
+      void *slot = allocate();
+      try {
+        return ::new( slot ) T( std::forward<Args>( args )... );
+      } catch ( ... ) {
+        deallocate( slot );
+        throw;
+      }
+    }
+
+    void destroy( T *object ) noexcept {
+      if ( object ) {
+        object->~T();
+        deallocate( object );
+      }
+    }
+
+    /// Grows the pool to at least `count` slots ahead of a burst.
+    void reserve( std::size_t count ) {
+      std::lock_guard<std::mutex> lock( m_mutex );
+      while ( m_stats.capacity < count ) grow();
+    }
+
+    PoolStats stats() const noexcept {
+      std::lock_guard<std::mutex> lock( m_mutex );
+      return m_stats;
+    }
+
+    /// Class level operator new / delete of FN_POOLED. Classes derived from
+    /// a pooled class are larger and fall back to the global heap.
+    static void *allocateObject( std::size_t size ) {
+      return size == sizeof( T ) ? shared().allocate()
+                                 : ::operator new( size, std::align_val_t( slotAlignment ) );
+    }
+
+    static void deallocateObject( void *object, std::size_t size ) noexcept {
+      if ( size == sizeof( T ) ) {
+        shared().deallocate( object );
+      } else {
+        ::operator delete( object, std::align_val_t( slotAlignment ) );
+      }
+    }
+
+  private:
+    struct FreeSlot {
+      FreeSlot *next;
+    };
+
+    struct ThreadCache {
+      void *slots[ CACHE_SIZE ];
+      uint32_t count = 0;
+
+      // Hands the slots of an exiting thread back, shared() outlives it
+      ~ThreadCache() noexcept {
+        if ( count ) shared().release( slots, count );
+      }
+    };
+
+    PoolAllocator( std::size_t slotsPerChunk, bool threadCache ) noexcept
+        : m_slotsPerChunk( slotsPerChunk )
+        , m_threadCache( threadCache ) {}
+
+    static constexpr std::size_t defaultSlotsPerChunk() noexcept {
+      // About 64 KB per chunk, at least 16 objects
+      return std::max<std::size_t>( ( 64 * 1024 ) / slotSize, 16 );
+    }
+
+    static ThreadCache &threadCache() noexcept {
+      static thread_local ThreadCache cache;
+      return cache;
+    }
+
+    uint32_t acquire( void **slots, uint32_t count ) {
+      std::lock_guard<std::mutex> lock( m_mutex );
+      for ( uint32_t i = 0; i < count; i++ ) {
+        if ( !m_free ) grow();
+        slots[ i ] = m_free;
+        m_free = m_free->next;
+      }
+
+      m_stats.outstanding += count;
+      m_stats.peakOutstanding = std::max( m_stats.peakOutstanding, m_stats.outstanding );
+      m_stats.refills++;
+      return count;
+    }
+
+    void release( void *const *slots, uint32_t count ) noexcept {
+      std::lock_guard<std::mutex> lock( m_mutex );
+      for ( uint32_t i = 0; i < count; i++ ) {
+        auto *slot = ::new( slots[ i ] ) FreeSlot{m_free};
+        m_free = slot;
+      }
+      m_stats.outstanding -= count;
+    }
+
+    // Called with the lock held
+    void grow() {
+      auto *chunk = static_cast<unsigned char *>(
+          ::operator new( m_slotsPerChunk * slotSize, std::align_val_t( slotAlignment ) ) );
+      m_chunks.push_back( chunk );
+
+      // Thread the new slots so the first one is handed out first
+      for ( std::size_t i = m_slotsPerChunk; i-- > 0; ) {
+        m_free = ::new( chunk + i * slotSize ) FreeSlot{m_free};
+      }
+      m_stats.chunks++;
+      m_stats.capacity += m_slotsPerChunk;
+    }
+
+    const std::size_t m_slotsPerChunk;
+    const bool m_threadCache = false;
+
+    mutable std::mutex m_mutex;
+    FreeSlot *m_free = nullptr;
+    std::vector<void *> m_chunks;
+    PoolStats m_stats;
+  };
+
+  ///
+  /// STL allocator on top of PoolAllocator<T>::shared(), for
+  /// std::allocate_shared and node based containers. Single objects come
+  /// from the pool of their type, arrays from the heap.
+  ///
+  ///   auto mesh = std::allocate_shared<Mesh>( PoolStdAllocator<Mesh>(), path );
+  ///
+  template <typename T>
+  class PoolStdAllocator {
+  public:
+    using value_type = T;
+    using is_always_equal = std::true_type;
+
+    constexpr PoolStdAllocator() noexcept = default;
+
+    template <typename U>
+    constexpr PoolStdAllocator( const PoolStdAllocator<U> & ) noexcept {}
+
+    [[nodiscard]] T *allocate( std::size_t n ) {
+      if ( n == 1 ) {
+        return static_cast<T *>( PoolAllocator<T>::shared().allocate() );
+      }
+      return static_cast<T *>( ::operator new( n * sizeof( T ), std::align_val_t( alignof( T ) ) ) );
+    }
+
+    void deallocate( T *p, std::size_t n ) noexcept {
+      if ( n == 1 ) {
+        PoolAllocator<T>::shared().deallocate( p );
+      } else {
+        ::operator delete( p, std::align_val_t( alignof( T ) ) );
+      }
+    }
+  };
+
+  template <typename T, typename U>
+  constexpr bool operator==( const PoolStdAllocator<T> &, const PoolStdAllocator<U> & ) noexcept {
+    return true;
+  }
+
+  template <typename T, typename U>
+  constexpr bool operator!=( const PoolStdAllocator<T> &, const PoolStdAllocator<U> & ) noexcept {
+    return false;
+  }
+
+}    // namespace fn
+
+///
+/// Opts a class into the pool of its type, plain new / delete then take
+/// slots from PoolAllocator<Class>::shared():
+///
+///   class Texture : public Resource {
+///   public:
+///     FN_POOLED( Texture )
+///   };
+///
+/// Deleting through an Object pointer reaches the pool of the dynamic type,
+/// since Object has a virtual destructor.
+///
+#define FN_POOLED( Class )                                                                    \
+  static void *operator new( std::size_t size ) {                                             \
+    return fn::PoolAllocator<Class>::allocateObject( size );                                  \
+  }                                                                                           \
+  static void operator delete( void *object, std::size_t size ) noexcept {                    \
+    fn::PoolAllocator<Class>::deallocateObject( object, size );                               \
+  }
+
+#endif
@@ -0,0 +1,129 @@
+#if !defined( PROFILER_H )
+/* ========================================================================
+   $File: profiler.hh $
+   $Date: Sat Oct 17 2026 $
+   $Revision: $
+   $Creator: Ro Stelmach $
+   $Notice: (C) Copyright 2019 by Ro Orestis Stelmach. All Rights Reserved. $
+   ======================================================================== */
+
+#define PROFILER_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+
+namespace fn {
+
+  ///
+  /// Scoped CPU profiler, exported as a Chrome trace.
+  ///
+  ///   void VulkanBase::drawFrame( const FrameState &frame ) noexcept {
+  ///     FN_PROFILE_FUNCTION();
+  ///     ...
+  ///     {
+  ///       FN_PROFILE_SCOPE( "submit" );
+  ///       vkQueueSubmit( ... );
+  ///     }
+  ///   }
+  ///
+  ///   Profiler::start();
+  ///   ...
+  ///   Profiler::stop();
+  ///   Profiler::writeTrace( "fission_trace.json" );
+  ///
+  /// A scope records its name with a begin and an end timestamp when it
+  /// closes, into a ring buffer of the thread it ran on. Each thread is the
+  /// only writer of its buffer, so recording takes no lock. The buffer keeps
+  /// the last EVENTS_PER_THREAD scopes of a thread, older ones are dropped.
+  ///
+  /// Outside of a capture a scope costs one relaxed load. With the PROFILER
+  /// option off FN_PROFILE is not defined and the macros, FN_PROFILE_THREAD_NAME
+  /// included, compile to nothing.
+  ///
+  /// Traces open in chrome://tracing and ui.perfetto.dev. Names must be
+  /// string literals, or outlive the export.
+  ///
+  class Profiler {
+  public:
+    static constexpr std::size_t EVENTS_PER_THREAD = std::size_t( 1 ) << 15;
+
+    /// Starts recording. Events of an earlier capture are not exported.
+    static void start() noexcept;
+    static void stop() noexcept;
+
+    static bool isCapturing() noexcept {
+      return m_capturing.load( std::memory_order_relaxed );
+    }
+
+    /// Starts recording now and writes the trace to `path` after `frames`
+    /// calls to endFrame(). Called before Engine::run(), startup is
+    /// captured as well.
+    static void captureFrames( uint32_t frames, const std::string &path );
+
+    /// Once per frame, by the thread that runs the main loop.
+    static void endFrame() noexcept;
+
+    /// Writes the events of the current or last capture, on demand. Scopes
+    /// still open are not part of it.
+    static bool writeTrace( const std::string &path );
+    static void writeTrace( std::ostream &out );
+
+    /// Shows up as the name of the calling thread in the trace. Allocates no
+    /// event buffer, that waits for the first event of the thread.
+    static void setThreadName( const std::string &name );
+
+    /// Nanoseconds since the profiler started.
+    static uint64_t now() noexcept;
+
+    static void record( const char *name, uint64_t begin, uint64_t end ) noexcept;
+
+    /// A sample of the counter track `name` at the current time, recorded
+    /// during a capture only. GPU region times end up next to the scopes.
+    static void counter( const char *name, double value ) noexcept;
+
+  private:
+    static std::atomic<bool> m_capturing;
+  };
+
+  class ProfileScope {
+  public:
+    explicit ProfileScope( const char *name ) noexcept
+        : m_name( Profiler::isCapturing() ? name : nullptr )
+        , m_begin( m_name ? Profiler::now() : 0 ) {}
+
+    ~ProfileScope() noexcept {
+      if ( m_name ) Profiler::record( m_name, m_begin, Profiler::now() );
+    }
+
+    ProfileScope( const ProfileScope & ) = delete;
+    ProfileScope &operator=( const ProfileScope & ) = delete;
+
+  private:
+    const char *m_name;
+    uint64_t m_begin;
+  };
+
+}    // namespace fn
+
+#if defined( FN_PROFILE )
+#define FN_PROFILE_CONCAT_( a, b ) a##b
+#define FN_PROFILE_CONCAT( a, b ) FN_PROFILE_CONCAT_( a, b )
+#define FN_PROFILE_SCOPE( name ) fn::ProfileScope FN_PROFILE_CONCAT( fnProfileScope, __LINE__ )( name )
+#define FN_PROFILE_THREAD_NAME( name ) fn::Profiler::setThreadName( name )
+#if defined( __GNUC__ )
+#define FN_PROFILE_FUNCTION() FN_PROFILE_SCOPE( __PRETTY_FUNCTION__ )
+#elif defined( _MSC_VER )
+#define FN_PROFILE_FUNCTION() FN_PROFILE_SCOPE( __FUNCSIG__ )
+#else
+#define FN_PROFILE_FUNCTION() FN_PROFILE_SCOPE( __func__ )
+#endif
+#else
+#define FN_PROFILE_SCOPE( name ) static_cast<void>( 0 )
+#define FN_PROFILE_FUNCTION() static_cast<void>( 0 )
+#define FN_PROFILE_THREAD_NAME( name ) static_cast<void>( 0 )
+#endif
+
+#endif
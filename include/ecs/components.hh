@@ -0,0 +1,55 @@
+#if !defined( ECS_COMPONENTS_H )
+/* ========================================================================
+   $File: components.hh $
+   $Date: Fri Oct 16 2026 $
+   $Revision: $
+   $Creator: Ro Stelmach $
+   $Notice: (C) Copyright 2019 by Ro Orestis Stelmach. All Rights Reserved. $
+   ======================================================================== */
+
+#define ECS_COMPONENTS_H
+
+#include <cstdint>
+
+#include "math/affine.hh"
+#include "math/bounds.hh"
+#include "math/quaternion.hh"
+
+namespace fn {
+
+  namespace ecs {
+
+    /// Position, rotation and scale set by gameplay.
+    struct LocalTransform {
+      Vec3 position{0.0f};
+      Quat rotation;
+      Vec3 scale{1.0f};
+    };
+
+    /// Model matrix derived from the LocalTransform by updateTransforms().
+    struct WorldTransform {
+      Affine3 matrix;
+    };
+
+    /// Bounds in model space.
+    struct LocalBounds {
+      AABB box;
+    };
+
+    /// Bounds in world space, derived by updateBounds(). Same layout as an
+    /// AABB so a chunk of them culls with Math::cullBoxes().
+    struct WorldBounds {
+      AABB box;
+    };
+
+    /// What the renderer draws for the entity.
+    struct Renderable {
+      uint32_t mesh = 0;
+      uint32_t material = 0;
+    };
+
+  }    // namespace ecs
+
+}    // namespace fn
+
+#endif
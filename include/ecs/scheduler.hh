@@ -0,0 +1,77 @@
+#if !defined( ECS_SCHEDULER_H )
+/* ========================================================================
+   $File: scheduler.hh $
+   $Date: Fri Oct 16 2026 $
+   $Revision: $
+   $Creator: Ro Stelmach $
+   $Notice: (C) Copyright 2019 by Ro Orestis Stelmach. All Rights Reserved. $
+   ======================================================================== */
+
+#define ECS_SCHEDULER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "core/job_system.hh"
+#include "ecs/world.hh"
+
+namespace fn {
+
+  namespace ecs {
+
+    ///
+    /// Runs systems over a world, in parallel where their components allow.
+    ///
+    /// Every system declares the components it reads and writes. A system
+    /// goes into the first phase after the last earlier system it conflicts
+    /// with, one writing what the other reads or writes. Systems of a phase
+    /// run as jobs at the same time, phases run one after the other, so
+    /// conflicting systems still see each other in the order they were added.
+    ///
+    ///   systems.add( "transforms", componentMask<LocalTransform>(), componentMask<WorldTransform>(),
+    ///                updateTransforms );
+    ///   systems.run( world, jobs );
+    ///
+    /// Systems may use the job system themselves, parallelEach() included.
+    ///
+    class SystemScheduler {
+    public:
+      using Function = std::function<void( World &, JobSystem & )>;
+
+      void add( const char *name, ComponentMask reads, ComponentMask writes, Function function );
+
+      void run( World &world, JobSystem &jobs );
+
+      std::size_t systemCount() const noexcept {
+        return m_systems.size();
+      }
+
+      std::size_t phaseCount() const noexcept {
+        return m_phases.size();
+      }
+
+      /// Phase a system was put in, by the order it was added.
+      uint32_t phaseOf( std::size_t system ) const noexcept {
+        return m_systems[ system ].phase;
+      }
+
+    private:
+      struct System {
+        const char *name;
+        ComponentMask reads;
+        ComponentMask writes;
+        Function function;
+        uint32_t phase;
+      };
+
+      std::vector<System> m_systems;
+      std::vector<std::vector<uint32_t>> m_phases;
+    };
+
+  }    // namespace ecs
+
+}    // namespace fn
+
+#endif
@@ -0,0 +1,47 @@
+#if !defined( ECS_SYSTEMS_H )
+/* ========================================================================
+   $File: systems.hh $
+   $Date: Fri Oct 16 2026 $
+   $Revision: $
+   $Creator: Ro Stelmach $
+   $Notice: (C) Copyright 2019 by Ro Orestis Stelmach. All Rights Reserved. $
+   ======================================================================== */
+
+#define ECS_SYSTEMS_H
+
+#include <cstddef>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "core/job_system.hh"
+#include "ecs/components.hh"
+#include "ecs/scheduler.hh"
+#include "ecs/world.hh"
+
+namespace fn {
+
+  namespace ecs {
+
+    /// WorldTransform from LocalTransform, one job per chunk.
+    void updateTransforms( World &world, JobSystem &jobs );
+
+    /// WorldBounds from LocalBounds and WorldTransform, one job per chunk.
+    void updateBounds( World &world, JobSystem &jobs );
+
+    /// Registers updateTransforms() and updateBounds(), in that order.
+    void addTransformSystems( SystemScheduler &systems );
+
+    ///
+    /// Replaces `transforms` with the model matrices of every Renderable.
+    /// With a frustum, entities that have WorldBounds outside of it are
+    /// skipped, entities without bounds are always kept. Returns how many
+    /// were culled.
+    ///
+    std::size_t gatherRenderables( World &world, const Frustum *frustum, std::vector<glm::mat4> &transforms );
+
+  }    // namespace ecs
+
+}    // namespace fn
+
+#endif
@@ -0,0 +1,362 @@
+#if !defined( ECS_WORLD_H )
+/* ========================================================================
+   $File: world.hh $
+   $Date: Fri Oct 16 2026 $
+   $Revision: $
+   $Creator: Ro Stelmach $
+   $Notice: (C) Copyright 2019 by Ro Orestis Stelmach. All Rights Reserved. $
+   ======================================================================== */
+
+#define ECS_WORLD_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "core/job_system.hh"
+#include "core/logger.hh"
+
+namespace fn {
+
+  namespace ecs {
+
+    constexpr uint32_t MAX_COMPONENTS = 64;
+
+    /// One bit per component type, the bits of an archetype or a query.
+    using ComponentMask = uint64_t;
+
+    ///
+    /// Handle of an entity. The index is reused after destroy(), the
+    /// generation tells a stale handle from the entity that took its place.
+    ///
+    struct Entity {
+      static constexpr uint32_t INVALID = ~0u;
+
+      uint32_t index = INVALID;
+      uint32_t generation = 0;
+
+      bool isValid() const noexcept {
+        return index != INVALID;
+      }
+
+      friend bool operator==( Entity a, Entity b ) noexcept {
+        return a.index == b.index && a.generation == b.generation;
+      }
+
+      friend bool operator!=( Entity a, Entity b ) noexcept {
+        return !( a == b );
+      }
+    };
+
+    /// How the world moves and destroys a component it only knows by id.
+    struct ComponentInfo {
+      std::size_t size;
+      std::size_t alignment;
+
+      // Moves src into the uninitialized dst and destroys src
+      void ( *relocate )( void *dst, void *src ) noexcept;
+      void ( *destroy )( void *object ) noexcept;
+    };
+
+    namespace detail {
+
+      uint32_t registerComponent( const ComponentInfo &info ) noexcept;
+
+      template <typename T>
+      ComponentInfo componentInfoOf() noexcept {
+        // Relocation happens under noexcept, a throwing move terminates
+        static_assert( std::is_move_constructible_v<T> && std::is_nothrow_destructible_v<T>,
+                       "components are relocated between chunks" );
+        return {sizeof( T ), alignof( T ),
+                []( void *dst, void *src ) noexcept {
+                  T *from = static_cast<T *>( src );
+                  ::new( dst ) T( std::move( *from ) );
+                  from->~T();
+                },
+                []( void *object ) noexcept { static_cast<T *>( object )->~T(); }};
+      }
+
+    }    // namespace detail
+
+    /// Id of a component type, assigned on first use, const ignored.
+    template <typename T>
+    uint32_t componentId() noexcept {
+      if constexpr ( std::is_const_v<T> ) {
+        return componentId<std::remove_const_t<T>>();
+      } else {
+        static const uint32_t id = detail::registerComponent( detail::componentInfoOf<T>() );
+        return id;
+      }
+    }
+
+    template <typename... C>
+    ComponentMask componentMask() noexcept {
+      return ( ComponentMask( 0 ) | ... | ( ComponentMask( 1 ) << componentId<C>() ) );
+    }
+
+    const ComponentInfo &componentInfo( uint32_t id ) noexcept;
+
+    ///
+    /// Entities with exactly the same set of components.
+    ///
+    /// Rows live in chunks of about 16 KB. Inside a chunk every component is
+    /// an array of its own ( SoA ), after the array of entity handles, so a
+    /// query walks each array linearly. Removing a row moves the last row of
+    /// the archetype into the hole, every chunk but the last one stays full.
+    ///
+    struct Archetype {
+      static constexpr std::size_t CHUNK_BYTES = 16 * 1024;
+      static constexpr std::size_t CHUNK_ALIGNMENT = 64;
+
+      struct Chunk {
+        unsigned char *data;
+        uint32_t count;
+      };
+
+      ComponentMask mask = 0;
+
+      // Sorted ids, and for each its column: byte offset in a chunk and size
+      std::vector<uint32_t> components;
+      std::vector<std::size_t> offsets;
+      std::vector<std::size_t> sizes;
+
+      // Column of a component id, -1 when the archetype does not have it
+      std::array<int8_t, MAX_COMPONENTS> columns;
+
+      uint32_t capacity = 0;
+      std::size_t chunkBytes = 0;
+      std::vector<Chunk> chunks;
+      uint32_t size = 0;
+
+      Entity *entities( const Chunk &chunk ) const noexcept {
+        return reinterpret_cast<Entity *>( chunk.data );
+      }
+
+      void *component( uint32_t column, uint32_t row ) const noexcept {
+        const Chunk &chunk = chunks[ row / capacity ];
+        return chunk.data + offsets[ column ] + ( row % capacity ) * sizes[ column ];
+      }
+    };
+
+    ///
+    /// One chunk as a query sees it, arrays of count() rows.
+    ///
+    class ChunkView {
+    public:
+      ChunkView( const Archetype &archetype, const Archetype::Chunk &chunk ) noexcept
+          : m_archetype( &archetype )
+          , m_data( chunk.data )
+          , m_count( chunk.count ) {}
+
+      uint32_t count() const noexcept {
+        return m_count;
+      }
+
+      const Entity *entities() const noexcept {
+        return reinterpret_cast<const Entity *>( m_data );
+      }
+
+      /// The array of component T, nullptr when the chunk does not have it.
+      template <typename T>
+      T *column() const noexcept {
+        const int8_t column = m_archetype->columns[ componentId<T>() ];
+        if ( column < 0 ) return nullptr;
+        return reinterpret_cast<T *>( m_data + m_archetype->offsets[ static_cast<std::size_t>( column ) ] );
+      }
+
+      template <typename T>
+      bool has() const noexcept {
+        return m_archetype->columns[ componentId<T>() ] >= 0;
+      }
+
+    private:
+      const Archetype *m_archetype;
+      unsigned char *m_data;
+      uint32_t m_count;
+    };
+
+    ///
+    /// Entities, their components, and queries over them.
+    ///
+    ///   World world;
+    ///   Entity e = world.create( LocalTransform{}, WorldTransform{}, Renderable{} );
+    ///   world.each<const LocalTransform, WorldTransform>( []( const LocalTransform &l, WorldTransform &w ) {
+    ///     w.matrix = Affine3::fromTRS( l.position, l.rotation, l.scale );
+    ///   } );
+    ///
+    /// A query visits every archetype that has all the listed components,
+    /// chunk by chunk. Bodies may take the Entity as first argument. The
+    /// matching archetypes of a query are cached and kept up to date as new
+    /// archetypes appear.
+    ///
+    /// Creating, destroying, adding or removing components is not allowed
+    /// while a query runs. Queries may run concurrently, from systems of one
+    /// phase, and parallelEach() visits each chunk from one job.
+    ///
+    class World {
+    public:
+      World() noexcept;
+      ~World() noexcept;
+
+      World( const World & ) = delete;
+      World &operator=( const World & ) = delete;
+
+      Entity create();
+
+      template <typename... C>
+      Entity create( C &&... components ) {
+        Entity entity = create();
+        moveEntity( entity, archetypeFor( componentMask<std::decay_t<C>...>() ) );
+        const Record &record = m_records[ entity.index ];
+        ( construct<std::decay_t<C>>( *record.archetype, record.row, std::forward<C>( components ) ), ... );
+        return entity;
+      }
+
+      void destroy( Entity entity ) noexcept;
+
+      bool isAlive( Entity entity ) const noexcept {
+        return entity.index < m_records.size() && m_records[ entity.index ].generation == entity.generation &&
+               m_records[ entity.index ].archetype;
+      }
+
+      /// Adds T, or assigns it when the entity has one already. The entity
+      /// must be alive, there is nothing to add to otherwise.
+      template <typename T>
+      T &add( Entity entity, T value ) {
+        if ( !isAlive( entity ) ) {
+          log::fatal( "Component added to a dead or invalid entity %u\n", entity.index );
+        }
+        if ( T *existing = get<T>( entity ) ) {
+          *existing = std::move( value );
+          return *existing;
+        }
+
+        const Record &record = m_records[ entity.index ];
+        moveEntity( entity, archetypeFor( record.archetype->mask | componentMask<T>() ) );
+        return construct<T>( *record.archetype, record.row, std::move( value ) );
+      }
+
+      template <typename T>
+      void remove( Entity entity ) {
+        if ( !has<T>( entity ) ) return;
+        moveEntity( entity, archetypeFor( m_records[ entity.index ].archetype->mask & ~componentMask<T>() ) );
+      }
+
+      template <typename T>
+      T *get( Entity entity ) noexcept {
+        if ( !isAlive( entity ) ) return nullptr;
+        const Record &record = m_records[ entity.index ];
+        const int8_t column = record.archetype->columns[ componentId<T>() ];
+        if ( column < 0 ) return nullptr;
+        return static_cast<T *>( record.archetype->component( static_cast<uint32_t>( column ), record.row ) );
+      }
+
+      template <typename T>
+      const T *get( Entity entity ) const noexcept {
+        return const_cast<World *>( this )->get<const T>( entity );
+      }
+
+      template <typename T>
+      bool has( Entity entity ) const noexcept {
+        return isAlive( entity ) && m_records[ entity.index ].archetype->columns[ componentId<T>() ] >= 0;
+      }
+
+      std::size_t entityCount() const noexcept {
+        return m_records.size() - m_freeIndices.size();
+      }
+
+      std::size_t archetypeCount() const noexcept {
+        return m_archetypes.size();
+      }
+
+      /// Calls body( ChunkView ) for every chunk with all of C.
+      template <typename... C, typename F>
+      void eachChunk( F &&body ) {
+        for ( Archetype *archetype : matching( componentMask<C...>() ) ) {
+          for ( const Archetype::Chunk &chunk : archetype->chunks ) {
+            body( ChunkView( *archetype, chunk ) );
+          }
+        }
+      }
+
+      /// Calls body( [ Entity, ] C &... ) for every entity with all of C.
+      template <typename... C, typename F>
+      void each( F &&body ) {
+        eachChunk<C...>( [&body]( const ChunkView &chunk ) {
+          eachRow( body, chunk.count(), chunk.entities(), chunk.column<C>()... );
+        } );
+      }
+
+      /// each() with one job per chunk, returns when every chunk is done.
+      /// body runs concurrently and must only touch its own entity.
+      template <typename... C, typename F>
+      void parallelEach( JobSystem &jobs, const F &body ) {
+        std::vector<ChunkView> chunks;
+        eachChunk<C...>( [&chunks]( const ChunkView &chunk ) { chunks.push_back( chunk ); } );
+
+        const ChunkView *list = chunks.data();
+        const F *function = &body;
+        jobs.parallelFor( chunks.size(), 1, [list, function]( std::size_t i ) {
+          const ChunkView &chunk = list[ i ];
+          eachRow( *function, chunk.count(), chunk.entities(), chunk.column<C>()... );
+        } );
+      }
+
+    private:
+      struct Record {
+        Archetype *archetype;
+        uint32_t row;
+        uint32_t generation;
+      };
+
+      template <typename F, typename... C>
+      static void eachRow( F &body, uint32_t count, const Entity *entities, C *... columns ) {
+        for ( uint32_t i = 0; i < count; i++ ) {
+          if constexpr ( std::is_invocable_v<F &, Entity, C &...> ) {
+            body( entities[ i ], columns[ i ]... );
+          } else {
+            body( columns[ i ]... );
+          }
+        }
+      }
+
+      template <typename T, typename V>
+      static T &construct( Archetype &archetype, uint32_t row, V &&value ) {
+        const auto column = static_cast<uint32_t>( archetype.columns[ componentId<T>() ] );
+        return *::new( archetype.component( column, row ) ) T( std::forward<V>( value ) );
+      }
+
+      Archetype &archetypeFor( ComponentMask mask );
+      const std::vector<Archetype *> &matching( ComponentMask mask );
+
+      // Moves the entity to another archetype, relocating the components
+      // both have and destroying the others. New components are left
+      // uninitialized for the caller to construct.
+      void moveEntity( Entity entity, Archetype &to );
+
+      uint32_t allocateRow( Archetype &archetype, Entity entity );
+      void removeRow( Archetype &archetype, uint32_t row ) noexcept;
+
+      std::vector<Record> m_records;
+      std::vector<uint32_t> m_freeIndices;
+
+      std::vector<std::unique_ptr<Archetype>> m_archetypes;
+      std::unordered_map<ComponentMask, Archetype *> m_archetypesByMask;
+
+      // Archetypes matching each query mask seen so far
+      std::mutex m_queryMutex;
+      std::unordered_map<ComponentMask, std::vector<Archetype *>> m_queries;
+    };
+
+  }    // namespace ecs
+
+}    // namespace fn
+
+#endif
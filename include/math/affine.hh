@@ -0,0 +1,141 @@
+/* =======================================================================
+   $File: affine.hh
+   $Date: 16/10/2026
+   $Revision:
+   $Creator: Rostislav Orestis Stelmach
+   $Notice:  This file is a part of Thesis project ( stracer ) for
+   the Technical Educational Institute of Western Macedonia
+   Supervisor: Dr. George Sisias
+   ======================================================================== */
+
+#ifndef PROJECT_AFFINE_HPP
+#define PROJECT_AFFINE_HPP
+
+//Engine Internal
+#include "math/matrix.hh"
+#include "math/quaternion.hh"
+
+//OpenGL Includes
+#include <glm/glm.hpp>
+
+namespace fn {
+
+  //
+  // Affine transform stored as the top three rows of a 4x4 matrix, the last
+  // row is always ( 0, 0, 0, 1 ). Each row is ( linear part | translation ).
+  //
+  // 48 bytes instead of 64, and rows are plain vec4s so the type uploads as
+  // is into a std140 / std430 `vec4[3]`. Composition takes 36 multiplies,
+  // rigidInverse() is a transpose plus translation fix-up.
+  //
+
+  class alignas(16) Affine3 {
+
+    typedef Vec4 row_major;
+
+  private:
+    row_major m[3];
+  public:
+
+    /* Constructors */
+
+    constexpr Affine3()
+      : m{ row_major(1, 0, 0, 0),
+           row_major(0, 1, 0, 0),
+           row_major(0, 0, 1, 0) } { }
+
+    constexpr Affine3(const row_major& r0, const row_major& r1, const row_major& r2)
+      : m{ r0, r1, r2 } { }
+
+    // Drops the last row of a, which must be ( 0, 0, 0, 1 )
+    constexpr explicit Affine3(const Matrix4& a)
+      : m{ row_major(a[0][0], a[1][0], a[2][0], a[3][0]),
+           row_major(a[0][1], a[1][1], a[2][1], a[3][1]),
+           row_major(a[0][2], a[1][2], a[2][2], a[3][2]) } { }
+
+    explicit Affine3(const glm::mat4& a);
+
+    static constexpr Affine3 fromTranslation(const Vec3& t) {
+      return Affine3(row_major(1, 0, 0, t.x), row_major(0, 1, 0, t.y), row_major(0, 0, 1, t.z));
+    }
+
+    static constexpr Affine3 fromScale(const Vec3& s) {
+      return Affine3(row_major(s.x, 0, 0, 0), row_major(0, s.y, 0, 0), row_major(0, 0, s.z, 0));
+    }
+
+    static Affine3 fromRotation(const Quat& q);
+
+    // Translation * rotation * scale
+    static Affine3 fromTRS(const Vec3& t, const Quat& r, const Vec3& s);
+
+    constexpr row_major& operator [](size_t index) {
+      assert(index < 3);
+      return this->m[index];
+    }
+
+    constexpr row_major const& operator [](size_t index) const {
+      assert(index < 3);
+      return this->m[index];
+    }
+
+    /* Contiguous row major access, 12 floats */
+
+    float* data() noexcept { return &m[0].x; }
+    const float* data() const noexcept { return &m[0].x; }
+
+    constexpr Vec3 translation() const { return Vec3(m[0].w, m[1].w, m[2].w); }
+
+    constexpr void setTranslation(const Vec3& t) {
+      m[0].w = t.x;
+      m[1].w = t.y;
+      m[2].w = t.z;
+    }
+
+    constexpr Matrix4 toMatrix() const {
+      return Matrix4(
+        m[0].x, m[1].x, m[2].x, 0.0f,
+        m[0].y, m[1].y, m[2].y, 0.0f,
+        m[0].z, m[1].z, m[2].z, 0.0f,
+        m[0].w, m[1].w, m[2].w, 1.0f
+        );
+    }
+
+    explicit operator glm::mat4() const;
+
+    Affine3& operator *=(const Affine3& rhs);
+
+    friend Affine3 operator *(const Affine3& lhs, const Affine3& rhs);
+
+    friend constexpr bool operator ==(const Affine3& lhs, const Affine3& rhs);
+    friend constexpr bool operator !=(const Affine3& lhs, const Affine3& rhs);
+
+    float determinant() const;
+
+    // General inverse, the transform is left untouched when it is singular
+    void inverse();
+    Affine3 inversed() const;
+
+    // Inverse of a rotation + translation, the linear part must be orthonormal
+    void rigidInverse();
+    Affine3 rigidInversed() const;
+
+    Vec3 transformPoint(const Vec3& p) const;
+    Vec3 transformVector(const Vec3& v) const;
+  };
+
+  Affine3 operator *(const Affine3& lhs, const Affine3& rhs);
+
+  constexpr bool operator ==(const Affine3& lhs, const Affine3& rhs) {
+
+    return (lhs.m[0] == rhs.m[0]) && (lhs.m[1] == rhs.m[1]) && (lhs.m[2] == rhs.m[2]);
+  }
+
+  constexpr bool operator !=(const Affine3& lhs, const Affine3& rhs) {
+
+    return !(lhs == rhs);
+  }
+
+  static_assert(sizeof(Affine3) == 48, "Affine3 must pack into three vec4 for upload");
+}
+
+#endif //PROJECT_AFFINE_HPP
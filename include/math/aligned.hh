@@ -0,0 +1,68 @@
+/* =======================================================================
+   $File: aligned.hh
+   $Date: 16/10/2026
+   $Revision:
+   $Creator: Rostislav Orestis Stelmach
+   $Notice:  This file is a part of Thesis project ( stracer ) for
+   the Technical Educational Institute of Western Macedonia
+   Supervisor: Dr. George Sisias
+   ======================================================================== */
+
+#ifndef PROJECT_ALIGNED_HPP
+#define PROJECT_ALIGNED_HPP
+
+//Engine Internal
+#include "math/matrix.hh"
+#include "math/simd.hh"
+#include "core/aligned_allocator.hh"
+
+//C++ Includes
+#include <cstddef>
+
+namespace fn {
+
+  //
+  // Over-aligned math types.
+  //
+  // Aligned<T, N> is T with its alignment raised to N bytes. Size and member
+  // layout are unchanged ( checked below ), so it converts to and from T for
+  // free, it can be passed anywhere a T is expected and it is still what the
+  // shaders read. Use it for arrays the SIMD kernels stream over, together
+  // with AlignedAllocator when they live in STL containers:
+  //
+  //   AlignedVector<Matrix4A> transforms( count );
+  //
+  // Vec4 and Matrix4 arrays are plain 16 byte multiples, so a 16 or 32 byte
+  // aligned start keeps every element on a register boundary.
+  //
+
+  template <typename T, size_t Alignment>
+  struct alignas(Alignment) Aligned : T {
+    static_assert(Alignment >= alignof(T), "Aligned<T, N> cannot lower the alignment of T");
+
+    using T::T;
+    constexpr Aligned() = default;
+    constexpr Aligned(const T& value) : T(value) { }
+
+    constexpr T& base() noexcept { return *this; }
+    constexpr const T& base() const noexcept { return *this; }
+  };
+
+  using Vec4A     = Aligned<Vec4, 16>;
+  using Matrix4A  = Aligned<Matrix4, simd::ALIGNMENT>;
+
+  // Cache line aligned, one matrix per line for arrays written by several threads
+  using Matrix4CL = Aligned<Matrix4, 64>;
+
+  static_assert(sizeof(Vec4) == 16 && alignof(Vec4A) == 16 && sizeof(Vec4A) == 16,
+                "Vec4A must keep the 16 byte vec4 layout");
+  static_assert(sizeof(Matrix4) == 64 && alignof(Matrix4) == 16,
+                "Matrix4 must keep the 64 byte, 16 byte aligned mat4 layout");
+  static_assert(sizeof(Matrix4A) == 64 && alignof(Matrix4A) == simd::ALIGNMENT,
+                "Matrix4A must keep the mat4 layout");
+  static_assert(sizeof(Matrix4CL) == 64, "Matrix4CL must keep the mat4 layout");
+  static_assert(sizeof(Vec4) == sizeof(glm::vec4) && sizeof(Matrix4) == sizeof(glm::mat4),
+                "fn and glm types must have the same size");
+}
+
+#endif //PROJECT_ALIGNED_HPP
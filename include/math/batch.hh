@@ -0,0 +1,120 @@
+/* =======================================================================
+   $File: batch.hh
+   $Date: 16/10/2026
+   $Revision:
+   $Creator: Rostislav Orestis Stelmach
+   $Notice:  This file is a part of Thesis project ( stracer ) for
+   the Technical Educational Institute of Western Macedonia
+   Supervisor: Dr. George Sisias
+   ======================================================================== */
+
+#ifndef PROJECT_BATCH_HPP
+#define PROJECT_BATCH_HPP
+
+//Engine Internal
+#include "math/matrix.hh"
+#include "math/quaternion.hh"
+#include "math/bounds.hh"
+
+//C++ Includes
+#include <cstddef>
+#include <cstdint>
+
+namespace fn {
+
+  namespace Math {
+
+    //
+    // Batch operations on structure-of-arrays streams.
+    //
+    // A stream is three separate float arrays holding the x, y and z
+    // components of `count` vectors. The loops run 8 lanes at a time with
+    // AVX2, 4 with SSE4.1 and finish the tail with scalar code, so no
+    // padding or alignment is required. Output streams may alias the inputs.
+    // Streams in AlignedVector<float, simd::ALIGNMENT> ( math/aligned.hh )
+    // never split a load across cache lines.
+    //
+
+    struct Vec3Stream {
+      float* x;
+      float* y;
+      float* z;
+    };
+
+    struct ConstVec3Stream {
+      ConstVec3Stream(const float* xs, const float* ys, const float* zs)
+        : x(xs), y(ys), z(zs) { }
+      ConstVec3Stream(const Vec3Stream& s)
+        : x(s.x), y(s.y), z(s.z) { }
+
+      const float* x;
+      const float* y;
+      const float* z;
+    };
+
+    // out[i] = m * ( in[i], 1 ), without the perspective divide
+    void transformPoints(const Matrix4& m, ConstVec3Stream in, Vec3Stream out, size_t count) noexcept;
+
+    // out[i] = m * ( in[i], 0 )
+    void transformVectors(const Matrix4& m, ConstVec3Stream in, Vec3Stream out, size_t count) noexcept;
+
+    // out[i] = lhs[i] * rhs[i]
+    void multiply(const Matrix4* lhs, const Matrix4* rhs, Matrix4* out, size_t count) noexcept;
+
+    // out[i] = dot( a[i], b[i] )
+    void dot(ConstVec3Stream a, ConstVec3Stream b, float* out, size_t count) noexcept;
+
+    // out[i] = cross( a[i], b[i] )
+    void cross(ConstVec3Stream a, ConstVec3Stream b, Vec3Stream out, size_t count) noexcept;
+
+    // Normalizes every vector in place, zero length vectors are left as they are.
+    // Uses fastRsqrt when the build default is Precision::Fast ( math_utils.hh ).
+    void normalize(Vec3Stream v, size_t count) noexcept;
+
+    //
+    // Array versions of the fast approximations in math_utils.hh, with the
+    // same error bounds. The scalar tail gives exactly Math::fastSinCos etc.,
+    // the SIMD lanes agree with it within rounding. Outputs may alias inputs.
+    //
+    void sinCosBatch(const float* x, float* s, float* c, size_t count) noexcept;
+    void atan2Batch(const float* y, const float* x, float* out, size_t count) noexcept;
+    void acosBatch(const float* x, float* out, size_t count) noexcept;
+    void rsqrtBatch(const float* x, float* out, size_t count) noexcept;
+
+    //
+    // Inverts `count` matrices, four or eight at a time with one matrix per
+    // SIMD lane. Singular matrices are copied to `out` unchanged, like
+    // Matrix4::inverse(), and flagged in `singular` when it is given.
+    // Returns the number of singular matrices.
+    //
+    size_t inverseBatch(const Matrix4* in, Matrix4* out, size_t count,
+                        bool* singular = nullptr) noexcept;
+
+    // Fast path of inverseBatch for affine matrices ( rotation / scale block
+    // plus translation ). The last row is assumed to be ( 0, 0, 0, 1 ), only
+    // the 3x3 block is inverted and the translation is rotated back.
+    size_t inverseAffineBatch(const Matrix4* in, Matrix4* out, size_t count,
+                              bool* singular = nullptr) noexcept;
+
+    //
+    // out[i] = nlerp / slerp( a[i], b[i], t[i] ), shortest arc, inputs must be
+    // normalized. slerpBatch evaluates sin( t theta ) / sin( theta ) with a
+    // polynomial instead of trig and stays within 1e-5 of Math::slerp.
+    //
+    void nlerpBatch(const Quat* a, const Quat* b, const float* t, Quat* out, size_t count) noexcept;
+    void slerpBatch(const Quat* a, const Quat* b, const float* t, Quat* out, size_t count) noexcept;
+
+    //
+    // Frustum culling with one volume per lane. Indices of the visible volumes
+    // are written in increasing order to `visible`, which must have room for
+    // `count` entries. Returns the number of visible volumes. The tests are
+    // the ones of Frustum::isVisible().
+    //
+    size_t cullBoxes(const Frustum& frustum, const AABB* boxes, size_t count,
+                     uint32_t* visible) noexcept;
+    size_t cullSpheres(const Frustum& frustum, const Sphere* spheres, size_t count,
+                       uint32_t* visible) noexcept;
+  }
+}
+
+#endif //PROJECT_BATCH_HPP
@@ -0,0 +1,84 @@
+/* =======================================================================
+   $File: bounds.hh
+   $Date: 16/10/2026
+   $Revision:
+   $Creator: Rostislav Orestis Stelmach
+   $Notice:  This file is a part of Thesis project ( stracer ) for
+   the Technical Educational Institute of Western Macedonia
+   Supervisor: Dr. George Sisias
+   ======================================================================== */
+
+#ifndef PROJECT_BOUNDS_HPP
+#define PROJECT_BOUNDS_HPP
+
+//Engine Internal
+#include "math/matrix.hh"
+
+//OpenGL Includes
+#include <glm/glm.hpp>
+
+namespace fn {
+
+  // Axis aligned bounding box, 24 bytes so arrays of them stay tightly packed
+  struct AABB {
+
+    constexpr AABB()
+      : min(0.0f), max(0.0f) { }
+    constexpr AABB(const Vec3& t_min, const Vec3& t_max)
+      : min(t_min), max(t_max) { }
+
+    constexpr Vec3 center() const { return (min + max) * 0.5f; }
+    constexpr Vec3 extents() const { return (max - min) * 0.5f; }
+
+    Vec3 min;
+    Vec3 max;
+  };
+
+  struct alignas(16) Sphere {
+
+    constexpr Sphere()
+      : center(0.0f), radius(0.0f) { }
+    constexpr Sphere(const Vec3& t_center, float t_radius)
+      : center(t_center), radius(t_radius) { }
+
+    Vec3 center;
+    float radius;
+  };
+
+  // Depth range of the clip space the view-projection matrix maps into
+  enum class ClipDepth {
+    NegativeOneToOne,   // OpenGL, Math::ortho
+    ZeroToOne           // Vulkan, GLM_FORCE_DEPTH_ZERO_TO_ONE
+  };
+
+  //
+  // Six normalized planes ( n, d ), a point p is inside when dot( n, p ) + d >= 0.
+  // Planes are extracted from a view-projection matrix ( Gribb / Hartmann ), so the
+  // frustum lives in whatever space the matrix maps from, usually world space.
+  //
+  // Tests are conservative: a box that straddles two planes near a corner may
+  // be reported visible while being outside, never the other way around.
+  //
+
+  class Frustum {
+  public:
+
+    enum Side { Left = 0, Right, Bottom, Top, Near, Far, COUNT };
+
+    explicit Frustum(const Matrix4& viewProjection, ClipDepth depth = ClipDepth::NegativeOneToOne);
+    explicit Frustum(const glm::mat4& viewProjection, ClipDepth depth = ClipDepth::NegativeOneToOne);
+
+    const Vec4& plane(Side side) const { return planes[side]; }
+
+    bool isVisible(const Vec3& point) const;
+    bool isVisible(const AABB& box) const;
+    bool isVisible(const Sphere& sphere) const;
+
+  private:
+    Vec4 planes[COUNT];
+  };
+
+  // Batched culling of arrays lives in math/batch.hh
+}
+
+#endif //PROJECT_BOUNDS_HPP
@@ -0,0 +1,341 @@
+/* =======================================================================
+   $File: def_matrix.hh
+   $Date: 16/10/2026
+   $Revision:
+   $Creator: Rostislav Orestis Stelmach
+   $Notice:  This file is a part of Thesis project ( stracer ) for
+   the Technical Educational Institute of Western Macedonia
+   Supervisor: Dr. George Sisias
+   ======================================================================== */
+
+#ifndef PROJECT_DEF_MATRIX_HPP
+#define PROJECT_DEF_MATRIX_HPP
+
+//Engine Internal
+#include "math/matrix.hh"
+#include "math/affine.hh"
+
+//C++ Includes
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+namespace fn {
+
+  //
+  // R x C matrices of T, column major like Matrix4 and glm.
+  //
+  // The C columns are tVec2 / tVec3 / tVec4 of T with nothing in between, so a
+  // Matrix3 is 9 floats and a Matrix3x4 12. Everything is constexpr and
+  // unrolled by the compiler. Matrix4 stays its own class for the SIMD
+  // kernels: tMat<4, 4, float> has the same bytes and converts with a copy,
+  // Matrix3x4 converts to Affine3 to use its kernels, and every size widens
+  // to and narrows from Matrix4.
+  //
+  // For upload, pack<Layout>() writes the columns with the std140 / std430
+  // column stride and packRows<Layout>() writes the transpose, which is what
+  // makes a Matrix3x4 model transform 48 bytes on the GPU instead of 64:
+  //
+  //   layout(std140) uniform Object { mat3x4 model; };   // rows of Matrix3x4
+  //   vec3 world = vec4(position, 1.0) * model;
+  //
+
+  enum class GpuLayout {
+    Std140,
+    Std430
+  };
+
+  template <size_t N, typename T> struct VecN;
+  template <typename T> struct VecN<2, T> { using type = tVec2<T>; };
+  template <typename T> struct VecN<3, T> { using type = tVec3<T>; };
+  template <typename T> struct VecN<4, T> { using type = tVec4<T>; };
+
+  template <size_t R, size_t C, typename T = float>
+  class tMat {
+    static_assert(R >= 2 && R <= 4 && C >= 2 && C <= 4, "tMat supports 2 to 4 rows and columns");
+
+  public:
+    using value_type = T;
+    using col_type   = typename VecN<R, T>::type;
+    using row_type   = typename VecN<C, T>::type;
+
+    static constexpr size_t rows = R;
+    static constexpr size_t cols = C;
+
+    /* Constructors */
+
+    // Identity, or its top left block for non square matrices
+    constexpr tMat() : tMat(static_cast<T>(1)) { }
+
+    constexpr explicit tMat(T diagonal) : m{} {
+      for ( size_t c = 0; c < C; c++ ) {
+        for ( size_t r = 0; r < R; r++ ) {
+          m[c][static_cast<unsigned>(r)] = r == c ? diagonal : static_cast<T>(0);
+        }
+      }
+    }
+
+    template <typename... V,
+              std::enable_if_t<sizeof...(V) == C && (std::is_same_v<V, col_type> && ...), int> = 0>
+    constexpr tMat(const V&... columns) : m{ columns... } { }
+
+    // R * C values, column after column
+    template <typename... S,
+              std::enable_if_t<sizeof...(S) == R * C && (std::is_arithmetic_v<S> && ...), int> = 0>
+    constexpr tMat(S... values) : m{} {
+      const T v[] = { static_cast<T>(values)... };
+      for ( size_t i = 0; i < R * C; i++ ) {
+        m[i / R][static_cast<unsigned>(i % R)] = v[i];
+      }
+    }
+
+    // Top left R x C block of a
+    constexpr explicit tMat(const Matrix4& a) : m{} {
+      for ( size_t c = 0; c < C; c++ ) {
+        for ( size_t r = 0; r < R; r++ ) {
+          m[c][static_cast<unsigned>(r)] = static_cast<T>(a[c][static_cast<unsigned>(r)]);
+        }
+      }
+    }
+
+    template <size_t RR = R, size_t CC = C, std::enable_if_t<RR == 3 && CC == 4, int> = 0>
+    constexpr explicit tMat(const Affine3& a) : m{} {
+      for ( size_t c = 0; c < 4; c++ ) {
+        for ( size_t r = 0; r < 3; r++ ) {
+          m[c][static_cast<unsigned>(r)] = static_cast<T>(a[r][static_cast<unsigned>(c)]);
+        }
+      }
+    }
+
+    /* Access */
+
+    constexpr col_type& operator [](size_t index) {
+      assert(index < C);
+      return m[index];
+    }
+
+    constexpr const col_type& operator [](size_t index) const {
+      assert(index < C);
+      return m[index];
+    }
+
+    constexpr row_type row(size_t index) const {
+      assert(index < R);
+      row_type result;
+      for ( size_t c = 0; c < C; c++ ) {
+        result[static_cast<unsigned>(c)] = m[c][static_cast<unsigned>(index)];
+      }
+      return result;
+    }
+
+    /* Contiguous column major access, R * C values */
+
+    T* data() noexcept { return &m[0].x; }
+    const T* data() const noexcept { return &m[0].x; }
+
+    /* Conversions */
+
+    // Widens to 4x4, the missing part comes from the identity
+    constexpr Matrix4 toMatrix4() const {
+      Matrix4 result;
+      for ( size_t c = 0; c < C; c++ ) {
+        for ( size_t r = 0; r < R; r++ ) {
+          result[c][static_cast<unsigned>(r)] = static_cast<float>(m[c][static_cast<unsigned>(r)]);
+        }
+      }
+      return result;
+    }
+
+    template <size_t RR = R, size_t CC = C, std::enable_if_t<RR == 3 && CC == 4, int> = 0>
+    constexpr Affine3 toAffine3() const {
+      return Affine3(row(0), row(1), row(2));
+    }
+
+    /* Arithmetic */
+
+    constexpr tMat<C, R, T> transposed() const {
+      tMat<C, R, T> result;
+      for ( size_t c = 0; c < C; c++ ) {
+        for ( size_t r = 0; r < R; r++ ) {
+          result[r][static_cast<unsigned>(c)] = m[c][static_cast<unsigned>(r)];
+        }
+      }
+      return result;
+    }
+
+    constexpr tMat& operator +=(const tMat& rhs) {
+      for ( size_t c = 0; c < C; c++ ) m[c] += rhs.m[c];
+      return *this;
+    }
+
+    constexpr tMat& operator -=(const tMat& rhs) {
+      for ( size_t c = 0; c < C; c++ ) m[c] -= rhs.m[c];
+      return *this;
+    }
+
+    constexpr tMat& operator *=(T s) {
+      for ( size_t c = 0; c < C; c++ ) m[c] *= s;
+      return *this;
+    }
+
+    // Square matrices only
+    constexpr T determinant() const {
+      static_assert(R == C && R <= 3, "determinant() is provided for Matrix2 and Matrix3, use Matrix4");
+      if constexpr ( R == 2 ) {
+        return m[0].x * m[1].y - m[1].x * m[0].y;
+      } else {
+        return m[0].x * (m[1].y * m[2].z - m[2].y * m[1].z)
+             - m[1].x * (m[0].y * m[2].z - m[2].y * m[0].z)
+             + m[2].x * (m[0].y * m[1].z - m[1].y * m[0].z);
+      }
+    }
+
+    // The matrix is returned unchanged when it is singular, like Matrix4
+    constexpr tMat inversed() const {
+      const T det = determinant();
+      if ( det == static_cast<T>(0) ) return *this;
+
+      const T inv = static_cast<T>(1) / det;
+      if constexpr ( R == 2 ) {
+        return tMat(m[1].y * inv, -m[0].y * inv, -m[1].x * inv, m[0].x * inv);
+      } else {
+        // Adjugate, the transpose of the cofactors
+        return tMat(
+          (m[1].y * m[2].z - m[2].y * m[1].z) * inv,
+          (m[2].y * m[0].z - m[0].y * m[2].z) * inv,
+          (m[0].y * m[1].z - m[1].y * m[0].z) * inv,
+          (m[2].x * m[1].z - m[1].x * m[2].z) * inv,
+          (m[0].x * m[2].z - m[2].x * m[0].z) * inv,
+          (m[1].x * m[0].z - m[0].x * m[1].z) * inv,
+          (m[1].x * m[2].y - m[2].x * m[1].y) * inv,
+          (m[2].x * m[0].y - m[0].x * m[2].y) * inv,
+          (m[0].x * m[1].y - m[1].x * m[0].y) * inv);
+      }
+    }
+
+    /* GPU upload */
+
+    // Bytes between columns: std140 rounds every column up to a vec4,
+    // std430 only does so for vec3 columns
+    template <GpuLayout L>
+    static constexpr size_t columnStride() {
+      return (L == GpuLayout::Std140 || R == 3 ? 4 : R) * sizeof(T);
+    }
+
+    template <GpuLayout L>
+    static constexpr size_t rowStride() {
+      return tMat<C, R, T>::template columnStride<L>();
+    }
+
+    template <GpuLayout L>
+    static constexpr size_t gpuSize() { return C * columnStride<L>(); }
+
+    template <GpuLayout L>
+    static constexpr size_t gpuRowsSize() { return R * rowStride<L>(); }
+
+    // Writes the matColxRow layout, padding bytes are left untouched
+    template <GpuLayout L>
+    void pack(void* dst) const noexcept {
+      static_assert(std::is_same_v<T, float>, "only float matrices have a GPU layout");
+      unsigned char* out = static_cast<unsigned char*>(dst);
+      for ( size_t c = 0; c < C; c++ ) {
+        std::memcpy(out + c * columnStride<L>(), &m[c].x, R * sizeof(T));
+      }
+    }
+
+    // Writes the transpose, row after row, for the shader to use as matRowxCol
+    template <GpuLayout L>
+    void packRows(void* dst) const noexcept {
+      static_assert(std::is_same_v<T, float>, "only float matrices have a GPU layout");
+      unsigned char* out = static_cast<unsigned char*>(dst);
+      for ( size_t r = 0; r < R; r++ ) {
+        T values[C];
+        for ( size_t c = 0; c < C; c++ ) values[c] = m[c][static_cast<unsigned>(r)];
+        std::memcpy(out + r * rowStride<L>(), values, sizeof(values));
+      }
+    }
+
+  private:
+    col_type m[C];
+  };
+
+  /* Binary operators */
+
+  template <size_t R, size_t C, typename T>
+  constexpr tMat<R, C, T> operator +(tMat<R, C, T> lhs, const tMat<R, C, T>& rhs) {
+    return lhs += rhs;
+  }
+
+  template <size_t R, size_t C, typename T>
+  constexpr tMat<R, C, T> operator -(tMat<R, C, T> lhs, const tMat<R, C, T>& rhs) {
+    return lhs -= rhs;
+  }
+
+  template <size_t R, size_t C, typename T>
+  constexpr tMat<R, C, T> operator *(tMat<R, C, T> lhs, T s) {
+    return lhs *= s;
+  }
+
+  template <size_t R, size_t C, typename T>
+  constexpr tMat<R, C, T> operator *(T s, tMat<R, C, T> rhs) {
+    return rhs *= s;
+  }
+
+  template <size_t R, size_t K, size_t C, typename T>
+  constexpr tMat<R, C, T> operator *(const tMat<R, K, T>& lhs, const tMat<K, C, T>& rhs) {
+    tMat<R, C, T> result(static_cast<T>(0));
+    for ( size_t c = 0; c < C; c++ ) {
+      for ( size_t k = 0; k < K; k++ ) {
+        result[c] += lhs[k] * rhs[c][static_cast<unsigned>(k)];
+      }
+    }
+    return result;
+  }
+
+  template <size_t R, size_t C, typename T>
+  constexpr typename tMat<R, C, T>::col_type operator *(const tMat<R, C, T>& lhs,
+                                                        const typename tMat<R, C, T>::row_type& v) {
+    typename tMat<R, C, T>::col_type result;
+    for ( size_t c = 0; c < C; c++ ) {
+      result += lhs[c] * v[static_cast<unsigned>(c)];
+    }
+    return result;
+  }
+
+  template <size_t R, size_t C, typename T>
+  constexpr bool operator ==(const tMat<R, C, T>& lhs, const tMat<R, C, T>& rhs) {
+    for ( size_t c = 0; c < C; c++ ) {
+      if ( !(lhs[c] == rhs[c]) ) return false;
+    }
+    return true;
+  }
+
+  template <size_t R, size_t C, typename T>
+  constexpr bool operator !=(const tMat<R, C, T>& lhs, const tMat<R, C, T>& rhs) {
+    return !(lhs == rhs);
+  }
+
+  using Matrix2   = tMat<2, 2, float>;
+  using Matrix3   = tMat<3, 3, float>;
+  using Matrix3x4 = tMat<3, 4, float>;
+  using dMatrix3  = tMat<3, 3, double>;
+
+  static_assert(sizeof(Matrix2) == 16 && sizeof(Matrix3) == 36 && sizeof(Matrix3x4) == 48,
+                "tMat columns must be tightly packed");
+  static_assert(sizeof(tMat<4, 4, float>) == sizeof(Matrix4), "tMat<4, 4> must have the Matrix4 layout");
+  static_assert(Matrix3::gpuSize<GpuLayout::Std140>() == 48 && Matrix3x4::gpuRowsSize<GpuLayout::Std140>() == 48,
+                "std140 mat3 and mat3x4 take three vec4");
+  static_assert(Matrix2::gpuSize<GpuLayout::Std430>() == 16 && Matrix2::gpuSize<GpuLayout::Std140>() == 32,
+                "std430 packs mat2 columns, std140 pads them");
+
+  namespace Math {
+
+    // Inverse transpose of the upper 3x3 of a model matrix, for normals
+    constexpr Matrix3 normalMatrix(const Matrix4& model) {
+      return Matrix3(model).inversed().transposed();
+    }
+  }
+}
+
+#endif //PROJECT_DEF_MATRIX_HPP
@@ -22,13 +22,14 @@ namespace fn {
     template <typename T>
     struct tVec2 {
 
-        tVec2<T>();
-        tVec2<T>(T t_a, T t_b);
-        tVec2<T>(const tVec2<T>& rhs);
-        explicit tVec2<T>(T scalar);
+        constexpr tVec2<T>();
+        constexpr tVec2<T>(T t_a, T t_b);
+        constexpr tVec2<T>(const tVec2<T>& rhs);
+        constexpr tVec2<T>& operator=(const tVec2<T>& rhs) = default;
+        constexpr explicit tVec2<T>(T scalar);
 
-        T& operator [](unsigned int index);
-        const T& operator [](unsigned int index) const;
+        constexpr T& operator [](unsigned int index);
+        constexpr const T& operator [](unsigned int index) const;
 
         /* get_index and set_index static methods used for lua-bindings */
         static T get_index(tVec2<T>& v, unsigned int i) {
@@ -39,36 +40,36 @@ namespace fn {
             v[i] = value;
         }
 
-        void set(T a, T b);
+        constexpr void set(T a, T b);
 
         /* Unary arithmetic operators */
 
         template <typename U>
-        tVec2<T>& operator=(const tVec2<U>& rhs);
+        constexpr tVec2<T>& operator=(const tVec2<U>& rhs);
         template <typename U>
-        tVec2<T>& operator+=(U scalar);
+        constexpr tVec2<T>& operator+=(U scalar);
         template <typename U>
-        tVec2<T>& operator+=(const tVec2<U>& rhs);
+        constexpr tVec2<T>& operator+=(const tVec2<U>& rhs);
         template <typename U>
-        tVec2<T>& operator-=(U scalar);
+        constexpr tVec2<T>& operator-=(U scalar);
         template <typename U>
-        tVec2<T>& operator-=(const tVec2<U>& rhs);
+        constexpr tVec2<T>& operator-=(const tVec2<U>& rhs);
         template <typename U>
-        tVec2<T>& operator*=(U scalar);
+        constexpr tVec2<T>& operator*=(U scalar);
         template <typename U>
-        tVec2<T>& operator*=(const tVec2<U>& rhs);
+        constexpr tVec2<T>& operator*=(const tVec2<U>& rhs);
         template <typename U>
-        tVec2<T>& operator/=(U scalar);
+        constexpr tVec2<T>& operator/=(U scalar);
         template <typename U>
-        tVec2<T>& operator/=(const tVec2<U>& rhs);
+        constexpr tVec2<T>& operator/=(const tVec2<U>& rhs);
 
-        tVec2<T>& operator ++();
-        tVec2<T>& operator --();
-        const tVec2<T> operator ++(int);
-        const tVec2<T> operator --(int);
+        constexpr tVec2<T>& operator ++();
+        constexpr tVec2<T>& operator --();
+        constexpr const tVec2<T> operator ++(int);
+        constexpr const tVec2<T> operator --(int);
 
         T               length() const;
-        T               squareLength() const;
+        constexpr T       squareLength() const;
 
         union { T x, r, s; };
         union { T y, g, t; };
@@ -77,50 +78,50 @@ namespace fn {
     /* tVec2 Binary operators */
 
     template <typename T>
-    tVec2<T> operator+(const tVec2<T>& lhs, T scalar);
+    constexpr tVec2<T> operator+(const tVec2<T>& lhs, T scalar);
 
     template <typename T>
-    tVec2<T> operator+(T scalar, const tVec2<T>& rhs);
+    constexpr tVec2<T> operator+(T scalar, const tVec2<T>& rhs);
 
     template <typename T>
-    tVec2<T> operator+(const tVec2<T>& lhs, const tVec2<T>& rhs);
+    constexpr tVec2<T> operator+(const tVec2<T>& lhs, const tVec2<T>& rhs);
 
     template <typename T>
-    tVec2<T> operator-(const tVec2<T>& rhs, T scalar);
+    constexpr tVec2<T> operator-(const tVec2<T>& rhs, T scalar);
 
     template <typename T>
-    tVec2<T> operator-(T scalar, const tVec2<T>& rhs);
+    constexpr tVec2<T> operator-(T scalar, const tVec2<T>& rhs);
 
     template <typename T>
-    tVec2<T> operator-(const tVec2<T>& lhs, const tVec2<T>& rhs);
+    constexpr tVec2<T> operator-(const tVec2<T>& lhs, const tVec2<T>& rhs);
 
     template <typename T>
-    tVec2<T> operator*(const tVec2<T>& lhs, T scalar);
+    constexpr tVec2<T> operator*(const tVec2<T>& lhs, T scalar);
 
     template <typename T>
-    tVec2<T> operator*(T scalar, const tVec2<T>& rhs);
+    constexpr tVec2<T> operator*(T scalar, const tVec2<T>& rhs);
 
     template <typename T>
-    tVec2<T> operator*(const tVec2<T>& lhs, const tVec2<T>& rhs);
+    constexpr tVec2<T> operator*(const tVec2<T>& lhs, const tVec2<T>& rhs);
 
     template <typename T>
-    tVec2<T> operator/(const tVec2<T>& lhs, T scalar);
+    constexpr tVec2<T> operator/(const tVec2<T>& lhs, T scalar);
 
     template <typename T>
-    tVec2<T> operator/(T scalar, const tVec2<T>& rhs);
+    constexpr tVec2<T> operator/(T scalar, const tVec2<T>& rhs);
 
     template <typename T>
-    tVec2<T> operator/(const tVec2<T>& lhs, const tVec2<T>& rhs);
+    constexpr tVec2<T> operator/(const tVec2<T>& lhs, const tVec2<T>& rhs);
 
     template <typename T>
-    bool operator==(const tVec2<T>& lhs, const tVec2<T>& rhs);
+    constexpr bool operator==(const tVec2<T>& lhs, const tVec2<T>& rhs);
 
     template <typename T>
-    bool operator!=(const tVec2<T>& lhs, const tVec2<T>& rhs);
+    constexpr bool operator!=(const tVec2<T>& lhs, const tVec2<T>& rhs);
 
 
     template <typename T>
-    T dotProduct(const tVec2<T>& lhs, const tVec2<T>& rhs);
+    constexpr T dotProduct(const tVec2<T>& lhs, const tVec2<T>& rhs);
 
     template <typename T>
     struct tVec3 {
@@ -129,23 +130,24 @@ namespace fn {
         union { T y, g, t; };
         union { T z, b, p; };
 
-        tVec3<T>();
-        tVec3<T>(T a,T b,T c);
-        tVec3<T>(const tVec2<T>& lhs, T c);
-        tVec3<T>(const tVec3<T>& rhs);
-        explicit tVec3<T>(T scalar);
-        explicit tVec3<T>(const std::array<T, 3>& array);
+        constexpr tVec3<T>();
+        constexpr tVec3<T>(T a,T b,T c);
+        constexpr tVec3<T>(const tVec2<T>& lhs, T c);
+        constexpr tVec3<T>(const tVec3<T>& rhs);
+        constexpr tVec3<T>& operator=(const tVec3<T>& rhs) = default;
+        constexpr explicit tVec3<T>(T scalar);
+        constexpr explicit tVec3<T>(const std::array<T, 3>& array);
 
-        void set(T a, T b, T c);
-        void set(const tVec2<T>& lhs, T c);
-        tVec2<T> xy() const;
+        constexpr void set(T a, T b, T c);
+        constexpr void set(const tVec2<T>& lhs, T c);
+        constexpr tVec2<T> xy() const;
 
-        explicit operator std::array<T, 3>();
+        constexpr explicit operator std::array<T, 3>();
 
-        tVec3<T>& operator =(const std::array<T, 3>& array);
+        constexpr tVec3<T>& operator =(const std::array<T, 3>& array);
 
-        T &operator [](unsigned int index);
-        const T &operator [](unsigned int index) const;
+        constexpr T &operator [](unsigned int index);
+        constexpr const T &operator [](unsigned int index) const;
         
         /* get_index and set_index static methods used for lua-bindings */
         static T get_index(tVec3<T>& v, unsigned int i) {
@@ -159,91 +161,91 @@ namespace fn {
         /* Unary arithmetic operators */
 
         template <typename U>
-        tVec3<T>& operator=(const tVec3<U>& rhs);
+        constexpr tVec3<T>& operator=(const tVec3<U>& rhs);
         template <typename U>
-        tVec3<T>& operator+=(U scalar);
+        constexpr tVec3<T>& operator+=(U scalar);
         template <typename U>
-        tVec3<T>& operator+=(const tVec3<U>& rhs);
+        constexpr tVec3<T>& operator+=(const tVec3<U>& rhs);
         template <typename U>
-        tVec3<T>& operator-=(U scalar);
+        constexpr tVec3<T>& operator-=(U scalar);
         template <typename U>
-        tVec3<T>& operator-=(const tVec3<U>& rhs);
+        constexpr tVec3<T>& operator-=(const tVec3<U>& rhs);
         template <typename U>
-        tVec3<T>& operator*=(U scalar);
+        constexpr tVec3<T>& operator*=(U scalar);
         template <typename U>
-        tVec3<T>& operator*=(const tVec3<U>& rhs);
+        constexpr tVec3<T>& operator*=(const tVec3<U>& rhs);
         template <typename U>
-        tVec3<T>& operator/=(U scalar);
+        constexpr tVec3<T>& operator/=(U scalar);
         template <typename U>
-        tVec3<T>& operator/=(const tVec3<U>& rhs);
+        constexpr tVec3<T>& operator/=(const tVec3<U>& rhs);
 
-        tVec3<T>& operator -();
+        constexpr tVec3<T>& operator -();
 
         /* Increment and decrement operators */
 
-        tVec3<T>& operator++();
-        tVec3<T>& operator--();
-        const tVec3<T> operator++(int);
-        const tVec3<T> operator--(int);
+        constexpr tVec3<T>& operator++();
+        constexpr tVec3<T>& operator--();
+        constexpr const tVec3<T> operator++(int);
+        constexpr const tVec3<T> operator--(int);
 
 
         void normalize();
         tVec3<T> normalized() const;
         T length() const;
-        T squaredLength() const;
+        constexpr T squaredLength() const;
 
     };
 
     template <typename T>
-    tVec3<T> operator+(const tVec3<T>& lhs, T scalar);
+    constexpr tVec3<T> operator+(const tVec3<T>& lhs, T scalar);
 
     template <typename T>
-    tVec3<T> operator+(T scalar, const tVec3<T>& lhs);
+    constexpr tVec3<T> operator+(T scalar, const tVec3<T>& lhs);
 
     template <typename T>
-    tVec3<T> operator+(const tVec3<T>& lhs, const tVec3<T>& rhs);
+    constexpr tVec3<T> operator+(const tVec3<T>& lhs, const tVec3<T>& rhs);
 
     template <typename T>
-    tVec3<T> operator-(const tVec3<T>& lhs, T scalar);
+    constexpr tVec3<T> operator-(const tVec3<T>& lhs, T scalar);
 
     template <typename T>
-    tVec3<T> operator-(T scalar, const tVec3<T>& rhs);
+    constexpr tVec3<T> operator-(T scalar, const tVec3<T>& rhs);
 
     template <typename T>
-    tVec3<T> operator-(const tVec3<T>& lhs, const tVec3<T>& rhs);
+    constexpr tVec3<T> operator-(const tVec3<T>& lhs, const tVec3<T>& rhs);
 
     template <typename T>
-    tVec3<T> operator*(const tVec3<T>& lhs, T scalar);
+    constexpr tVec3<T> operator*(const tVec3<T>& lhs, T scalar);
 
     template <typename T>
-    tVec3<T> operator*(T scalar, const tVec3<T>& rhs);
+    constexpr tVec3<T> operator*(T scalar, const tVec3<T>& rhs);
 
     template <typename T>
-    tVec3<T> operator*(const tVec3<T>& lhs, const tVec3<T>& rhs);
+    constexpr tVec3<T> operator*(const tVec3<T>& lhs, const tVec3<T>& rhs);
 
     template <typename T>
-    tVec3<T> operator/(const tVec3<T>& lhs, T scalar);
+    constexpr tVec3<T> operator/(const tVec3<T>& lhs, T scalar);
 
     template <typename T>
-    tVec3<T> operator/(T scalar, const tVec3<T>& rhs);
+    constexpr tVec3<T> operator/(T scalar, const tVec3<T>& rhs);
 
     template <typename T>
-    tVec3<T> operator/(const tVec3<T>& lhs, const tVec3<T>& rhs);
+    constexpr tVec3<T> operator/(const tVec3<T>& lhs, const tVec3<T>& rhs);
 
     template <typename T>
-    bool operator==(const tVec3<T>& lhs, const tVec3<T>& rhs);
+    constexpr bool operator==(const tVec3<T>& lhs, const tVec3<T>& rhs);
 
     template <typename T>
-    bool operator!=(const tVec3<T>& lhs, const tVec3<T>& rhs);
+    constexpr bool operator!=(const tVec3<T>& lhs, const tVec3<T>& rhs);
 
     template <typename T>
-    T dotProduct(const tVec3<T>& lhs, const tVec3<T>& rhs);
+    constexpr T dotProduct(const tVec3<T>& lhs, const tVec3<T>& rhs);
 
     template <typename T>
-    tVec3<T> crossProduct(const tVec3<T>& lhs, const tVec3<T>& rhs);
+    constexpr tVec3<T> crossProduct(const tVec3<T>& lhs, const tVec3<T>& rhs);
 
     template <typename T>
-    void lerp(const tVec3<T>& lhs, const tVec3<T>& rhs, tVec3<T>* out, T val);
+    constexpr void lerp(const tVec3<T>& lhs, const tVec3<T>& rhs, tVec3<T>* out, T val);
 
     template <typename T>
     struct tVec4 {
@@ -255,18 +257,19 @@ namespace fn {
         union { T z, b, p; };
         union { T w, a, q; };
 
-        tVec4<T>();
-        tVec4<T>(T a, T b, T c, T d);
-        tVec4<T>(const tVec3<T>& vec, T d);
-        tVec4<T>(const tVec4<T>& rhs);
-        explicit tVec4<T>(T scalar);
+        constexpr tVec4<T>();
+        constexpr tVec4<T>(T a, T b, T c, T d);
+        constexpr tVec4<T>(const tVec3<T>& vec, T d);
+        constexpr tVec4<T>(const tVec4<T>& rhs);
+        constexpr tVec4<T>& operator=(const tVec4<T>& rhs) = default;
+        constexpr explicit tVec4<T>(T scalar);
 
-        tVec3<T> xyz();
-        void set(T a, T b, T c, T d);
-        operator tVec3<T>();
+        constexpr tVec3<T> xyz();
+        constexpr void set(T a, T b, T c, T d);
+        constexpr operator tVec3<T>();
 
-        T& operator [](unsigned int index);
-        const T& operator [](unsigned int index) const;
+        constexpr T& operator [](unsigned int index);
+        constexpr const T& operator [](unsigned int index) const;
 
         /* get_index and set_index static methods used for lua-bindings */
         static T get_index(tVec4<T>& v, unsigned int i) {
@@ -280,33 +283,33 @@ namespace fn {
         /* Unary arithmetic operators */
 
         template <typename U>
-        tVec4<T>& operator=(const tVec4<U>& rhs);
+        constexpr tVec4<T>& operator=(const tVec4<U>& rhs);
         template <typename U>
-        tVec4<T>& operator+=(U scalar);
+        constexpr tVec4<T>& operator+=(U scalar);
         template <typename U>
-        tVec4<T>& operator+=(const tVec4<U>& rhs);
+        constexpr tVec4<T>& operator+=(const tVec4<U>& rhs);
         template <typename U>
-        tVec4<T>& operator-=(U scalar);
+        constexpr tVec4<T>& operator-=(U scalar);
         template <typename U>
-        tVec4<T>& operator-=(const tVec4<U>& rhs);
+        constexpr tVec4<T>& operator-=(const tVec4<U>& rhs);
         template <typename U>
-        tVec4<T>& operator*=(U scalar);
+        constexpr tVec4<T>& operator*=(U scalar);
         template <typename U>
-        tVec4<T>& operator*=(const tVec4<U>& rhs);
+        constexpr tVec4<T>& operator*=(const tVec4<U>& rhs);
         template <typename U>
-        tVec4<T>& operator/=(U scalar);
+        constexpr tVec4<T>& operator/=(U scalar);
         template <typename U>
-        tVec4<T>& operator/=(const tVec4<U>& rhs);
+        constexpr tVec4<T>& operator/=(const tVec4<U>& rhs);
 
         /* Increment and decrement operators */
 
-        tVec4<T>& operator++();
-        tVec4<T>& operator--();
-        const tVec4<T> operator++(int);
-        const tVec4<T> operator--(int);
+        constexpr tVec4<T>& operator++();
+        constexpr tVec4<T>& operator--();
+        constexpr const tVec4<T> operator++(int);
+        constexpr const tVec4<T> operator--(int);
 
         T length() const;
-        T sqaredLength() const;
+        constexpr T sqaredLength() const;
         void normilize();
 
     };
@@ -314,53 +317,53 @@ namespace fn {
     /* tVec4 arithmetic binary operators */
 
     template <typename T>
-    tVec4<T> operator+(const tVec4<T>& lhs, T scalar);
+    constexpr tVec4<T> operator+(const tVec4<T>& lhs, T scalar);
 
     template <typename T>
-    tVec4<T> operator+(T scalar, const tVec4<T>& rhs);
+    constexpr tVec4<T> operator+(T scalar, const tVec4<T>& rhs);
 
     template <typename T>
-    tVec4<T> operator+(const tVec4<T>& lhs, const tVec4<T>& rhs);
+    constexpr tVec4<T> operator+(const tVec4<T>& lhs, const tVec4<T>& rhs);
 
     template <typename T>
-    tVec4<T> operator-(const tVec4<T>& lhs, T scalar);
+    constexpr tVec4<T> operator-(const tVec4<T>& lhs, T scalar);
 
     template <typename T>
-    tVec4<T> operator-(T scalar, const tVec4<T>& rhs);
+    constexpr tVec4<T> operator-(T scalar, const tVec4<T>& rhs);
 
     template <typename T>
-    tVec4<T> operator-(const tVec4<T>& lhs, const tVec4<T>& rhs);
+    constexpr tVec4<T> operator-(const tVec4<T>& lhs, const tVec4<T>& rhs);
 
     template <typename T>
-    tVec4<T> operator*(const tVec4<T>& lhs, T scalar);
+    constexpr tVec4<T> operator*(const tVec4<T>& lhs, T scalar);
 
     template <typename T>
-    tVec4<T> operator*(T scalar, const tVec4<T>& rhs);
+    constexpr tVec4<T> operator*(T scalar, const tVec4<T>& rhs);
 
     template <typename T>
-    tVec4<T> operator*(const tVec4<T>& lhs, const tVec4<T>& rhs);
+    constexpr tVec4<T> operator*(const tVec4<T>& lhs, const tVec4<T>& rhs);
 
     template <typename T>
-    tVec4<T> operator/(const tVec4<T>& lhs, T scalar);
+    constexpr tVec4<T> operator/(const tVec4<T>& lhs, T scalar);
 
     template <typename T>
-    tVec4<T> operator/(T scalar, const tVec4<T>& rhs);
+    constexpr tVec4<T> operator/(T scalar, const tVec4<T>& rhs);
 
     template <typename T>
-    tVec4<T> operator/(const tVec4<T>& lhs, const tVec4<T>& rhs);
+    constexpr tVec4<T> operator/(const tVec4<T>& lhs, const tVec4<T>& rhs);
 
     template <typename T>
-    bool operator==(const tVec4<T>& lhs, const tVec4<T>& rhs);
+    constexpr bool operator==(const tVec4<T>& lhs, const tVec4<T>& rhs);
 
     template <typename T>
-    bool operator!=(const tVec4<T>& lhs, const tVec4<T>& rhs);
+    constexpr bool operator!=(const tVec4<T>& lhs, const tVec4<T>& rhs);
 
 
     template <typename T>
-    T dotProduct(const tVec4<T>& lhs, const tVec4<T>& rhs);
+    constexpr T dotProduct(const tVec4<T>& lhs, const tVec4<T>& rhs);
 
     template <typename T>
-    void lerp(const tVec4<T>& lhs, const tVec4<T>& rhs, tVec4<T>* out, T t);
+    constexpr void lerp(const tVec4<T>& lhs, const tVec4<T>& rhs, tVec4<T>* out, T t);
 }
 
 #include "def_vector.inl"
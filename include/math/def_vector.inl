@@ -8,6 +8,9 @@
                  Supervisor: Dr. George Sisias
    ======================================================================== */
 
+//Engine Internal
+#include "math/math_utils.hh"
+
 //C++ Includes
 #include <cassert>
 #include <cmath>
@@ -15,39 +18,37 @@
 namespace fn {
 
   template <typename T>
-  tVec2<T>::tVec2()
+  constexpr tVec2<T>::tVec2()
     : x(static_cast<T>(0.0f)), y(static_cast<T>(0.0f)) { }
 
   template <typename T>
-  tVec2<T>::tVec2(T t_a, T t_b)
+  constexpr tVec2<T>::tVec2(T t_a, T t_b)
     : x(t_a), y(t_b) { }
 
   template <typename T>
-  tVec2<T>::tVec2(const tVec2<T> &rhs)
+  constexpr tVec2<T>::tVec2(const tVec2<T> &rhs)
     : x(rhs.x), y(rhs.y) { }
 
   template <typename T>
-  tVec2<T>::tVec2(T scalar)
+  constexpr tVec2<T>::tVec2(T scalar)
     : x(scalar), y(scalar) { }
 
   template <typename T>
-  T &tVec2<T>::operator[](unsigned int index) {
+  constexpr T &tVec2<T>::operator[](unsigned int index) {
 
     assert(index < 2);
-    if ( index == 0 ) return x;
-    if ( index == 1 ) return y;
+    return index == 0 ? x : y;
   }
 
   template <typename T>
-  const T &tVec2<T>::operator[](unsigned int index) const {
+  constexpr const T &tVec2<T>::operator[](unsigned int index) const {
 
     assert(index < 2);
-    if ( index == 0 ) return x;
-    if ( index == 1 ) return y;
+    return index == 0 ? x : y;
   }
 
   template <typename T>
-  void tVec2<T>::set(T a, T b) {
+  constexpr void tVec2<T>::set(T a, T b) {
 
     this->x = static_cast<T>(a);
     this->y = static_cast<T>(b);
@@ -62,7 +63,7 @@ namespace fn {
   }
 
   template <typename T>
-  T tVec2<T>::squareLength() const {
+  constexpr T tVec2<T>::squareLength() const {
 
     T _x = this->x;
     T _y = this->y;
@@ -70,7 +71,7 @@ namespace fn {
   }
 
   template <typename T>
-  tVec2<T> &tVec2<T>::operator++() {
+  constexpr tVec2<T> &tVec2<T>::operator++() {
 
     ++this->x;
     ++this->y;
@@ -78,7 +79,7 @@ namespace fn {
   }
 
   template <typename T>
-  tVec2<T> &tVec2<T>::operator--() {
+  constexpr tVec2<T> &tVec2<T>::operator--() {
 
     --this->x;
     --this->y;
@@ -86,7 +87,7 @@ namespace fn {
   }
 
   template <typename T>
-  const tVec2<T> tVec2<T>::operator++(int) {
+  constexpr const tVec2<T> tVec2<T>::operator++(int) {
 
     tVec2<T> result(*this);
     ++*this;
@@ -94,7 +95,7 @@ namespace fn {
   }
 
   template <typename T>
-  const tVec2<T> tVec2<T>::operator--(int) {
+  constexpr const tVec2<T> tVec2<T>::operator--(int) {
 
     tVec2 result(*this);
     --*this;
@@ -103,7 +104,7 @@ namespace fn {
 
   template <typename T>
   template <typename U>
-  tVec2<T> &tVec2<T>::operator=(const tVec2<U> &rhs) {
+  constexpr tVec2<T> &tVec2<T>::operator=(const tVec2<U> &rhs) {
 
     this->x = rhs.x;
     this->y = rhs.y;
@@ -112,7 +113,7 @@ namespace fn {
 
   template <typename T>
   template <typename U>
-  tVec2<T> &tVec2<T>::operator+=(U scalar) {
+  constexpr tVec2<T> &tVec2<T>::operator+=(U scalar) {
 
     this->x += scalar;
     this->y += scalar;
@@ -122,7 +123,7 @@ namespace fn {
 
   template <typename T>
   template <typename U>
-  tVec2<T> &tVec2<T>::operator+=(const tVec2<U> &rhs) {
+  constexpr tVec2<T> &tVec2<T>::operator+=(const tVec2<U> &rhs) {
 
     this->x += rhs.x;
     this->y += rhs.y;
@@ -131,7 +132,7 @@ namespace fn {
 
   template <typename T>
   template <typename U>
-  tVec2<T> &tVec2<T>::operator-=(U scalar) {
+  constexpr tVec2<T> &tVec2<T>::operator-=(U scalar) {
 
     this->x -= scalar;
     this->y -= scalar;
@@ -141,7 +142,7 @@ namespace fn {
 
   template <typename T>
   template <typename U>
-  tVec2<T> &tVec2<T>::operator-=(const tVec2<U> &rhs) {
+  constexpr tVec2<T> &tVec2<T>::operator-=(const tVec2<U> &rhs) {
 
     this->x -= rhs.x;
     this->y -= rhs.y;
@@ -151,7 +152,7 @@ namespace fn {
 
   template <typename T>
   template <typename U>
-  tVec2<T> &tVec2<T>::operator*=(U scalar) {
+  constexpr tVec2<T> &tVec2<T>::operator*=(U scalar) {
 
     this->x *= scalar;
     this->y *= scalar;
@@ -161,7 +162,7 @@ namespace fn {
 
   template <typename T>
   template <typename U>
-  tVec2<T> &tVec2<T>::operator*=(const tVec2<U> &rhs) {
+  constexpr tVec2<T> &tVec2<T>::operator*=(const tVec2<U> &rhs) {
 
     this->x *= rhs.x;
     this->y *= rhs.y;
@@ -171,7 +172,7 @@ namespace fn {
 
   template <typename T>
   template <typename U>
-  tVec2<T> &tVec2<T>::operator/=(U scalar) {
+  constexpr tVec2<T> &tVec2<T>::operator/=(U scalar) {
 
     this->x /= scalar;
     this->y /= scalar;
@@ -180,7 +181,7 @@ namespace fn {
 
   template <typename T>
   template <typename U>
-  tVec2<T> &tVec2<T>::operator/=(const tVec2<U> &rhs) {
+  constexpr tVec2<T> &tVec2<T>::operator/=(const tVec2<U> &rhs) {
 
     this->x /= rhs.x;
     this->y /= rhs.y;
@@ -188,7 +189,7 @@ namespace fn {
   }
 
   template <typename T>
-  tVec2<T> operator+(const tVec2<T> &lhs, T scalar) {
+  constexpr tVec2<T> operator+(const tVec2<T> &lhs, T scalar) {
 
     return tVec2<T>(
       lhs.x + scalar,
@@ -197,7 +198,7 @@ namespace fn {
   }
 
   template <typename T>
-  tVec2<T> operator+(T scalar, const tVec2<T> &rhs) {
+  constexpr tVec2<T> operator+(T scalar, const tVec2<T> &rhs) {
 
     return tVec2<T>(
       scalar + rhs.x,
@@ -206,7 +207,7 @@ namespace fn {
   }
 
   template <typename T>
-  tVec2<T> operator+(const tVec2<T> &lhs, const tVec2<T> &rhs) {
+  constexpr tVec2<T> operator+(const tVec2<T> &lhs, const tVec2<T> &rhs) {
 
     return tVec2<T>(
       lhs.x + rhs.x,
@@ -215,7 +216,7 @@ namespace fn {
   }
 
   template <typename T>
-  tVec2<T> operator-(const tVec2<T> &lhs, T scalar) {
+  constexpr tVec2<T> operator-(const tVec2<T> &lhs, T scalar) {
 
     return tVec2<T>(
       lhs.x - scalar,
@@ -224,7 +225,7 @@ namespace fn {
   }
 
   template <typename T>
-  tVec2<T> operator-(T scalar, const tVec2<T> &rhs) {
+  constexpr tVec2<T> operator-(T scalar, const tVec2<T> &rhs) {
 
     return tVec2<T>(
       scalar - rhs.x,
@@ -233,7 +234,7 @@ namespace fn {
   }
 
   template <typename T>
-  tVec2<T> operator-(const tVec2<T> &lhs, const tVec2<T> &rhs) {
+  constexpr tVec2<T> operator-(const tVec2<T> &lhs, const tVec2<T> &rhs) {
 
     return tVec2<T>(
       lhs.x - rhs.x,
@@ -242,7 +243,7 @@ namespace fn {
   }
 
   template <typename T>
-  tVec2<T> operator*(const tVec2<T> &lhs, T scalar) {
+  constexpr tVec2<T> operator*(const tVec2<T> &lhs, T scalar) {
 
     return tVec2<T>(
       lhs.x * scalar,
@@ -251,7 +252,7 @@ namespace fn {
   }
 
   template <typename T>
-  tVec2<T> operator*(T scalar, const tVec2<T> &rhs) {
+  constexpr tVec2<T> operator*(T scalar, const tVec2<T> &rhs) {
 
     return tVec2<T>(
       scalar * rhs.x,
@@ -260,7 +261,7 @@ namespace fn {
   }
 
   template <typename T>
-  tVec2<T> operator*(const tVec2<T> &lhs, const tVec2<T> &rhs) {
+  constexpr tVec2<T> operator*(const tVec2<T> &lhs, const tVec2<T> &rhs) {
 
     return tVec2<T>(
       lhs.x * rhs.x,
@@ -269,7 +270,7 @@ namespace fn {
   }
 
   template <typename T>
-  tVec2<T> operator/(const tVec2<T> &lhs, T scalar) {
+  constexpr tVec2<T> operator/(const tVec2<T> &lhs, T scalar) {
 
     return tVec2<T>(
       lhs.x / scalar,
@@ -278,7 +279,7 @@ namespace fn {
   }
 
   template <typename T>
-  tVec2<T> operator/(T scalar, const tVec2<T> &rhs) {
+  constexpr tVec2<T> operator/(T scalar, const tVec2<T> &rhs) {
 
     return tVec2<T>(
       scalar / rhs.x,
@@ -287,7 +288,7 @@ namespace fn {
   }
 
   template <typename T>
-  tVec2<T> operator/(const tVec2<T> &lhs, const tVec2<T> &rhs) {
+  constexpr tVec2<T> operator/(const tVec2<T> &lhs, const tVec2<T> &rhs) {
 
     return tVec2<T>(
       lhs.x / rhs.x,
@@ -296,45 +297,45 @@ namespace fn {
   }
 
   template <typename T>
-  bool operator==(const tVec2<T> &lhs, const tVec2<T> &rhs) {
+  constexpr bool operator==(const tVec2<T> &lhs, const tVec2<T> &rhs) {
 
     return (lhs.x == rhs.x) && (lhs.y == rhs.y);
   }
 
   template <typename T>
-  bool operator!=(const tVec2<T> &lhs, const tVec2<T> &rhs) {
+  constexpr bool operator!=(const tVec2<T> &lhs, const tVec2<T> &rhs) {
 
     return (lhs.x != rhs.x) || (lhs.y != rhs.y);
   }
 
   template <typename T>
-  inline T dotProduct(const tVec2<T> &lhs, const tVec2<T> &rhs) {
+  constexpr T dotProduct(const tVec2<T> &lhs, const tVec2<T> &rhs) {
 
     return lhs.x * rhs.x + lhs.y * rhs.y;
   }
 
   template <typename T>
-  tVec3<T>::tVec3()
+  constexpr tVec3<T>::tVec3()
     : x(static_cast<T>(0.0f)), y(static_cast<T>(0.0f)), z(static_cast<T>(0.0f)) { }
 
   template <typename T>
-  tVec3<T>::tVec3(T t_a, T t_b, T t_c)
+  constexpr tVec3<T>::tVec3(T t_a, T t_b, T t_c)
     : x(static_cast<T>(t_a)), y(static_cast<T>(t_b)), z(static_cast<T>(t_c)) { }
 
   template <typename T>
-  tVec3<T>::tVec3(const tVec2<T> &lhs, T t_c)
+  constexpr tVec3<T>::tVec3(const tVec2<T> &lhs, T t_c)
     : x(lhs.x), y(lhs.y), z(static_cast<T>(t_c)) { }
 
   template <typename T>
-  tVec3<T>::tVec3(const tVec3<T> &rhs)
+  constexpr tVec3<T>::tVec3(const tVec3<T> &rhs)
     : x(rhs.x), y(rhs.y), z(rhs.z) { }
 
   template <typename T>
-  tVec3<T>::tVec3(T scalar)
+  constexpr tVec3<T>::tVec3(T scalar)
     : x(scalar), y(scalar), z(scalar) { }
 
   template <typename T>
-  tVec3<T>& tVec3<T>::operator =(const std::array<T, 3>& array) {
+  constexpr tVec3<T>& tVec3<T>::operator =(const std::array<T, 3>& array) {
     this->x = array[0];
     this->y = array[1];
     this->z = array[2];
@@ -343,11 +344,11 @@ namespace fn {
   }
 
   template <typename T>
-  tVec3<T>::tVec3(const std::array<T, 3>& array)
+  constexpr tVec3<T>::tVec3(const std::array<T, 3>& array)
     : x(array[0]), y(array[1]), z(array[2]) { }
 
   template <typename T>
-  void tVec3<T>::set(T t_a, T t_b, T t_c) {
+  constexpr void tVec3<T>::set(T t_a, T t_b, T t_c) {
 
     this->x = static_cast<T>(t_a);
     this->y = static_cast<T>(t_b);
@@ -355,7 +356,7 @@ namespace fn {
   }
 
   template <typename T>
-  void tVec3<T>::set(const tVec2<T> &lhs, T t_c) {
+  constexpr void tVec3<T>::set(const tVec2<T> &lhs, T t_c) {
 
     this->x = lhs.x;
     this->y = lhs.y;
@@ -363,7 +364,7 @@ namespace fn {
   }
 
   template <typename T>
-  tVec2<T> tVec3<T>::xy() const {
+  constexpr tVec2<T> tVec3<T>::xy() const {
 
     return tVec2<T>(
       x,
@@ -381,7 +382,7 @@ namespace fn {
   }
 
   template <typename T>
-  T tVec3<T>::squaredLength() const {
+  constexpr T tVec3<T>::squaredLength() const {
 
     T _x = this->x;
     T _y = this->y;
@@ -395,7 +396,7 @@ namespace fn {
     T _x = this->x;
     T _y = this->y;
     T _z = this->z;
-    T inv_len = 1 / static_cast<float>(sqrt(_x * _x + _y * _y + _z * _z));
+    T inv_len = Math::rsqrt(static_cast<float>(_x * _x + _y * _y + _z * _z));
     _x *= inv_len;
     _y *= inv_len;
     _z *= inv_len;
@@ -410,7 +411,7 @@ namespace fn {
     float _x = this->x;
     float _y = this->y;
     float _z = this->z;
-    float inv_len = 1 / static_cast<float>(sqrt(_x * _x + _y * _y + _z * _z));
+    float inv_len = Math::rsqrt(_x * _x + _y * _y + _z * _z);
     _x *= inv_len;
     _y *= inv_len;
     _z *= inv_len;
@@ -418,37 +419,29 @@ namespace fn {
   }
 
   template <typename T>
-  tVec3<T>::operator std::array<T, 3>() {
+  constexpr tVec3<T>::operator std::array<T, 3>() {
 
     std::array<T, 3> tmp = { x, y, z };
     return tmp;
   }
 
   template <typename T>
-  T &tVec3<T>::operator[](unsigned int index) {
+  constexpr T &tVec3<T>::operator[](unsigned int index) {
 
     assert(index < 3);
-
-//        if (index == 0) return x;
-//        if (index == 1) return y;
-//        if (index == 2) return z;
-    return (&x)[index];
+    return index == 0 ? x : index == 1 ? y : z;
   }
 
   template <typename T>
-  const T &tVec3<T>::operator[](unsigned int index) const {
+  constexpr const T &tVec3<T>::operator[](unsigned int index) const {
 
     assert(index < 3);
-
-//        if (index == 0) return x;
-//        if (index == 1) return y;
-//        if (index == 2) return z;
-    return (&x)[index];
+    return index == 0 ? x : index == 1 ? y : z;
   }
 
   template <typename T>
   template <typename U>
-  tVec3<T> &tVec3<T>::operator=(const tVec3<U> &rhs) {
+  constexpr tVec3<T> &tVec3<T>::operator=(const tVec3<U> &rhs) {
 
     this->x = rhs.x;
     this->y = rhs.y;
@@ -460,7 +453,7 @@ namespace fn {
 
   template <typename T>
   template <typename U>
-  tVec3<T> &tVec3<T>::operator+=(U scalar) {
+  constexpr tVec3<T> &tVec3<T>::operator+=(U scalar) {
 
     this->x += scalar;
     this->y += scalar;
@@ -471,7 +464,7 @@ namespace fn {
 
   template <typename T>
   template <typename U>
-  tVec3<T> &tVec3<T>::operator+=(const tVec3<U> &rhs) {
+  constexpr tVec3<T> &tVec3<T>::operator+=(const tVec3<U> &rhs) {
 
     this->x += rhs.x;
     this->y += rhs.y;
@@ -481,7 +474,7 @@ namespace fn {
 
   template <typename T>
   template <typename U>
-  tVec3<T> &tVec3<T>::operator-=(U scalar) {
+  constexpr tVec3<T> &tVec3<T>::operator-=(U scalar) {
 
     this->x -= scalar;
     this->y -= scalar;
@@ -491,7 +484,7 @@ namespace fn {
 
   template <typename T>
   template <typename U>
-  tVec3<T> &tVec3<T>::operator-=(const tVec3<U> &rhs) {
+  constexpr tVec3<T> &tVec3<T>::operator-=(const tVec3<U> &rhs) {
 
     this->x -= rhs.x;
     this->y -= rhs.y;
@@ -501,7 +494,7 @@ namespace fn {
 
   template <typename T>
   template <typename U>
-  tVec3<T> &tVec3<T>::operator*=(U scalar) {
+  constexpr tVec3<T> &tVec3<T>::operator*=(U scalar) {
 
     this->x *= scalar;
     this->y *= scalar;
@@ -511,7 +504,7 @@ namespace fn {
 
   template <typename T>
   template <typename U>
-  tVec3<T> &tVec3<T>::operator*=(const tVec3<U> &rhs) {
+  constexpr tVec3<T> &tVec3<T>::operator*=(const tVec3<U> &rhs) {
 
     this->x *= rhs.x;
     this->y *= rhs.y;
@@ -521,7 +514,7 @@ namespace fn {
 
   template <typename T>
   template <typename U>
-  tVec3<T> &tVec3<T>::operator/=(U scalar) {
+  constexpr tVec3<T> &tVec3<T>::operator/=(U scalar) {
 
     this->x /= scalar;
     this->y /= scalar;
@@ -531,7 +524,7 @@ namespace fn {
 
   template <typename T>
   template <typename U>
-  tVec3<T> &tVec3<T>::operator/=(const tVec3<U> &rhs) {
+  constexpr tVec3<T> &tVec3<T>::operator/=(const tVec3<U> &rhs) {
 
     this->x /= rhs.x;
     this->y /= rhs.y;
@@ -540,7 +533,7 @@ namespace fn {
   }
 
   template <typename T>
-  tVec3<T> &tVec3<T>::operator-() {
+  constexpr tVec3<T> &tVec3<T>::operator-() {
 
     -this->x;
     -this->y;
@@ -550,7 +543,7 @@ namespace fn {
 
 
   template <typename T>
-  tVec3<T> &tVec3<T>::operator++() {
+  constexpr tVec3<T> &tVec3<T>::operator++() {
 
     ++this->x;
     ++this->y;
@@ -559,7 +552,7 @@ namespace fn {
   }
 
   template <typename T>
-  tVec3<T> &tVec3<T>::operator--() {
+  constexpr tVec3<T> &tVec3<T>::operator--() {
 
     --this->x;
     --this->y;
@@ -568,7 +561,7 @@ namespace fn {
   }
 
   template <typename T>
-  const tVec3<T> tVec3<T>::operator++(int) {
+  constexpr const tVec3<T> tVec3<T>::operator++(int) {
 
     tVec3<T> Result(*this);
     ++*this;
@@ -576,7 +569,7 @@ namespace fn {
   }
 
   template <typename T>
-  const tVec3<T> tVec3<T>::operator--(int) {
+  constexpr const tVec3<T> tVec3<T>::operator--(int) {
 
     tVec3 Result(*this);
     --*this;
@@ -584,7 +577,7 @@ namespace fn {
   }
 
   template <typename T>
-  tVec3<T> operator+(const tVec3<T> &lhs, T scalar) {
+  constexpr tVec3<T> operator+(const tVec3<T> &lhs, T scalar) {
 
     return tVec3<T>(
       lhs.x + scalar,
@@ -594,7 +587,7 @@ namespace fn {
   }
 
   template <typename T>
-  tVec3<T> operator+(T scalar, const tVec3<T> &rhs) {
+  constexpr tVec3<T> operator+(T scalar, const tVec3<T> &rhs) {
 
     return tVec3<T>(
       scalar + rhs.x,
@@ -604,7 +597,7 @@ namespace fn {
   }
 
   template <typename T>
-  tVec3<T> operator+(const tVec3<T> &lhs, const tVec3<T> &rhs) {
+  constexpr tVec3<T> operator+(const tVec3<T> &lhs, const tVec3<T> &rhs) {
 
     return tVec3<T>(
       lhs.x + rhs.x,
@@ -614,7 +607,7 @@ namespace fn {
   }
 
   template <typename T>
-  tVec3<T> operator-(const tVec3<T> &lhs, T scalar) {
+  constexpr tVec3<T> operator-(const tVec3<T> &lhs, T scalar) {
 
     return tVec3<T>(
       lhs.x - scalar,
@@ -624,7 +617,7 @@ namespace fn {
   }
 
   template <typename T>
-  tVec3<T> operator-(T scalar, const tVec3<T> &rhs) {
+  constexpr tVec3<T> operator-(T scalar, const tVec3<T> &rhs) {
 
     return tVec3<T>(
       scalar - rhs.x,
@@ -634,7 +627,7 @@ namespace fn {
   }
 
   template <typename T>
-  tVec3<T> operator-(const tVec3<T> &lhs, const tVec3<T> &rhs) {
+  constexpr tVec3<T> operator-(const tVec3<T> &lhs, const tVec3<T> &rhs) {
 
     return tVec3<T>(
       lhs.x - rhs.x,
@@ -644,7 +637,7 @@ namespace fn {
   }
 
   template <typename T>
-  tVec3<T> operator*(const tVec3<T> &lhs, T scalar) {
+  constexpr tVec3<T> operator*(const tVec3<T> &lhs, T scalar) {
 
     return tVec3<T>(
       lhs.x * scalar,
@@ -654,7 +647,7 @@ namespace fn {
   }
 
   template <typename T>
-  tVec3<T> operator*(T scalar, const tVec3<T> &rhs) {
+  constexpr tVec3<T> operator*(T scalar, const tVec3<T> &rhs) {
 
     return tVec3<T>(
       scalar * rhs.x,
@@ -664,7 +657,7 @@ namespace fn {
   }
 
   template <typename T>
-  tVec3<T> operator*(const tVec3<T> &lhs, const tVec3<T> &rhs) {
+  constexpr tVec3<T> operator*(const tVec3<T> &lhs, const tVec3<T> &rhs) {
 
     return tVec3<T>(
       lhs.x * rhs.x,
@@ -674,7 +667,7 @@ namespace fn {
   }
 
   template <typename T>
-  tVec3<T> operator/(const tVec3<T> &lhs, T scalar) {
+  constexpr tVec3<T> operator/(const tVec3<T> &lhs, T scalar) {
 
     return tVec3<T>(
       lhs.x / scalar,
@@ -684,7 +677,7 @@ namespace fn {
   }
 
   template <typename T>
-  tVec3<T> operator/(T scalar, const tVec3<T> &rhs) {
+  constexpr tVec3<T> operator/(T scalar, const tVec3<T> &rhs) {
 
     return tVec3<T>(
       scalar / rhs.x,
@@ -694,7 +687,7 @@ namespace fn {
   }
 
   template <typename T>
-  tVec3<T> operator/(const tVec3<T> &lhs, const tVec3<T> &rhs) {
+  constexpr tVec3<T> operator/(const tVec3<T> &lhs, const tVec3<T> &rhs) {
 
     return tVec3<T>(
       lhs.x / rhs.x,
@@ -704,25 +697,25 @@ namespace fn {
   }
 
   template <typename T>
-  bool operator==(const tVec3<T> &lhs, const tVec3<T> &rhs) {
+  constexpr bool operator==(const tVec3<T> &lhs, const tVec3<T> &rhs) {
 
     return (lhs.x == rhs.x) && (lhs.y == rhs.y) && (lhs.z == rhs.z);
   }
 
   template <typename T>
-  bool operator!=(const tVec3<T> &lhs, const tVec3<T> &rhs) {
+  constexpr bool operator!=(const tVec3<T> &lhs, const tVec3<T> &rhs) {
 
     return (lhs.x != rhs.x) || (lhs.y != rhs.y) || (lhs.z != rhs.z);
   }
 
   template <typename T>
-  inline T dotProduct(const tVec3<T> &lhs, const tVec3<T> &rhs) {
+  constexpr T dotProduct(const tVec3<T> &lhs, const tVec3<T> &rhs) {
 
     return lhs.x * rhs.x + lhs.y * rhs.y + lhs.z * rhs.z;
   }
 
   template <typename T>
-  inline tVec3<T> crossProduct(const tVec3<T> &lhs, const tVec3<T> &rhs) {
+  constexpr tVec3<T> crossProduct(const tVec3<T> &lhs, const tVec3<T> &rhs) {
 
     return tVec3<T>(lhs.y * rhs.z - lhs.z * rhs.y,
                     lhs.z * rhs.x - lhs.x * rhs.z,
@@ -730,7 +723,7 @@ namespace fn {
   }
 
   template <typename T>
-  inline void lerp(const tVec3<T> &lhs, const tVec3<T> &rhs, tVec3<T> *out, T val) {
+  constexpr void lerp(const tVec3<T> &lhs, const tVec3<T> &rhs, tVec3<T> *out, T val) {
     /*
     * Linearly interpolates between two vectors.
     * Interpolates between the vectors lhs and rhs by the interpolant t.
@@ -746,27 +739,27 @@ namespace fn {
   }
 
   template <typename T>
-  tVec4<T>::tVec4()
+  constexpr tVec4<T>::tVec4()
     : x(static_cast<T>(0.0f)), y(static_cast<T>(0.0f)), z(static_cast<T>(0.0f)), w(static_cast<T>(0.0f)) { }
 
   template <typename T>
-  tVec4<T>::tVec4(T t_a, T t_b, T t_c, T t_d)
+  constexpr tVec4<T>::tVec4(T t_a, T t_b, T t_c, T t_d)
     : x(static_cast<T>(t_a)), y(static_cast<T>(t_b)), z(static_cast<T>(t_c)), w(static_cast<T>(t_d)) { }
 
   template <typename T>
-  tVec4<T>::tVec4(const tVec3<T> &vec, T t_d)
+  constexpr tVec4<T>::tVec4(const tVec3<T> &vec, T t_d)
     : x(vec.x), y(vec.y), z(vec.z), w(static_cast<T>(t_d)) { }
 
   template <typename T>
-  tVec4<T>::tVec4(const tVec4<T> &rhs)
+  constexpr tVec4<T>::tVec4(const tVec4<T> &rhs)
     : x(rhs.x), y(rhs.y), z(rhs.z), w(rhs.w) { }
 
   template <typename T>
-  tVec4<T>::tVec4(T scalar)
+  constexpr tVec4<T>::tVec4(T scalar)
     : x(scalar), y(scalar), z(scalar), w(scalar) { }
 
   template <typename T>
-  tVec3<T> tVec4<T>::xyz() {
+  constexpr tVec3<T> tVec4<T>::xyz() {
 
     return tVec3<T>(
       x,
@@ -776,7 +769,7 @@ namespace fn {
   }
 
   template <typename T>
-  void tVec4<T>::set(T t_a, T t_b, T t_c, T t_d) {
+  constexpr void tVec4<T>::set(T t_a, T t_b, T t_c, T t_d) {
 
     this->x = static_cast<T>(t_a);
     this->y = static_cast<T>(t_b);
@@ -785,7 +778,7 @@ namespace fn {
   }
 
   template <typename T>
-  tVec4<T>::operator tVec3<T>() {
+  constexpr tVec4<T>::operator tVec3<T>() {
 
     return tVec3<T>(
       x,
@@ -806,7 +799,7 @@ namespace fn {
   }
 
   template <typename T>
-  T tVec4<T>::sqaredLength() const {
+  constexpr T tVec4<T>::sqaredLength() const {
 
     T _x = this->x;
     T _y = this->y;
@@ -823,7 +816,7 @@ namespace fn {
     T _y = this->y;
     T _z = this->z;
     T _w = this->w;
-    T inv_len = 1 / static_cast<float>(sqrt(_x * _x + _y * _y + _z * _z + _w * _w));
+    T inv_len = Math::rsqrt(static_cast<float>(_x * _x + _y * _y + _z * _z + _w * _w));
     _x *= inv_len;
     _y *= inv_len;
     _z *= inv_len;
@@ -834,33 +827,23 @@ namespace fn {
   }
 
   template <typename T>
-  T &tVec4<T>::operator[](unsigned int index) {
+  constexpr T &tVec4<T>::operator[](unsigned int index) {
 
     assert(index < 4);
-
-//        if (index == 0) return x;
-//        if (index == 1) return y;
-//        if (index == 2) return z;
-//        if (index == 3) return w;
-    return (&x)[index];
+    return index == 0 ? x : index == 1 ? y : index == 2 ? z : w;
 
   }
 
   template <typename T>
-  const T &tVec4<T>::operator[](unsigned int index) const {
+  constexpr const T &tVec4<T>::operator[](unsigned int index) const {
 
     assert(index < 4);
-
-//        if (index == 0) return x;
-//        if (index == 1) return y;
-//        if (index == 2) return z;
-//        if (index == 3) return w;
-    return (&x)[index];
+    return index == 0 ? x : index == 1 ? y : index == 2 ? z : w;
   }
 
   template <typename T>
   template <typename U>
-  tVec4<T> &tVec4<T>::operator=(const tVec4<U> &rhs) {
+  constexpr tVec4<T> &tVec4<T>::operator=(const tVec4<U> &rhs) {
 
     this->x = rhs.x;
     this->y = rhs.y;
@@ -872,7 +855,7 @@ namespace fn {
 
   template <typename T>
   template <typename U>
-  tVec4<T> &tVec4<T>::operator+=(U scalar) {
+  constexpr tVec4<T> &tVec4<T>::operator+=(U scalar) {
 
     this->x += scalar;
     this->y += scalar;
@@ -884,7 +867,7 @@ namespace fn {
 
   template <typename T>
   template <typename U>
-  tVec4<T> &tVec4<T>::operator+=(const tVec4<U> &rhs) {
+  constexpr tVec4<T> &tVec4<T>::operator+=(const tVec4<U> &rhs) {
 
     this->x += rhs.x;
     this->y += rhs.y;
@@ -896,7 +879,7 @@ namespace fn {
 
   template <typename T>
   template <typename U>
-  tVec4<T> &tVec4<T>::operator-=(U scalar) {
+  constexpr tVec4<T> &tVec4<T>::operator-=(U scalar) {
 
     this->x -= scalar;
     this->y -= scalar;
@@ -908,19 +891,19 @@ namespace fn {
 
   template <typename T>
   template <typename U>
-  tVec4<T> &tVec4<T>::operator-=(const tVec4<U> &rhs) {
+  constexpr tVec4<T> &tVec4<T>::operator-=(const tVec4<U> &rhs) {
 
     this->x -= rhs.x;
     this->y -= rhs.y;
-    this->z -= rhs.w;
-    this->w -= rhs.z;
+    this->z -= rhs.z;
+    this->w -= rhs.w;
 
     return *this;
   }
 
   template <typename T>
   template <typename U>
-  tVec4<T> &tVec4<T>::operator*=(U scalar) {
+  constexpr tVec4<T> &tVec4<T>::operator*=(U scalar) {
 
     this->x *= scalar;
     this->y *= scalar;
@@ -932,7 +915,7 @@ namespace fn {
 
   template <typename T>
   template <typename U>
-  tVec4<T> &tVec4<T>::operator*=(const tVec4<U> &rhs) {
+  constexpr tVec4<T> &tVec4<T>::operator*=(const tVec4<U> &rhs) {
 
     this->x *= rhs.x;
     this->y *= rhs.y;
@@ -944,7 +927,7 @@ namespace fn {
 
   template <typename T>
   template <typename U>
-  tVec4<T> &tVec4<T>::operator/=(U scalar) {
+  constexpr tVec4<T> &tVec4<T>::operator/=(U scalar) {
 
     this->x /= scalar;
     this->y /= scalar;
@@ -957,7 +940,7 @@ namespace fn {
 
   template <typename T>
   template <typename U>
-  tVec4<T> &tVec4<T>::operator/=(const tVec4<U> &rhs) {
+  constexpr tVec4<T> &tVec4<T>::operator/=(const tVec4<U> &rhs) {
 
     this->x /= rhs.x;
     this->y /= rhs.y;
@@ -968,7 +951,7 @@ namespace fn {
   }
 
   template <typename T>
-  tVec4<T> &tVec4<T>::operator++() {
+  constexpr tVec4<T> &tVec4<T>::operator++() {
 
     ++this->x;
     ++this->y;
@@ -979,7 +962,7 @@ namespace fn {
   }
 
   template <typename T>
-  tVec4<T> &tVec4<T>::operator--() {
+  constexpr tVec4<T> &tVec4<T>::operator--() {
 
     --this->x;
     --this->y;
@@ -989,7 +972,7 @@ namespace fn {
   }
 
   template <typename T>
-  const tVec4<T> tVec4<T>::operator++(int) {
+  constexpr const tVec4<T> tVec4<T>::operator++(int) {
 
     tVec4<T> result(*this);
     ++*this;
@@ -997,7 +980,7 @@ namespace fn {
   }
 
   template <typename T>
-  const tVec4<T> tVec4<T>::operator--(int) {
+  constexpr const tVec4<T> tVec4<T>::operator--(int) {
 
     tVec4<T> result(*this);
     --*this;
@@ -1005,7 +988,7 @@ namespace fn {
   }
 
   template <typename T>
-  tVec4<T> operator+(const tVec4<T> &lhs, T scalar) {
+  constexpr tVec4<T> operator+(const tVec4<T> &lhs, T scalar) {
 
     return tVec4<T>(
       lhs.x + scalar,
@@ -1016,7 +999,7 @@ namespace fn {
   }
 
   template <typename T>
-  tVec4<T> operator+(T scalar, const tVec4<T> &rhs) {
+  constexpr tVec4<T> operator+(T scalar, const tVec4<T> &rhs) {
 
     return tVec4<T>(
       scalar + rhs.x,
@@ -1027,7 +1010,7 @@ namespace fn {
   }
 
   template <typename T>
-  tVec4<T> operator+(const tVec4<T> &lhs, const tVec4<T> &rhs) {
+  constexpr tVec4<T> operator+(const tVec4<T> &lhs, const tVec4<T> &rhs) {
 
     return tVec4<T>(
       lhs.x + rhs.x,
@@ -1038,7 +1021,7 @@ namespace fn {
   }
 
   template <typename T>
-  tVec4<T> operator-(const tVec4<T> &lhs, T scalar) {
+  constexpr tVec4<T> operator-(const tVec4<T> &lhs, T scalar) {
 
     return tVec4<T>(
       lhs.x - scalar,
@@ -1049,7 +1032,7 @@ namespace fn {
   }
 
   template <typename T>
-  tVec4<T> operator-(T scalar, const tVec4<T> &rhs) {
+  constexpr tVec4<T> operator-(T scalar, const tVec4<T> &rhs) {
 
     return tVec4<T>(
       scalar - rhs.x,
@@ -1060,7 +1043,7 @@ namespace fn {
   }
 
   template <typename T>
-  tVec4<T> operator-(const tVec4<T> &lhs, const tVec4<T> &rhs) {
+  constexpr tVec4<T> operator-(const tVec4<T> &lhs, const tVec4<T> &rhs) {
 
     return tVec4<T>(
       lhs.x - rhs.x,
@@ -1071,7 +1054,7 @@ namespace fn {
   }
 
   template <typename T>
-  tVec4<T> operator*(const tVec4<T> &lhs, T scalar) {
+  constexpr tVec4<T> operator*(const tVec4<T> &lhs, T scalar) {
 
     return tVec4<T>(
       lhs.x * scalar,
@@ -1082,7 +1065,7 @@ namespace fn {
   }
 
   template <typename T>
-  tVec4<T> operator*(T scalar, const tVec4<T> &rhs) {
+  constexpr tVec4<T> operator*(T scalar, const tVec4<T> &rhs) {
 
     return tVec4<T>(
       scalar * rhs.x,
@@ -1093,7 +1076,7 @@ namespace fn {
   }
 
   template <typename T>
-  tVec4<T> operator*(const tVec4<T> &lhs, const tVec4<T> &rhs) {
+  constexpr tVec4<T> operator*(const tVec4<T> &lhs, const tVec4<T> &rhs) {
 
     return tVec4<T>(
       lhs.x * rhs.x,
@@ -1104,7 +1087,7 @@ namespace fn {
   }
 
   template <typename T>
-  tVec4<T> operator/(const tVec4<T> &lhs, T scalar) {
+  constexpr tVec4<T> operator/(const tVec4<T> &lhs, T scalar) {
 
     return tVec4<T>(
       lhs.x / scalar,
@@ -1115,7 +1098,7 @@ namespace fn {
   }
 
   template <typename T>
-  tVec4<T> operator/(T scalar, const tVec4<T> &rhs) {
+  constexpr tVec4<T> operator/(T scalar, const tVec4<T> &rhs) {
 
     return tVec4<T>(
       scalar / rhs.x,
@@ -1126,7 +1109,7 @@ namespace fn {
   }
 
   template <typename T>
-  tVec4<T> operator/(const tVec4<T> &lhs, const tVec4<T> &rhs) {
+  constexpr tVec4<T> operator/(const tVec4<T> &lhs, const tVec4<T> &rhs) {
 
     return tVec4<T>(
       lhs.x / rhs.x,
@@ -1137,25 +1120,25 @@ namespace fn {
   }
 
   template <typename T>
-  bool operator==(const tVec4<T> &lhs, const tVec4<T> &rhs) {
+  constexpr bool operator==(const tVec4<T> &lhs, const tVec4<T> &rhs) {
 
     return (lhs.x == rhs.x) && (lhs.y == rhs.y) && (lhs.z == rhs.z) && (lhs.w == rhs.w);
   }
 
   template <typename T>
-  bool operator!=(const tVec4<T> &lhs, const tVec4<T> &rhs) {
+  constexpr bool operator!=(const tVec4<T> &lhs, const tVec4<T> &rhs) {
 
     return (lhs.x != rhs.x) || (lhs.y != rhs.y) || (lhs.z != rhs.z) || (lhs.w != rhs.w);
   }
 
   template <typename T>
-  inline T dotProduct(const tVec4<T> &lhs, const tVec4<T> &rhs) {
+  constexpr T dotProduct(const tVec4<T> &lhs, const tVec4<T> &rhs) {
 
-    return lhs.x * rhs.x + lhs.y * rhs.y * lhs.z * rhs.z + lhs.w * rhs.w;
+    return lhs.x * rhs.x + lhs.y * rhs.y + lhs.z * rhs.z + lhs.w * rhs.w;
   }
 
   template <typename T>
-  inline void lerp(const tVec4<T> &lhs, const tVec4<T> &rhs, tVec4<T> *out, T t) {
+  constexpr void lerp(const tVec4<T> &lhs, const tVec4<T> &rhs, tVec4<T> *out, T t) {
 
     /*
     * Linearly interpolates between two vectors.
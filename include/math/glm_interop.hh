@@ -0,0 +1,126 @@
+/* =======================================================================
+   $File: glm_interop.hh
+   $Date: 16/10/2026
+   $Revision:
+   $Creator: Rostislav Orestis Stelmach
+   $Notice:  This file is a part of Thesis project ( stracer ) for
+   the Technical Educational Institute of Western Macedonia
+   Supervisor: Dr. George Sisias
+   ======================================================================== */
+
+#ifndef PROJECT_GLM_INTEROP_HPP
+#define PROJECT_GLM_INTEROP_HPP
+
+//Engine Internal
+#include "math/matrix.hh"
+#include "math/batch.hh"
+
+//OpenGL Includes
+#include <glm/glm.hpp>
+
+//C++ Includes
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace fn {
+
+  //
+  // Zero copy interop with glm.
+  //
+  // Matrix4 and glm::mat4 are both four columns of four floats, column i at
+  // byte offset 16 * i, and tVec2/3/4 use the same x, y, z, w order as glm.
+  // The asserts below pin that down, so arrays of one can be read as arrays
+  // of the other without converting element by element:
+  //
+  //   glm::mat4* gpu = Math::asGlm(transforms.data());
+  //   Math::inverseBatch(models, inverses, count);     // glm::mat4 arrays
+  //
+  // The only difference is alignment. Matrix4 is 16 byte aligned for the SIMD
+  // kernels, glm::mat4 only 4 unless GLM_FORCE_DEFAULT_ALIGNED_GENTYPES is
+  // set. Viewing fn as glm is therefore always valid, viewing glm as fn needs
+  // a 16 byte aligned address ( checked by assert, see isMatrix4Aligned() ).
+  //
+
+  static_assert(sizeof(Matrix4) == sizeof(glm::mat4) && sizeof(Matrix4) == 16 * sizeof(float),
+                "Matrix4 and glm::mat4 must both be 16 packed floats");
+  static_assert(sizeof(glm::mat4::col_type) == sizeof(Vec4),
+                "Matrix4 and glm::mat4 columns must have the same stride");
+  static_assert(alignof(Matrix4) % alignof(glm::mat4) == 0,
+                "Matrix4 must be at least as aligned as glm::mat4");
+  static_assert(std::is_standard_layout_v<Matrix4> && std::is_standard_layout_v<glm::mat4>,
+                "Matrix4 and glm::mat4 must be standard layout");
+  static_assert(sizeof(Vec2) == sizeof(glm::vec2) && sizeof(Vec3) == sizeof(glm::vec3) &&
+                sizeof(Vec4) == sizeof(glm::vec4),
+                "tVec and glm vectors must have the same size");
+  static_assert(alignof(Vec4) == alignof(glm::vec4) && alignof(Vec3) == alignof(glm::vec3),
+                "tVec and glm vectors must have the same alignment");
+  static_assert(std::is_standard_layout_v<Vec3> && std::is_standard_layout_v<Vec4>,
+                "tVec must be standard layout");
+
+  namespace Math {
+
+    inline bool isMatrix4Aligned(const void* p) noexcept {
+      return reinterpret_cast<std::uintptr_t>(p) % alignof(Matrix4) == 0;
+    }
+
+    /* fn -> glm, always valid */
+
+    inline glm::mat4& asGlm(Matrix4& m) noexcept { return *reinterpret_cast<glm::mat4*>(&m); }
+    inline const glm::mat4& asGlm(const Matrix4& m) noexcept { return *reinterpret_cast<const glm::mat4*>(&m); }
+    inline glm::mat4* asGlm(Matrix4* m) noexcept { return reinterpret_cast<glm::mat4*>(m); }
+    inline const glm::mat4* asGlm(const Matrix4* m) noexcept { return reinterpret_cast<const glm::mat4*>(m); }
+
+    inline glm::vec3& asGlm(Vec3& v) noexcept { return *reinterpret_cast<glm::vec3*>(&v); }
+    inline const glm::vec3& asGlm(const Vec3& v) noexcept { return *reinterpret_cast<const glm::vec3*>(&v); }
+    inline glm::vec4& asGlm(Vec4& v) noexcept { return *reinterpret_cast<glm::vec4*>(&v); }
+    inline const glm::vec4& asGlm(const Vec4& v) noexcept { return *reinterpret_cast<const glm::vec4*>(&v); }
+
+    /* glm -> fn, matrices must be 16 byte aligned */
+
+    inline Matrix4& asMatrix4(glm::mat4& m) noexcept {
+      assert(isMatrix4Aligned(&m));
+      return *reinterpret_cast<Matrix4*>(&m);
+    }
+
+    inline const Matrix4& asMatrix4(const glm::mat4& m) noexcept {
+      assert(isMatrix4Aligned(&m));
+      return *reinterpret_cast<const Matrix4*>(&m);
+    }
+
+    inline Matrix4* asMatrix4(glm::mat4* m) noexcept {
+      assert(isMatrix4Aligned(m));
+      return reinterpret_cast<Matrix4*>(m);
+    }
+
+    inline const Matrix4* asMatrix4(const glm::mat4* m) noexcept {
+      assert(isMatrix4Aligned(m));
+      return reinterpret_cast<const Matrix4*>(m);
+    }
+
+    inline Vec3& asVec3(glm::vec3& v) noexcept { return *reinterpret_cast<Vec3*>(&v); }
+    inline const Vec3& asVec3(const glm::vec3& v) noexcept { return *reinterpret_cast<const Vec3*>(&v); }
+    inline Vec4& asVec4(glm::vec4& v) noexcept { return *reinterpret_cast<Vec4*>(&v); }
+    inline const Vec4& asVec4(const glm::vec4& v) noexcept { return *reinterpret_cast<const Vec4*>(&v); }
+
+    //
+    // The batch operations of math/batch.hh on glm arrays. 16 byte aligned
+    // arrays ( AlignedVector<glm::mat4, 16>, or glm's aligned gentypes ) are
+    // handed to the kernels in place. Anything else goes through a small
+    // aligned staging buffer on the stack, 64 matrices at a time.
+    //
+
+    void multiply(const glm::mat4* lhs, const glm::mat4* rhs, glm::mat4* out, size_t count) noexcept;
+
+    size_t inverseBatch(const glm::mat4* in, glm::mat4* out, size_t count,
+                        bool* singular = nullptr) noexcept;
+    size_t inverseAffineBatch(const glm::mat4* in, glm::mat4* out, size_t count,
+                              bool* singular = nullptr) noexcept;
+
+    void transformPoints(const glm::mat4& m, ConstVec3Stream in, Vec3Stream out, size_t count) noexcept;
+    void transformVectors(const glm::mat4& m, ConstVec3Stream in, Vec3Stream out, size_t count) noexcept;
+  }
+}
+
+#endif //PROJECT_GLM_INTEROP_HPP
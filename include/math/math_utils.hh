@@ -11,6 +11,13 @@
 #ifndef PROJECT_MATHUTILS_HPP
 #define PROJECT_MATHUTILS_HPP
 
+//Engine Internal
+#include "math/simd.hh"
+
+//C++ Includes
+#include <cmath>
+#include <cstddef>
+
 namespace fn {
 
   namespace Math {
@@ -29,6 +36,171 @@ namespace fn {
       return (180 / PI) * radians;
     }
 
+    //
+    // Fast approximations. Maximum absolute error, measured in tests/fast_math.test.cc:
+    //
+    //   fastSin, fastCos, fastSinCos   4e-7 for | x | <= 100, grows with | x | after that
+    //   fastAtan2                      4e-7
+    //   fastAcos                       5e-7, x in [ -1, 1 ]
+    //   fastRsqrt                      4e-7 relative, x > 0
+    //
+    // Batched versions for arrays live in math/batch.hh and share the
+    // polynomials below, so both give the same results within rounding.
+    //
+
+    namespace poly {
+
+      // Two pi split in three ( Cody / Waite ). A and B have 8 and 12 significant
+      // bits, so k * A and k * B are exact for | k | < 4096
+      constexpr float TWO_PI_A = 6.28125f;
+      constexpr float TWO_PI_B = 1.9350051879882812e-3f;
+      constexpr float TWO_PI_C = 3.0199159795074593e-7f;
+      constexpr float INV_TWO_PI = 0.159154943091895336f;
+      constexpr float PI = 3.14159265358979323f;
+      constexpr float HALF_PI = 1.57079632679489661f;
+
+      // Taylor series on [ -pi/2, pi/2 ], x^13 / 13! and x^14 / 14! are below 6e-8
+      constexpr float SIN[] = { 1.0f, -1.0f / 6.0f, 1.0f / 120.0f, -1.0f / 5040.0f,
+                                1.0f / 362880.0f, -1.0f / 39916800.0f };
+      constexpr float COS[] = { 1.0f, -1.0f / 2.0f, 1.0f / 24.0f, -1.0f / 720.0f,
+                                1.0f / 40320.0f, -1.0f / 3628800.0f, 1.0f / 479001600.0f };
+
+      // Abramowitz and Stegun 4.4.49, atan( x ) on [ 0, 1 ] in powers of x^2, error 2e-8
+      constexpr float ATAN[] = { 1.0f, -0.3333314528f, 0.1999355085f, -0.1420889944f,
+                                 0.1065626393f, -0.0752896400f, 0.0429096138f,
+                                 -0.0161657367f, 0.0028662257f };
+
+      // Abramowitz and Stegun 4.4.45, acos( x ) = sqrt( 1 - x ) * p( x ) on [ 0, 1 ], error 2e-8
+      constexpr float ACOS[] = { 1.5707963050f, -0.2145988016f, 0.0889789874f, -0.0501743046f,
+                                 0.0308918810f, -0.0170881256f, 0.0066700901f, -0.0012624911f };
+
+      template <size_t N>
+      constexpr float horner(const float (&c)[N], float x) noexcept {
+        float r = c[N - 1];
+        for ( size_t i = N - 1; i > 0; i-- ) r = r * x + c[i - 1];
+        return r;
+      }
+
+      // x - k * 2pi in [ -pi, pi ], folded into [ -pi/2, pi/2 ]. cos changes sign when folded.
+      inline float fold(float x, float& cosSign) noexcept {
+        const float k = std::nearbyint(x * INV_TWO_PI);
+        x = ((x - k * TWO_PI_A) - k * TWO_PI_B) - k * TWO_PI_C;
+        cosSign = 1.0f;
+        if ( x > HALF_PI ) {
+          x = PI - x;
+          cosSign = -1.0f;
+        } else if ( x < -HALF_PI ) {
+          x = -PI - x;
+          cosSign = -1.0f;
+        }
+        return x;
+      }
+    }
+
+    inline void fastSinCos(float x, float& s, float& c) noexcept {
+      float sign;
+      const float y = poly::fold(x, sign);
+      const float yy = y * y;
+      s = y * poly::horner(poly::SIN, yy);
+      c = sign * poly::horner(poly::COS, yy);
+    }
+
+    inline float fastSin(float x) noexcept {
+      float sign;
+      const float y = poly::fold(x, sign);
+      return y * poly::horner(poly::SIN, y * y);
+    }
+
+    inline float fastCos(float x) noexcept {
+      float sign;
+      const float y = poly::fold(x, sign);
+      return sign * poly::horner(poly::COS, y * y);
+    }
+
+    inline float fastAtan2(float y, float x) noexcept {
+      const float ax = std::fabs(x);
+      const float ay = std::fabs(y);
+      const float hi = ax > ay ? ax : ay;
+      if ( hi == 0.0f ) {
+        return 0.0f;
+      }
+      const float a = (ax > ay ? ay : ax) / hi;
+      float r = a * poly::horner(poly::ATAN, a * a);
+      if ( ay > ax ) r = poly::HALF_PI - r;
+      if ( x < 0.0f ) r = poly::PI - r;
+      return std::signbit(y) ? -r : r;
+    }
+
+    inline float fastAcos(float x) noexcept {
+      const float ax = std::fabs(x);
+      const float r = std::sqrt(1.0f - ax) * poly::horner(poly::ACOS, ax);
+      return x < 0.0f ? poly::PI - r : r;
+    }
+
+    // Hardware estimate refined by one Newton step, exact 1 / sqrt without SSE
+    inline float fastRsqrt(float x) noexcept {
+#if defined(FN_SIMD_SSE41)
+      const float y = _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(x)));
+      return y * (1.5f - 0.5f * x * y * y);
+#else
+      return 1.0f / std::sqrt(x);
+#endif
+    }
+
+    //
+    // Precise or fast per call site: Math::sin( x ) follows the build wide
+    // default ( FAST_MATH option in CMakeLists.txt, FN_FAST_MATH ), while
+    // Math::sin<Precision::Fast>( x ) or <Precision::Precise> pins one call.
+    //
+
+    enum class Precision { Precise, Fast };
+
+#if defined(FN_FAST_MATH)
+    constexpr Precision DEFAULT_PRECISION = Precision::Fast;
+#else
+    constexpr Precision DEFAULT_PRECISION = Precision::Precise;
+#endif
+
+    template <Precision P = DEFAULT_PRECISION>
+    inline float sin(float x) noexcept {
+      if constexpr ( P == Precision::Fast ) return fastSin(x);
+      else return std::sin(x);
+    }
+
+    template <Precision P = DEFAULT_PRECISION>
+    inline float cos(float x) noexcept {
+      if constexpr ( P == Precision::Fast ) return fastCos(x);
+      else return std::cos(x);
+    }
+
+    template <Precision P = DEFAULT_PRECISION>
+    inline void sincos(float x, float& s, float& c) noexcept {
+      if constexpr ( P == Precision::Fast ) {
+        fastSinCos(x, s, c);
+      } else {
+        s = std::sin(x);
+        c = std::cos(x);
+      }
+    }
+
+    template <Precision P = DEFAULT_PRECISION>
+    inline float atan2(float y, float x) noexcept {
+      if constexpr ( P == Precision::Fast ) return fastAtan2(y, x);
+      else return std::atan2(y, x);
+    }
+
+    template <Precision P = DEFAULT_PRECISION>
+    inline float acos(float x) noexcept {
+      if constexpr ( P == Precision::Fast ) return fastAcos(x);
+      else return std::acos(x);
+    }
+
+    template <Precision P = DEFAULT_PRECISION>
+    inline float rsqrt(float x) noexcept {
+      if constexpr ( P == Precision::Fast ) return fastRsqrt(x);
+      else return 1.0f / std::sqrt(x);
+    }
+
   }
 }
 
@@ -0,0 +1,316 @@
+/* =======================================================================
+   $File: matrix.inl
+   $Date: 16/10/2026
+   $Revision:
+   $Creator: Rostislav Orestis Stelmach
+   $Notice:  This file is a part of Thesis project ( stracer ) for
+   the Technical Educational Institute of Western Macedonia
+   Supervisor: Dr. George Sisias
+   ======================================================================== */
+
+//
+// constexpr part of Matrix4: construction, element access and element-wise
+// arithmetic. Products, inverse and transforms go through the SIMD kernels
+// in matrix.cc and are runtime only.
+//
+
+namespace fn {
+
+  constexpr Matrix4::Matrix4()
+    : m{ col_major(1, 0, 0, 0),
+         col_major(0, 1, 0, 0),
+         col_major(0, 0, 1, 0),
+         col_major(0, 0, 0, 1) } { }
+
+  constexpr Matrix4::Matrix4(const Matrix4& rhs)
+    : m{ rhs.m[0], rhs.m[1], rhs.m[2], rhs.m[3] } { }
+
+  constexpr Matrix4::Matrix4(float s)
+    : m{ col_major(s, 0, 0, 0),
+         col_major(0, s, 0, 0),
+         col_major(0, 0, s, 0),
+         col_major(0, 0, 0, s) } { }
+
+  constexpr Matrix4::Matrix4(const col_major& v1, const col_major& v2, const col_major& v3, const col_major& v4)
+    : m{ v1, v2, v3, v4 } { }
+
+  constexpr Matrix4::Matrix4(
+    float x0, float y0, float z0, float w0,
+    float x1, float y1, float z1, float w1,
+    float x2, float y2, float z2, float w2,
+    float x3, float y3, float z3, float w3
+    )
+    : m{ col_major(x0, y0, z0, w0),
+         col_major(x1, y1, z1, w1),
+         col_major(x2, y2, z2, w2),
+         col_major(x3, y3, z3, w3) } { }
+
+  constexpr Matrix4& Matrix4::operator =(const Matrix4& rhs) {
+
+    this->m[0] = rhs.m[0];
+    this->m[1] = rhs.m[1];
+    this->m[2] = rhs.m[2];
+    this->m[3] = rhs.m[3];
+
+    return *this;
+  }
+
+  constexpr Matrix4& Matrix4::operator +=(float scalar) {
+
+    this->m[0] += scalar;
+    this->m[1] += scalar;
+    this->m[2] += scalar;
+    this->m[3] += scalar;
+    return *this;
+  }
+
+  constexpr Matrix4& Matrix4::operator +=(const Matrix4& rhs) {
+
+    this->m[0] += rhs[0];
+    this->m[1] += rhs[1];
+    this->m[2] += rhs[2];
+    this->m[3] += rhs[3];
+    return *this;
+
+  }
+
+  constexpr Matrix4& Matrix4::operator -=(float scalar) {
+
+    this->m[0] -= scalar;
+    this->m[1] -= scalar;
+    this->m[2] -= scalar;
+    this->m[3] -= scalar;
+    return *this;
+  }
+
+  constexpr Matrix4& Matrix4::operator -=(const Matrix4& rhs) {
+
+    this->m[0] -= rhs[0];
+    this->m[1] -= rhs[1];
+    this->m[2] -= rhs[2];
+    this->m[3] -= rhs[3];
+    return *this;
+
+  }
+
+  constexpr Matrix4& Matrix4::operator *=(float scalar) {
+
+    this->m[0] *= scalar;
+    this->m[1] *= scalar;
+    this->m[2] *= scalar;
+    this->m[3] *= scalar;
+    return *this;
+
+  }
+
+  constexpr Matrix4& Matrix4::operator /=(float scalar) {
+
+    this->m[0] /= scalar;
+    this->m[1] /= scalar;
+    this->m[2] /= scalar;
+    this->m[3] /= scalar;
+    return *this;
+  }
+
+  constexpr Matrix4& Matrix4::operator ++() {
+
+    ++this->m[0];
+    ++this->m[1];
+    ++this->m[2];
+    ++this->m[3];
+    return *this;
+  }
+
+  constexpr Matrix4& Matrix4::operator --() {
+
+    --this->m[0];
+    --this->m[1];
+    --this->m[2];
+    --this->m[3];
+    return *this;
+  }
+
+  constexpr const Matrix4 Matrix4::operator ++(int) {
+
+    Matrix4 result(*this);
+    ++*this;
+    return result;
+  }
+
+  constexpr const Matrix4 Matrix4::operator --(int) {
+
+    Matrix4 result(*this);
+    --*this;
+    return result;
+  }
+
+  constexpr Matrix4 Matrix4::operator +() const {
+
+    return *this;
+  }
+
+  constexpr Matrix4 Matrix4::operator -() const {
+
+    return Matrix4(
+      -m[0][0], -m[0][1], -m[0][2], -m[0][3],
+      -m[1][0], -m[1][1], -m[1][2], -m[1][3],
+      -m[2][0], -m[2][1], -m[2][2], -m[2][3],
+      -m[3][0], -m[3][1], -m[3][2], -m[3][3]
+      );
+  }
+
+  constexpr Vec3 Matrix4::getZVector() const {
+
+    return Vec3( this->m[2][0], this->m[2][1], this->m[2][2] );
+  }
+
+  constexpr Vec3 Matrix4::getYVector() const {
+
+    return Vec3( this->m[1][0], this->m[1][1], this->m[1][2] );
+  }
+
+  constexpr Vec3 Matrix4::getXVector() const {
+
+    return Vec3( this->m[0][0], this->m[0][1], this->m[0][2] );
+  }
+
+  constexpr void Matrix4::setXVector(const Vec3& v) {
+
+    this->m[0][0] = v.x;
+    this->m[0][1] = v.y;
+    this->m[0][2] = v.z;
+  }
+
+  constexpr void Matrix4::setYVector(const Vec3& v) {
+
+    this->m[1][0] = v.x;
+    this->m[1][1] = v.y;
+    this->m[1][2] = v.z;
+  }
+
+  constexpr void Matrix4::setZVector(const Vec3& v) {
+
+    this->m[2][0] = v.x;
+    this->m[2][1] = v.y;
+    this->m[2][2] = v.z;
+  }
+
+  constexpr void Matrix4::setIdentity() {
+    this->m[0][0] = 1;
+    this->m[1][1] = 1;
+    this->m[2][2] = 1;
+    this->m[3][3] = 1;
+  }
+
+  constexpr Matrix4 operator +(const Matrix4& lhs, const Matrix4& rhs) {
+
+    return Matrix4(
+      lhs[0] + rhs[0],
+      lhs[1] + rhs[1],
+      lhs[2] + rhs[2],
+      lhs[3] + rhs[3]
+      );
+  }
+
+  constexpr Matrix4 operator +(float scalar, const Matrix4& rhs) {
+
+    return Matrix4(
+      scalar + rhs[0],
+      scalar + rhs[1],
+      scalar + rhs[2],
+      scalar + rhs[3]
+      );
+  }
+
+  constexpr Matrix4 operator +(const Matrix4& lhs, float scalar) {
+
+    return Matrix4(
+      lhs[0] + scalar,
+      lhs[1] + scalar,
+      lhs[2] + scalar,
+      lhs[3] + scalar
+      );
+  }
+
+  constexpr Matrix4 operator -(const Matrix4& lhs, const Matrix4& rhs) {
+
+    return Matrix4(
+      lhs[0] - rhs[0],
+      lhs[1] - rhs[1],
+      lhs[2] - rhs[2],
+      lhs[3] - rhs[3]
+      );
+  }
+
+  constexpr Matrix4 operator -(float scalar, const Matrix4& rhs) {
+
+    return Matrix4(
+      scalar - rhs[0],
+      scalar - rhs[1],
+      scalar - rhs[2],
+      scalar - rhs[3]
+      );
+  }
+
+  constexpr Matrix4 operator -(const Matrix4& lhs, float scalar) {
+
+    return Matrix4(
+      lhs[0] - scalar,
+      lhs[1] - scalar,
+      lhs[2] - scalar,
+      lhs[3] - scalar
+      );
+  }
+
+  constexpr Matrix4 operator *(const Matrix4& lhs, float scalar) {
+
+    return Matrix4(
+      lhs[0] * scalar,
+      lhs[1] * scalar,
+      lhs[2] * scalar,
+      lhs[3] * scalar
+      );
+  }
+
+  constexpr Matrix4 operator *(float scalar, const Matrix4& rhs) {
+
+    return Matrix4(
+      scalar * rhs[0],
+      scalar * rhs[1],
+      scalar * rhs[2],
+      scalar * rhs[3]
+      );
+  }
+
+  constexpr Matrix4 operator /(const Matrix4& lhs, float scalar) {
+
+    return Matrix4(
+      lhs[0] / scalar,
+      lhs[1] / scalar,
+      lhs[2] / scalar,
+      lhs[3] / scalar
+      );
+
+  }
+
+  constexpr Matrix4 operator /(float scalar, const Matrix4& rhs) {
+
+    return Matrix4(
+      scalar / rhs[0],
+      scalar / rhs[1],
+      scalar / rhs[2],
+      scalar / rhs[3]
+      );
+  }
+
+  constexpr bool operator ==(const Matrix4& lhs, const Matrix4& rhs) {
+
+    return (lhs[0] == rhs[0]) && (lhs[1] == rhs[1]) && (lhs[2] == rhs[2]) && (lhs[3] == rhs[3]);
+  }
+
+  constexpr bool operator !=(const Matrix4& lhs, const Matrix4& rhs) {
+
+    return (lhs[0] != rhs[0]) || (lhs[1] != rhs[1]) || (lhs[2] != rhs[2]) || (lhs[3] != rhs[3]);
+  }
+
+}
@@ -13,20 +13,58 @@
 
 //Engine Internal
 #include "math/matrix.hh"
+#include "math/vector_expr.hh"
 
 namespace fn {
 
     namespace Math {
 
-        Matrix4 ortho(const float left, const float right,
-                      const float bottom, const float top);
+        // ortho, scale and translate are constexpr so fixed projections and
+        // static transforms can be folded at compile time. rotate needs trig.
 
-        Matrix4 ortho(const float left, const float right, const float bottom,
-                      const float top, const float zNear, const float zFar);
+        constexpr Matrix4 ortho(const float left, const float right,
+                                const float bottom, const float top)
+        {
+            Matrix4 Result(1);
+            Result[0][0] = (2) / (right - left);
+            Result[1][1] = (2) / (top - bottom);
+            Result[2][2] = - (1);
+            Result[3][0] = - (right + left) / (right - left);
+            Result[3][1] = - (top + bottom) / (top - bottom);
+            return Result;
+        }
 
-        Matrix4 scale(const Matrix4& lhs, const Vec3& rhs);
+        constexpr Matrix4 ortho(const float left, const float right, const float bottom,
+                                const float top, const float zNear, const float zFar)
+        {
+            Matrix4 Result(1.0f);
+            Result[0][0] = (2) / (right - left);
+            Result[1][1] = (2) / (top - bottom);
+            Result[2][2] = - (2) / (zFar - zNear);
+            Result[3][0] = - (right + left) / (right - left);
+            Result[3][1] = - (top + bottom) / (top - bottom);
+            Result[3][2] = - (zFar + zNear) / (zFar - zNear);
+            return Result;
+        }
 
-        Matrix4 translate(const Matrix4& lhs, const Vec3& rhs);
+        constexpr Matrix4 scale(const Matrix4& lhs, const Vec3& rhs)
+        {
+            Matrix4 Result;
+            Result[0] = lhs[0] * rhs[0];
+            Result[1] = lhs[1] * rhs[1];
+            Result[2] = lhs[2] * rhs[2];
+            Result[3] = lhs[3];
+            return Result;
+        }
+
+        constexpr Matrix4 translate(const Matrix4& lhs, const Vec3& rhs)
+        {
+            Matrix4 Result(lhs);
+            // One fused pass instead of five tVec4 temporaries ( see vector_expr.hh )
+            Result[3] = expr::eval(expr::ref(lhs[0]) * rhs[0] + expr::ref(lhs[1]) * rhs[1] +
+                                   expr::ref(lhs[2]) * rhs[2] + lhs[3]);
+            return Result;
+        }
 
         Matrix4 rotate(const Matrix4& lhs, const Vec3& rhs,const float angle);
     }
@@ -0,0 +1,92 @@
+/* =======================================================================
+   $File: quaternion.hh
+   $Date: 16/10/2026
+   $Revision:
+   $Creator: Rostislav Orestis Stelmach
+   $Notice:  This file is a part of Thesis project ( stracer ) for
+   the Technical Educational Institute of Western Macedonia
+   Supervisor: Dr. George Sisias
+   ======================================================================== */
+
+#ifndef PROJECT_QUATERNION_HPP
+#define PROJECT_QUATERNION_HPP
+
+//Engine Internal
+#include "math/matrix.hh"
+
+namespace fn {
+
+  //
+  // Rotation quaternion, ( x, y, z ) is the vector part and w the scalar part.
+  //
+  // Rotations compose right to left like matrices: ( a * b ) applies b first.
+  // Angles are in radians and follow Math::rotate, so
+  // Quat::fromAxisAngle( axis, a ).toMatrix() == Math::rotate( Matrix4(), axis, a ).
+  //
+
+  struct alignas(16) Quat {
+
+    constexpr Quat()
+      : x(0.0f), y(0.0f), z(0.0f), w(1.0f) { }
+    constexpr Quat(float t_x, float t_y, float t_z, float t_w)
+      : x(t_x), y(t_y), z(t_z), w(t_w) { }
+
+    static Quat fromAxisAngle(const Vec3& axis, float angle);
+    // Rotation part of m, which must not contain scale or shear
+    static Quat fromMatrix(const Matrix4& m);
+
+    Matrix4 toMatrix() const;
+
+    constexpr Vec3 xyz() const { return Vec3(x, y, z); }
+    constexpr Quat conjugate() const { return Quat(-x, -y, -z, w); }
+    constexpr float squaredLength() const { return x * x + y * y + z * z + w * w; }
+    float length() const;
+
+    void normalize();
+    Quat normalized() const;
+
+    // Rotates v by this quaternion, which must be normalized
+    Vec3 rotate(const Vec3& v) const;
+
+    float x;
+    float y;
+    float z;
+    float w;
+  };
+
+  constexpr Quat operator *(const Quat& lhs, const Quat& rhs) {
+
+    return Quat(
+      lhs.w * rhs.x + lhs.x * rhs.w + lhs.y * rhs.z - lhs.z * rhs.y,
+      lhs.w * rhs.y - lhs.x * rhs.z + lhs.y * rhs.w + lhs.z * rhs.x,
+      lhs.w * rhs.z + lhs.x * rhs.y - lhs.y * rhs.x + lhs.z * rhs.w,
+      lhs.w * rhs.w - lhs.x * rhs.x - lhs.y * rhs.y - lhs.z * rhs.z
+      );
+  }
+
+  constexpr bool operator ==(const Quat& lhs, const Quat& rhs) {
+
+    return (lhs.x == rhs.x) && (lhs.y == rhs.y) && (lhs.z == rhs.z) && (lhs.w == rhs.w);
+  }
+
+  constexpr bool operator !=(const Quat& lhs, const Quat& rhs) {
+
+    return !(lhs == rhs);
+  }
+
+  constexpr float dotProduct(const Quat& lhs, const Quat& rhs) {
+
+    return lhs.x * rhs.x + lhs.y * rhs.y + lhs.z * rhs.z + lhs.w * rhs.w;
+  }
+
+  namespace Math {
+
+    // Both interpolate along the shortest arc between normalized quaternions.
+    // Batched versions for arrays live in math/batch.hh
+
+    Quat nlerp(const Quat& lhs, const Quat& rhs, float t);
+    Quat slerp(const Quat& lhs, const Quat& rhs, float t);
+  }
+}
+
+#endif //PROJECT_QUATERNION_HPP
@@ -0,0 +1,108 @@
+/* =======================================================================
+   $File: simd.hh
+   $Date: 16/10/2026
+   $Revision:
+   $Creator: Rostislav Orestis Stelmach
+   $Notice:  This file is a part of Thesis project ( stracer ) for
+   the Technical Educational Institute of Western Macedonia
+   Supervisor: Dr. George Sisias
+   ======================================================================== */
+
+#ifndef PROJECT_SIMD_HPP
+#define PROJECT_SIMD_HPP
+
+//
+// Instruction set selection for the math kernels.
+//
+// The level is picked from the compiler flags (see SIMD_SSE41 / SIMD_AVX2
+// options in CMakeLists.txt). SSE4.1 is the baseline, AVX2 and FMA are used
+// on top of it when available. Defining FN_SIMD_SCALAR forces the portable
+// scalar code path everywhere.
+//
+
+#if !defined(FN_SIMD_SCALAR)
+#  if defined(__SSE4_1__)
+#    define FN_SIMD_SSE41 1
+#  endif
+#  if defined(FN_SIMD_SSE41) && defined(__AVX2__)
+#    define FN_SIMD_AVX2 1
+#  endif
+#  if defined(FN_SIMD_SSE41) && defined(__FMA__)
+#    define FN_SIMD_FMA 1
+#  endif
+#endif
+
+#if defined(FN_SIMD_AVX2) || defined(FN_SIMD_FMA)
+#  include <immintrin.h>
+#elif defined(FN_SIMD_SSE41)
+#  include <smmintrin.h>
+#endif
+
+//C++ Includes
+#include <cstddef>
+
+#if defined(FN_SIMD_SSE41)
+// Immediate for _mm_shuffle_ps, lanes are given from x to w
+#  define FN_SHUFFLE(x, y, z, w) _MM_SHUFFLE(w, z, y, x)
+#endif
+
+namespace fn {
+
+  namespace simd {
+
+    // Widest vector register in use, the alignment that lets every kernel
+    // load a full register without crossing a cache line
+#if defined(FN_SIMD_AVX2)
+    constexpr size_t ALIGNMENT = 32;
+#else
+    constexpr size_t ALIGNMENT = 16;
+#endif
+
+#if defined(FN_SIMD_SSE41)
+
+    // a * b + c, fused when the target supports it
+    inline __m128 madd(__m128 a, __m128 b, __m128 c) noexcept {
+#if defined(FN_SIMD_FMA)
+      return _mm_fmadd_ps(a, b, c);
+#else
+      return _mm_add_ps(_mm_mul_ps(a, b), c);
+#endif
+    }
+
+    // c - a * b, fused when the target supports it
+    inline __m128 nmadd(__m128 a, __m128 b, __m128 c) noexcept {
+#if defined(FN_SIMD_FMA)
+      return _mm_fnmadd_ps(a, b, c);
+#else
+      return _mm_sub_ps(c, _mm_mul_ps(a, b));
+#endif
+    }
+
+    template <int X, int Y, int Z, int W>
+    inline __m128 swizzle(__m128 v) noexcept {
+      return _mm_shuffle_ps(v, v, FN_SHUFFLE(X, Y, Z, W));
+    }
+
+    template <int I>
+    inline __m128 splat(__m128 v) noexcept {
+      return _mm_shuffle_ps(v, v, FN_SHUFFLE(I, I, I, I));
+    }
+
+#endif
+
+#if defined(FN_SIMD_AVX2)
+
+    inline __m256 madd(__m256 a, __m256 b, __m256 c) noexcept {
+#if defined(FN_SIMD_FMA)
+      return _mm256_fmadd_ps(a, b, c);
+#else
+      return _mm256_add_ps(_mm256_mul_ps(a, b), c);
+#endif
+    }
+
+#endif
+
+  }
+}
+
+#endif //PROJECT_SIMD_HPP
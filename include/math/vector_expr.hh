@@ -0,0 +1,237 @@
+/* =======================================================================
+   $File: vector_expr.hh
+   $Date: 16/10/2026
+   $Revision:
+   $Creator: Rostislav Orestis Stelmach
+   $Notice:  This file is a part of Thesis project ( stracer ) for
+   the Technical Educational Institute of Western Macedonia
+   Supervisor: Dr. George Sisias
+   ======================================================================== */
+
+#ifndef PROJECT_VECTOR_EXPR_HPP
+#define PROJECT_VECTOR_EXPR_HPP
+
+//Engine Internal
+#include "math/vector.hh"
+
+//C++ Includes
+#include <type_traits>
+#include <utility>
+
+// The nodes only pay off once inlined, which -Og and -O1 do not do on their own
+#if defined(__GNUC__) || defined(__clang__)
+#  define FN_EXPR_INLINE inline __attribute__((always_inline))
+#elif defined(_MSC_VER)
+#  define FN_EXPR_INLINE __forceinline
+#else
+#  define FN_EXPR_INLINE inline
+#endif
+
+namespace fn {
+
+  //
+  // Opt-in expression templates for tVec2 / tVec3 / tVec4.
+  //
+  // The regular operators in def_vector.hh build a new vector for every +, -,
+  // * and /, which -O1 / -Og builds keep as real temporaries. Wrapping one
+  // operand in expr::ref() makes the whole expression a tree of lightweight
+  // nodes instead, evaluated component by component in a single pass by
+  // expr::eval() or expr::assign(). Nodes are force inlined and components
+  // are picked at compile time, so this holds at -Og as well:
+  //
+  //   Vec4 r = expr::eval(expr::ref(a) * s + expr::ref(b) * t + c);
+  //
+  // Operations are element wise, so a destination may also appear in the
+  // expression. Nodes keep references to the vectors they read: evaluate
+  // them in the same full expression and do not store them in `auto`.
+  //
+
+  namespace expr {
+
+    template <typename E>
+    struct Expression {
+      FN_EXPR_INLINE constexpr const E& self() const noexcept { return static_cast<const E&>(*this); }
+    };
+
+    template <typename V> struct VectorTraits { static constexpr unsigned size = 0; };
+    template <typename T> struct VectorTraits<tVec2<T>> { static constexpr unsigned size = 2; using type = T; };
+    template <typename T> struct VectorTraits<tVec3<T>> { static constexpr unsigned size = 3; using type = T; };
+    template <typename T> struct VectorTraits<tVec4<T>> { static constexpr unsigned size = 4; using type = T; };
+
+    template <unsigned N, typename T> struct VectorOf;
+    template <typename T> struct VectorOf<2, T> { using type = tVec2<T>; };
+    template <typename T> struct VectorOf<3, T> { using type = tVec3<T>; };
+    template <typename T> struct VectorOf<4, T> { using type = tVec4<T>; };
+
+    // Component I by name, tVec::operator[] is a runtime switch that -Og keeps
+    template <unsigned I, typename V>
+    FN_EXPR_INLINE constexpr auto& component(V& v) noexcept {
+      if constexpr ( I == 0 ) return v.x;
+      else if constexpr ( I == 1 ) return v.y;
+      else if constexpr ( I == 2 ) return v.z;
+      else return v.w;
+    }
+
+    template <typename V>
+    class Ref : public Expression<Ref<V>> {
+    public:
+      using value_type = typename VectorTraits<V>::type;
+      static constexpr unsigned size = VectorTraits<V>::size;
+
+      FN_EXPR_INLINE constexpr explicit Ref(const V& v) noexcept : m_v(v) { }
+      template <unsigned I>
+      FN_EXPR_INLINE constexpr value_type at() const noexcept { return component<I>(m_v); }
+
+    private:
+      const V& m_v;
+    };
+
+    // A scalar operand, the same value in every component
+    template <typename T>
+    class Scalar : public Expression<Scalar<T>> {
+    public:
+      using value_type = T;
+      static constexpr unsigned size = 0;
+
+      FN_EXPR_INLINE constexpr explicit Scalar(T v) noexcept : m_v(v) { }
+      template <unsigned>
+      FN_EXPR_INLINE constexpr T at() const noexcept { return m_v; }
+
+    private:
+      T m_v;
+    };
+
+    struct Add { template <typename T> FN_EXPR_INLINE static constexpr T apply(T a, T b) { return a + b; } };
+    struct Sub { template <typename T> FN_EXPR_INLINE static constexpr T apply(T a, T b) { return a - b; } };
+    struct Mul { template <typename T> FN_EXPR_INLINE static constexpr T apply(T a, T b) { return a * b; } };
+    struct Div { template <typename T> FN_EXPR_INLINE static constexpr T apply(T a, T b) { return a / b; } };
+
+    // LS and RS are `const Node&` for sub-expressions, which live until the
+    // end of the full expression, or a Ref / Scalar held by value
+    template <typename Op, typename LS, typename RS>
+    class Binary : public Expression<Binary<Op, LS, RS>> {
+      using L = std::decay_t<LS>;
+      using R = std::decay_t<RS>;
+
+    public:
+      using value_type = std::common_type_t<typename L::value_type, typename R::value_type>;
+      static constexpr unsigned size = L::size > R::size ? L::size : R::size;
+      static_assert(L::size == 0 || R::size == 0 || L::size == R::size,
+                    "vector expressions must have the same number of components");
+
+      FN_EXPR_INLINE constexpr Binary(const L& l, const R& r) noexcept : m_l(l), m_r(r) { }
+      template <unsigned I>
+      FN_EXPR_INLINE constexpr value_type at() const {
+        return Op::apply(static_cast<value_type>(m_l.template at<I>()),
+                         static_cast<value_type>(m_r.template at<I>()));
+      }
+
+    private:
+      LS m_l;
+      RS m_r;
+    };
+
+    template <typename E>
+    class Negate : public Expression<Negate<E>> {
+    public:
+      using value_type = typename E::value_type;
+      static constexpr unsigned size = E::size;
+
+      FN_EXPR_INLINE constexpr explicit Negate(const E& e) noexcept : m_e(e) { }
+      template <unsigned I>
+      FN_EXPR_INLINE constexpr value_type at() const { return -m_e.template at<I>(); }
+
+    private:
+      const E& m_e;
+    };
+
+    template <typename V>
+    FN_EXPR_INLINE constexpr Ref<V> ref(const V& v) noexcept {
+      static_assert(VectorTraits<V>::size != 0, "expr::ref takes a tVec2, tVec3 or tVec4");
+      return Ref<V>(v);
+    }
+
+    // Temporaries would dangle once the full expression ends
+    template <typename V>
+    Ref<V> ref(const V&& v) = delete;
+
+    template <typename X>
+    constexpr bool isExpression = std::is_base_of_v<Expression<X>, X>;
+
+    template <typename X>
+    constexpr bool isOperand = isExpression<X> || VectorTraits<X>::size != 0 || std::is_arithmetic_v<X>;
+
+    // How a Binary holds each operand: expressions by reference, so -Og does
+    // not copy the tree at every level, vectors and scalars as a new node
+    template <typename X>
+    using Stored = std::conditional_t<isExpression<X>, const X&,
+                                      std::conditional_t<std::is_arithmetic_v<X>, Scalar<X>, Ref<X>>>;
+
+    // At least one side must already be an expression, so plain tVec
+    // arithmetic keeps using the operators of def_vector.hh
+    template <typename L, typename R>
+    using EnableBinary = std::enable_if_t<(isExpression<L> || isExpression<R>) &&
+                                          isOperand<L> && isOperand<R>, int>;
+
+    template <typename Op, typename L, typename R>
+    FN_EXPR_INLINE constexpr auto binary(const L& l, const R& r) noexcept {
+      return Binary<Op, Stored<L>, Stored<R>>(Stored<L>(l), Stored<R>(r));
+    }
+
+    template <typename L, typename R, EnableBinary<L, R> = 0>
+    FN_EXPR_INLINE constexpr auto operator+(const L& l, const R& r) noexcept { return binary<Add>(l, r); }
+
+    template <typename L, typename R, EnableBinary<L, R> = 0>
+    FN_EXPR_INLINE constexpr auto operator-(const L& l, const R& r) noexcept { return binary<Sub>(l, r); }
+
+    template <typename L, typename R, EnableBinary<L, R> = 0>
+    FN_EXPR_INLINE constexpr auto operator*(const L& l, const R& r) noexcept { return binary<Mul>(l, r); }
+
+    template <typename L, typename R, EnableBinary<L, R> = 0>
+    FN_EXPR_INLINE constexpr auto operator/(const L& l, const R& r) noexcept { return binary<Div>(l, r); }
+
+    template <typename E>
+    FN_EXPR_INLINE constexpr Negate<E> operator-(const Expression<E>& e) noexcept { return Negate<E>(e.self()); }
+
+    template <typename E, unsigned... I>
+    FN_EXPR_INLINE constexpr auto evalComponents(const E& e, std::integer_sequence<unsigned, I...>) {
+      return typename VectorOf<E::size, typename E::value_type>::type(e.template at<I>()...);
+    }
+
+    template <typename V, typename E, unsigned... I>
+    FN_EXPR_INLINE constexpr void assignComponents(V& dst, const E& e, std::integer_sequence<unsigned, I...>) {
+      using T = typename VectorTraits<V>::type;
+      const T values[] = { static_cast<T>(e.template at<I>())... };
+      ((component<I>(dst) = values[I]), ...);
+    }
+
+    // Evaluates the whole tree into a new vector
+    template <typename E>
+    FN_EXPR_INLINE constexpr auto eval(const Expression<E>& e) {
+      static_assert(E::size != 0, "a vector expression needs at least one vector operand");
+      return evalComponents(e.self(), std::make_integer_sequence<unsigned, E::size>());
+    }
+
+    // Evaluates into an existing vector, which may appear in the expression
+    template <typename V, typename E>
+    FN_EXPR_INLINE constexpr V& assign(V& dst, const Expression<E>& e) {
+      static_assert(VectorTraits<V>::size == E::size, "vector expressions must have the same number of components");
+      assignComponents(dst, e.self(), std::make_integer_sequence<unsigned, E::size>());
+      return dst;
+    }
+
+    template <typename L, typename R, unsigned... I>
+    FN_EXPR_INLINE constexpr auto dotComponents(const L& l, const R& r, std::integer_sequence<unsigned, I...>) {
+      return (... + (l.template at<I>() * r.template at<I>()));
+    }
+
+    // Fused dot product of two expressions, nothing is materialized
+    template <typename L, typename R>
+    FN_EXPR_INLINE constexpr auto dot(const Expression<L>& l, const Expression<R>& r) {
+      static_assert(L::size != 0 && L::size == R::size, "vector expressions must have the same number of components");
+      return dotComponents(l.self(), r.self(), std::make_integer_sequence<unsigned, L::size>());
+    }
+  }
+}
+
+#endif //PROJECT_VECTOR_EXPR_HPP
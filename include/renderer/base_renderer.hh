@@ -1,8 +1,11 @@
 #pragma once
 
+#include "core/frame_state.hh"
 
 namespace fn {
 
+  class ResourceManager;
+
   class BaseRenderer {
   public:
     BaseRenderer() noexcept;
@@ -10,14 +13,30 @@ namespace fn {
     virtual void initRenderer() noexcept = 0;
     virtual void initWindow() noexcept = 0;
     virtual void cleanUp() noexcept = 0;
-    virtual void render( float dt ) noexcept = 0;
+
+    /// Advances the simulation by one fixed step of dt seconds. Always runs
+    /// on the thread that created the window, it may poll events.
     virtual void update( float dt ) noexcept = 0;
 
+    /// Copies what render() needs out of the simulation, on the same thread
+    /// as update(). frame keeps its contents from the last time it was used.
+    virtual void captureFrame( FrameState &frame ) noexcept = 0;
+
+    /// Draws a captured frame. In pipelined mode this runs on the render
+    /// thread, concurrently with update() and captureFrame() of the next frame.
+    virtual void render( const FrameState &frame ) noexcept = 0;
+
     bool getShouldTerminate() const noexcept {
       return p_shouldTerminate;
     }
 
+    /// Where initRenderer() requests its assets, set by the engine.
+    void setResources( ResourceManager *resources ) noexcept {
+      p_resources = resources;
+    }
+
   protected:
     bool p_shouldTerminate;
+    ResourceManager *p_resources = nullptr;
   };
 }    // namespace fn
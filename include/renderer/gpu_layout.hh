@@ -0,0 +1,272 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <tuple>
+#include <type_traits>
+
+#include "math/affine.hh"
+#include "math/def_matrix.hh"
+#include "math/matrix.hh"
+#include "math/vector.hh"
+
+#include <glm/glm.hpp>
+
+namespace fn {
+
+  template <GpuLayout L, typename... Fields>
+  class GpuStruct;
+
+  namespace gpu {
+
+    enum class Scalar { Float, Int, Uint };
+
+    // What the shader sees: scalar kind, rows and columns. C++ types with
+    // the same shape ( Vec3 and glm::vec3 ) can be written to the same field
+    template <Scalar S, std::size_t Rows, std::size_t Cols>
+    struct Shape {};
+
+    template <typename T> struct ScalarOf;
+    template <> struct ScalarOf<float> { static constexpr Scalar value = Scalar::Float; };
+    template <> struct ScalarOf<std::int32_t> { static constexpr Scalar value = Scalar::Int; };
+    template <> struct ScalarOf<std::uint32_t> { static constexpr Scalar value = Scalar::Uint; };
+
+    template <typename T>
+    struct Type {
+      static_assert( sizeof( T ) == 0, "type has no shader equivalent, see gpu::Type" );
+    };
+
+    // Leaf types are Cols columns of Rows 32 bit scalars, column( v, c )
+    // points at the Rows contiguous values of column c
+    template <typename T, std::size_t Rows, std::size_t Cols = 1>
+    struct LeafType {
+      using scalar = T;
+      using shape = Shape<ScalarOf<T>::value, Rows, Cols>;
+      static constexpr std::size_t rows = Rows;
+      static constexpr std::size_t cols = Cols;
+    };
+
+    template <>
+    struct Type<float> : LeafType<float, 1> {
+      static const void *column( const float &v, std::size_t ) { return &v; }
+    };
+    template <>
+    struct Type<std::int32_t> : LeafType<std::int32_t, 1> {
+      static const void *column( const std::int32_t &v, std::size_t ) { return &v; }
+    };
+    template <>
+    struct Type<std::uint32_t> : LeafType<std::uint32_t, 1> {
+      static const void *column( const std::uint32_t &v, std::size_t ) { return &v; }
+    };
+
+    template <typename T>
+    struct Type<tVec2<T>> : LeafType<T, 2> {
+      static const void *column( const tVec2<T> &v, std::size_t ) { return &v.x; }
+    };
+    template <typename T>
+    struct Type<tVec3<T>> : LeafType<T, 3> {
+      static const void *column( const tVec3<T> &v, std::size_t ) { return &v.x; }
+    };
+    template <typename T>
+    struct Type<tVec4<T>> : LeafType<T, 4> {
+      static const void *column( const tVec4<T> &v, std::size_t ) { return &v.x; }
+    };
+
+    template <glm::length_t N, typename T, glm::precision Q>
+    struct Type<glm::vec<N, T, Q>> : LeafType<T, static_cast<std::size_t>( N )> {
+      static const void *column( const glm::vec<N, T, Q> &v, std::size_t ) { return &v.x; }
+    };
+
+    template <glm::length_t C, glm::length_t R, typename T, glm::precision Q>
+    struct Type<glm::mat<C, R, T, Q>>
+        : LeafType<T, static_cast<std::size_t>( R ), static_cast<std::size_t>( C )> {
+      static const void *column( const glm::mat<C, R, T, Q> &m, std::size_t c ) {
+        return &m[ static_cast<glm::length_t>( c ) ].x;
+      }
+    };
+
+    template <>
+    struct Type<Matrix4> : LeafType<float, 4, 4> {
+      static const void *column( const Matrix4 &m, std::size_t c ) { return m.data() + 4 * c; }
+    };
+
+    template <std::size_t R, std::size_t C>
+    struct Type<tMat<R, C, float>> : LeafType<float, R, C> {
+      static const void *column( const tMat<R, C, float> &m, std::size_t c ) { return m.data() + R * c; }
+    };
+
+    // Three vec4 rows, which the shader reads as the columns of a mat3x4
+    template <>
+    struct Type<Affine3> : LeafType<float, 4, 3> {
+      static const void *column( const Affine3 &m, std::size_t c ) { return m.data() + 4 * c; }
+    };
+
+    constexpr std::size_t roundUp( std::size_t value, std::size_t alignment ) {
+      return ( value + alignment - 1 ) / alignment * alignment;
+    }
+
+    // Base alignment of a vector of n scalars, vec3 aligns like vec4
+    constexpr std::size_t vectorAlignment( std::size_t n ) {
+      return ( n == 1 ? 1 : n == 2 ? 2 : 4 ) * 4;
+    }
+
+    // std140 rounds the alignment of arrays, matrices and structs up to a vec4
+    template <GpuLayout L>
+    constexpr std::size_t aggregateAlignment( std::size_t alignment ) {
+      return L == GpuLayout::Std140 ? roundUp( alignment, 16 ) : alignment;
+    }
+
+    ///
+    /// Alignment and size of T inside a block of layout L, with the rules of
+    /// the GLSL spec ( 4.4 "Uniform and Shader Storage Block Layout
+    /// Qualifiers" ). Matrices are arrays of column vectors, arrays of T are
+    /// declared as T[N] and nested blocks as GpuStruct<L, ...>.
+    ///
+    template <GpuLayout L, typename T>
+    struct Layout {
+      using type = Type<T>;
+      static constexpr std::size_t columnStride =
+          type::cols == 1 ? 4 * type::rows
+                          : roundUp( 4 * type::rows, aggregateAlignment<L>( vectorAlignment( type::rows ) ) );
+      static constexpr std::size_t alignment =
+          type::cols == 1 ? vectorAlignment( type::rows )
+                          : aggregateAlignment<L>( vectorAlignment( type::rows ) );
+      static constexpr std::size_t size = type::cols == 1 ? 4 * type::rows : type::cols * columnStride;
+
+      static void write( unsigned char *dst, const T &value ) noexcept {
+        for ( std::size_t c = 0; c < type::cols; c++ ) {
+          std::memcpy( dst + c * columnStride, type::column( value, c ), 4 * type::rows );
+        }
+      }
+    };
+
+    template <GpuLayout L, typename T, std::size_t N>
+    struct Layout<L, T[ N ]> {
+      using element = Layout<L, T>;
+      static constexpr std::size_t alignment = aggregateAlignment<L>( element::alignment );
+      static constexpr std::size_t stride = roundUp( element::size, alignment );
+      static constexpr std::size_t size = N * stride;
+    };
+
+    template <GpuLayout L, GpuLayout Inner, typename... Fields>
+    struct Layout<L, GpuStruct<Inner, Fields...>> {
+      static_assert( L == Inner, "nested blocks must use the layout of the enclosing block" );
+      static constexpr std::size_t alignment = GpuStruct<Inner, Fields...>::alignment;
+      static constexpr std::size_t size = GpuStruct<Inner, Fields...>::size;
+    };
+
+    template <std::size_t N>
+    struct BlockLayout {
+      std::size_t offsets[ N ];
+      std::size_t alignment;
+      std::size_t size;
+    };
+
+    // Members in declaration order, each on its own alignment, the block
+    // itself aligned like its widest member ( at least a vec4 in std140 )
+    template <GpuLayout L, typename... Fields>
+    constexpr BlockLayout<sizeof...( Fields )> computeLayout() {
+      const std::size_t alignments[] = {Layout<L, Fields>::alignment...};
+      const std::size_t sizes[] = {Layout<L, Fields>::size...};
+
+      BlockLayout<sizeof...( Fields )> result = {};
+      std::size_t end = 0, alignment = 4;
+      for ( std::size_t i = 0; i < sizeof...( Fields ); i++ ) {
+        result.offsets[ i ] = roundUp( end, alignments[ i ] );
+        end = result.offsets[ i ] + sizes[ i ];
+        alignment = alignments[ i ] > alignment ? alignments[ i ] : alignment;
+      }
+      result.alignment = aggregateAlignment<L>( alignment );
+      result.size = roundUp( end, result.alignment );
+      return result;
+    }
+
+    template <typename Field, typename Value>
+    constexpr bool sameShape = std::is_same_v<typename Type<Field>::shape, typename Type<Value>::shape>;
+
+  }    // namespace gpu
+
+  ///
+  /// Compile time description of a std140 / std430 shader block.
+  ///
+  /// Fields are listed in declaration order and addressed by index, usually
+  /// through an enum. Offsets, alignment and size are computed at compile
+  /// time and values are written straight into mapped memory, one field at a
+  /// time, so no C++ mirror struct with hand written padding is needed:
+  ///
+  ///   enum { Model, Tint, Bones };
+  ///   using Object = GpuStruct<GpuLayout::Std140, glm::mat4, Vec3, Affine3[ 64 ]>;
+  ///   static_assert( Object::hasOffsets<0, 64, 80>() );   // the shader's offsets
+  ///
+  ///   Object::write<Model>( mapped, model );
+  ///   Object::write<Bones>( mapped, i, bones[ i ] );
+  ///
+  /// Writing a value whose shader shape differs from the field ( a Vec4 into
+  /// a vec3, a Matrix4 into a mat3 ) does not compile. Padding bytes are left
+  /// untouched.
+  ///
+  template <GpuLayout L, typename... Fields>
+  class GpuStruct {
+    static_assert( sizeof...( Fields ) > 0, "a shader block needs at least one field" );
+
+    static constexpr gpu::BlockLayout<sizeof...( Fields )> computed = gpu::computeLayout<L, Fields...>();
+
+  public:
+    static constexpr GpuLayout layout = L;
+    static constexpr std::size_t fieldCount = sizeof...( Fields );
+    static constexpr std::size_t alignment = computed.alignment;
+
+    /// Bytes of one block, also the stride of a std430 array of blocks.
+    static constexpr std::size_t size = computed.size;
+
+    template <std::size_t I>
+    using FieldType = std::tuple_element_t<I, std::tuple<Fields...>>;
+
+    template <std::size_t I>
+    static constexpr std::size_t offset() {
+      static_assert( I < fieldCount, "field index out of range" );
+      return computed.offsets[ I ];
+    }
+
+    /// True when the fields sit at exactly these offsets, for checking a
+    /// block against the offsets of the shader.
+    template <std::size_t... Offsets>
+    static constexpr bool hasOffsets() {
+      static_assert( sizeof...( Offsets ) == fieldCount, "one offset per field" );
+      const std::size_t expected[] = {Offsets...};
+      for ( std::size_t i = 0; i < fieldCount; i++ ) {
+        if ( computed.offsets[ i ] != expected[ i ] ) return false;
+      }
+      return true;
+    }
+
+    /// Start of field I, nested blocks are written through it.
+    template <std::size_t I>
+    static void *field( void *block ) noexcept {
+      return static_cast<unsigned char *>( block ) + offset<I>();
+    }
+
+    template <std::size_t I, typename V>
+    static void write( void *block, const V &value ) noexcept {
+      using F = FieldType<I>;
+      static_assert( !std::is_array_v<F>, "array fields are written one element at a time" );
+      static_assert( gpu::sameShape<F, V>, "value does not have the shader type of the field" );
+      gpu::Layout<L, V>::write( static_cast<unsigned char *>( field<I>( block ) ), value );
+    }
+
+    /// Writes element `index` of the array field I.
+    template <std::size_t I, typename V>
+    static void write( void *block, std::size_t index, const V &value ) noexcept {
+      using F = FieldType<I>;
+      static_assert( std::is_array_v<F>, "field is not an array" );
+      using E = std::remove_extent_t<F>;
+      static_assert( gpu::sameShape<E, V>, "value does not have the shader type of the array elements" );
+      assert( index < std::extent_v<F> );
+      unsigned char *dst = static_cast<unsigned char *>( field<I>( block ) );
+      gpu::Layout<L, V>::write( dst + index * gpu::Layout<L, F>::stride, value );
+    }
+  };
+
+}    // namespace fn
@@ -0,0 +1,141 @@
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include <vulkan/vulkan.h>
+
+namespace fn {
+
+  /// GPU time of a named region, from the last results that came back.
+  struct GpuRegion {
+    const char *name;
+    double milliseconds;
+  };
+
+  /// Pipeline statistics of the draws of the last frame that came back.
+  struct GpuStatistics {
+    uint64_t inputVertices = 0;
+    uint64_t vertexInvocations = 0;
+    uint64_t clippingInvocations = 0;
+    uint64_t clippingPrimitives = 0;
+    uint64_t fragmentInvocations = 0;
+  };
+
+  ///
+  /// Timestamp and pipeline statistics queries around named regions of
+  /// command buffers.
+  ///
+  ///   profiler.reset( commandBuffer, image );
+  ///   uint32_t pass = profiler.begin( commandBuffer, image, "GPU render pass" );
+  ///   vkCmdBeginRenderPass( ... );
+  ///   profiler.beginStatistics( commandBuffer, image );
+  ///   vkCmdDrawIndexed( ... );
+  ///   profiler.endStatistics( commandBuffer, image );
+  ///   vkCmdEndRenderPass( ... );
+  ///   profiler.end( commandBuffer, image, pass );
+  ///   ...
+  ///   profiler.collect( image );    // before the next submit
+  ///   vkQueueSubmit( ... );
+  ///   profiler.submitted( image );
+  ///
+  /// Every command buffer that is recorded once and submitted again and
+  /// again writes a query pool of its own, and single time commands share
+  /// the IMMEDIATE one. collect() polls the results of the last submit of a
+  /// pool and returns at once if the GPU is not done with them, it never
+  /// stalls. Results are kept per region name and sent to the CPU profiler
+  /// as counters, so a capture shows GPU milliseconds next to the scopes.
+  ///
+  /// Timestamps are left out on queues without timestamp support, pipeline
+  /// statistics unless the device has the pipelineStatisticsQuery feature
+  /// enabled.
+  ///
+  class GpuProfiler {
+  public:
+    static constexpr uint32_t MAX_REGIONS = 16;
+
+    /// Pool of the single time commands, waited for right after submitting.
+    static constexpr uint32_t IMMEDIATE = ~0u;
+
+    GpuProfiler() noexcept = default;
+    ~GpuProfiler() noexcept = default;
+
+    GpuProfiler( const GpuProfiler & ) = delete;
+    GpuProfiler &operator=( const GpuProfiler & ) = delete;
+
+    /// The query pools are created and destroyed with `allocator`.
+    void create( VkPhysicalDevice physicalDevice, VkDevice device, uint32_t queueFamily, bool pipelineStatistics,
+                 const VkAllocationCallbacks *allocator = nullptr ) noexcept;
+    void destroy() noexcept;
+
+    /// Pools of command buffers 0 to count - 1, with no results yet.
+    void setFrameCount( uint32_t count ) noexcept;
+
+    bool hasTimestamps() const noexcept {
+      return m_timestampPeriod > 0.0;
+    }
+
+    bool hasStatistics() const noexcept {
+      return m_statistics;
+    }
+
+    /// Outside of a render pass, before the first region of the pool.
+    void reset( VkCommandBuffer commandBuffer, uint32_t pool ) noexcept;
+
+    /// The returned region is closed by end(), in the same command buffer.
+    uint32_t begin( VkCommandBuffer commandBuffer, uint32_t pool, const char *name,
+                    VkPipelineStageFlagBits stage = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT ) noexcept;
+    void end( VkCommandBuffer commandBuffer, uint32_t pool, uint32_t region,
+              VkPipelineStageFlagBits stage = VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT ) noexcept;
+
+    /// Both inside or both outside of the same render pass.
+    void beginStatistics( VkCommandBuffer commandBuffer, uint32_t pool ) noexcept;
+    void endStatistics( VkCommandBuffer commandBuffer, uint32_t pool ) noexcept;
+
+    /// After the command buffer that writes the pool is submitted.
+    void submitted( uint32_t pool ) noexcept;
+
+    /// Takes the results of the last submit of the pool if they are there,
+    /// false while the GPU is still on it.
+    bool collect( uint32_t pool ) noexcept;
+
+    std::vector<GpuRegion> regions() const;
+    GpuStatistics statistics() const;
+
+    /// Logs the last time of every region and the last statistics.
+    void report() const noexcept;
+
+  private:
+    struct Pool {
+      VkQueryPool timestamps = VK_NULL_HANDLE;
+      VkQueryPool statistics = VK_NULL_HANDLE;
+
+      // Names of the regions recorded since the last reset
+      std::vector<const char *> names;
+      bool recordsStatistics = false;
+      bool submitted = false;
+    };
+
+    Pool createPool() noexcept;
+    void destroyPool( Pool &pool ) noexcept;
+    Pool &pool( uint32_t index ) noexcept;
+
+    VkDevice m_device = VK_NULL_HANDLE;
+    const VkAllocationCallbacks *m_allocator = nullptr;
+
+    // Nanoseconds per tick and the bits a timestamp holds, 0 without support
+    double m_timestampPeriod = 0.0;
+    uint64_t m_timestampMask = 0;
+    bool m_statistics = false;
+
+    std::vector<Pool> m_frames;
+    Pool m_immediate;
+
+    // collect() runs on the render thread, readers on any
+    mutable std::mutex m_resultsMutex;
+    std::vector<GpuRegion> m_regions;
+    GpuStatistics m_lastStatistics;
+  };
+
+}    // namespace fn
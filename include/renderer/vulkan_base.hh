@@ -1,14 +1,25 @@
 #pragma once
 
 #include <array>
+#include <atomic>
+#include <cstddef>
 #include <memory>
+#include <memory_resource>
 #include <optional>
 #include <vector>
 
+#include "core/frame_arena.hh"
 #include "core/logger.hh"
 #include "math/matrix.hh"
 #include "math/vector.hh"
 #include "renderer/base_renderer.hh"
+#include "renderer/gpu_layout.hh"
+#include "renderer/gpu_profiler.hh"
+#include "renderer/vulkan_host_allocator.hh"
+#include "resources/model.hh"
+#include "resources/resource_manager.hh"
+#include "resources/shader.hh"
+#include "resources/texture.hh"
 
 #define GLFW_INCLUDE_VULKAN
 #include <GLFW/glfw3.h>
@@ -91,9 +102,12 @@ namespace fn {
   };
 
   struct SwapChainSupportDetails {
+    explicit SwapChainSupportDetails( std::pmr::memory_resource *memory ) noexcept
+        : formats( memory ), presentModes( memory ) {}
+
     VkSurfaceCapabilitiesKHR capabilities;
-    std::vector<VkSurfaceFormatKHR> formats;
-    std::vector<VkPresentModeKHR> presentModes;
+    std::pmr::vector<VkSurfaceFormatKHR> formats;
+    std::pmr::vector<VkPresentModeKHR> presentModes;
   };
 
 
@@ -127,12 +141,18 @@ namespace fn {
     }
 
   private:
+    // Host memory of the driver, passed to every create and destroy call,
+    // so it is declared before and destroyed after everything it allocates for
+    VulkanHostAllocator m_hostAllocator;
+
     GLFWwindow *m_window;
     std::shared_ptr<Settings> m_settings;
     VkInstance m_instance;
 
     IOManager *m_iomanager = nullptr;
     Camera *m_camera = nullptr;
+    // The camera before the last update step, interpolated from by render()
+    CameraState m_previousCamera;
 
     VkDebugUtilsMessengerEXT m_debugMessenger;
 
@@ -190,6 +210,12 @@ namespace fn {
     VkDescriptorPool m_descriptorPool;
     std::vector<VkDescriptorSet> m_descriptorSets;
 
+    // Requested first thing in initRenderer(), waited for where they are used
+    Handle<Shader> m_vertexShader;
+    Handle<Shader> m_fragmentShader;
+    Handle<Texture> m_texture;
+    Handle<Model> m_model;
+
     uint32_t m_mipLevels;
     VkImage m_textureImage;
     VkDeviceMemory m_textureImageMemory;
@@ -221,23 +247,42 @@ namespace fn {
     // Fences are used for CPU-GPU Synchronization
     std::vector<VkFence> m_inFlightFences;
 
+    // Transient allocations of each frame in flight, reset once its fence
+    // has signaled, so nothing the GPU may still read is reused
+    std::array<FrameArena, MAX_FRAMES_IN_FLIGHT> m_frameArenas;
+
+    // GPU time of the render pass, the draws and the uploads, one query pool
+    // per command buffer, polled before the command buffer is submitted again
+    GpuProfiler m_gpuProfiler;
+
+    // Region of the single time commands being recorded, if any
+    uint32_t m_immediateRegion = GpuProfiler::MAX_REGIONS;
+
     // To use the right pair of semaphores every time, we need to keep track
     // of current frame
     size_t m_currentFrame = 0;
-    bool m_frameBufferHasResized = false;
+
+    // Set by the GLFW callback on the main thread, read by render()
+    std::atomic<bool> m_frameBufferHasResized{false};
+
+    // Framebuffer size of the frame being rendered, render() never asks GLFW
+    // since it may run on the render thread
+    VkExtent2D m_framebufferSize = {0, 0};
 
     const std::vector<const char *> m_validationLayers = {"VK_LAYER_LUNARG_standard_validation"};
 
     const std::vector<const char *> m_deviceExtensions = {VK_KHR_SWAPCHAIN_EXTENSION_NAME};
 
-    struct UniformBufferObject {
-      glm::mat4 model;
-      glm::mat4 view;
-      glm::mat4 proj;
-    };
+    // The std140 block of texture.vert, written field by field into mapped memory
+    enum UniformField { UniformModel, UniformView, UniformProj };
+    using UniformBufferObject = GpuStruct<GpuLayout::Std140, glm::mat4, glm::mat4, glm::mat4>;
+    static_assert( UniformBufferObject::hasOffsets<0, 64, 128>() && UniformBufferObject::size == 192,
+                   "UniformBufferObject must match the std140 layout of the shader" );
 
+    // Host copies of the model, released once they are in device memory
     std::vector<Vertex> vertices;
     std::vector<uint32_t> indices;
+    uint32_t m_indexCount = 0;
 
     VkBuffer vertexBuffer;
     VkDeviceMemory vertexBufferMemory;
@@ -247,13 +292,26 @@ namespace fn {
     //    void mainLoop() noexcept;
     void cleanUp() noexcept override;
 
-    void render( float dt ) noexcept override;
     void update( float dt ) noexcept override;
+    void captureFrame( FrameState &frame ) noexcept override;
+    void render( const FrameState &frame ) noexcept override;
 
     GLFWwindow *getWindow() noexcept {
       return m_window;
     }
 
+    const GpuProfiler &getGpuProfiler() const noexcept {
+      return m_gpuProfiler;
+    }
+
+    const VulkanHostAllocator &getHostAllocator() const noexcept {
+      return m_hostAllocator;
+    }
+
+    const VkAllocationCallbacks *hostAllocator() const noexcept {
+      return m_hostAllocator.callbacks();
+    }
+
     void createInstance() noexcept;
     void setupDebugMessenger() noexcept;
     void createSurface() noexcept;
@@ -283,7 +341,8 @@ namespace fn {
     void createUniformBuffers() noexcept;
     void createDescriptorPool() noexcept;
     void createDescriptorSets() noexcept;
-    void updateuniformbuffers( uint32_t currentimage ) noexcept;
+    void updateuniformbuffers( uint32_t currentimage, const FrameState &frame ) noexcept;
+    void moveCamera( float dt ) noexcept;
 
     void createTextureImage() noexcept;
     void createImage( uint32_t width, uint32_t height, uint32_t mipLevels, VkSampleCountFlagBits numSamples, VkFormat format,
@@ -300,29 +359,35 @@ namespace fn {
                                   VkFormatFeatureFlags features ) noexcept;
     VkFormat findDepthFormat() noexcept;
     bool hasStencilComponent( VkFormat format ) noexcept;
-    void drawFrame() noexcept;
+    void drawFrame( const FrameState &frame ) noexcept;
 
     ///@Fix -> maybe move this function out of class.
     /// it is not uses any class memebers anyways
-    VkShaderModule createShaderModule( const std::vector<char> &code ) const noexcept;
+    VkShaderModule createShaderModule( const std::vector<uint32_t> &code ) const noexcept;
 
     ///@Fix -> maybe move this function outside class?
     bool isDeviceSuitable( VkPhysicalDevice device ) const noexcept;
 
     QueueFamilyIndices findQueueFamilies( VkPhysicalDevice device ) const noexcept;
-    SwapChainSupportDetails querySwapChainSupport( VkPhysicalDevice device ) const noexcept;
+    SwapChainSupportDetails querySwapChainSupport(
+        VkPhysicalDevice device,
+        std::pmr::memory_resource *memory = std::pmr::get_default_resource() ) const noexcept;
+
+    FrameArena &frameArena() noexcept {
+      return m_frameArenas[ m_currentFrame ];
+    }
 
     // Surface format, represents the color depth, e.g color channels and
     // types, also color space
     VkSurfaceFormatKHR
-    chooseSwapSurfaceFormat( const std::vector<VkSurfaceFormatKHR> &availableFormats ) const
+    chooseSwapSurfaceFormat( const std::pmr::vector<VkSurfaceFormatKHR> &availableFormats ) const
         noexcept;
 
     // The presenation mode is arguably the most important setting for the swap
     // chain, because it represents the actual conditions for showing images to
     // the screen
     VkPresentModeKHR
-    chooseSwapPresentMode( const std::vector<VkPresentModeKHR> &availablePresentModes ) const
+    chooseSwapPresentMode( const std::pmr::vector<VkPresentModeKHR> &availablePresentModes ) const
         noexcept;
 
     // The swap extent is the resolution of images in the swap chain
@@ -335,7 +400,8 @@ namespace fn {
 
     uint32_t findMemoryType( uint32_t typeFilter, VkMemoryPropertyFlags properties ) const noexcept;
 
-    VkCommandBuffer beginSingleTimeCommands() noexcept;
+    // A named region is timed on the GPU, collected once the commands ran
+    VkCommandBuffer beginSingleTimeCommands( const char *gpuRegion = nullptr ) noexcept;
     void endSingleTimeCommands( VkCommandBuffer commandBuffer ) noexcept;
     void transitionImageLayout( VkImage image, VkFormat format, VkImageLayout oldlayout,
                                 VkImageLayout newlayout, uint32_t mipLevels ) noexcept;
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+#include <vulkan/vulkan.h>
+
+#include "core/frame_arena.hh"
+#include "core/memory_tracker.hh"
+
+namespace fn {
+
+  ///
+  /// VkAllocationCallbacks that count the host memory of the driver per
+  /// VkSystemAllocationScope and charge it to MemoryTag::Renderer.
+  ///
+  ///   vkCreateDevice( physicalDevice, &createInfo, m_hostAllocator.callbacks(), &m_device );
+  ///   ...
+  ///   vkDestroyDevice( m_device, m_hostAllocator.callbacks() );
+  ///
+  /// An object has to be destroyed with callbacks compatible with the ones it
+  /// was created with, so every create and destroy call goes through the same
+  /// allocator, and the allocator outlives the instance.
+  ///
+  /// With recycling on, allocations of the command scope, which live for the
+  /// duration of the call that makes them, are bumped out of an arena that is
+  /// reset whenever none of them is live. Small blocks of the object scope go
+  /// back to free lists per size class, so recreating the swap chain takes
+  /// the blocks of the objects it just destroyed instead of the heap's.
+  ///
+  class VulkanHostAllocator {
+  public:
+    static constexpr std::size_t SCOPE_COUNT = VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE + 1;
+
+    explicit VulkanHostAllocator( bool recycle = true );
+    ~VulkanHostAllocator() noexcept;
+
+    VulkanHostAllocator( const VulkanHostAllocator & ) = delete;
+    VulkanHostAllocator &operator=( const VulkanHostAllocator & ) = delete;
+
+    const VkAllocationCallbacks *callbacks() const noexcept {
+      return &m_callbacks;
+    }
+
+    /// Blocks the driver holds in a scope, the budget is not used.
+    MemoryStats stats( VkSystemAllocationScope scope ) const noexcept;
+
+    /// Bytes the driver allocated itself and only notified us of.
+    std::size_t internalBytes( VkSystemAllocationScope scope ) const noexcept;
+
+    /// Allocations served by the arena or the free lists instead of the heap.
+    std::size_t recycled() const noexcept {
+      return m_recycled.load( std::memory_order_relaxed );
+    }
+
+    /// Logs the bytes, peak and allocation count of every scope.
+    void report() const noexcept;
+
+  private:
+    static constexpr std::size_t COMMAND_ARENA_BYTES = 64 * 1024;
+
+    // Blocks of 64 to 4096 bytes, header included, and the most kept per size
+    static constexpr std::size_t POOL_CLASSES = 7;
+    static constexpr std::size_t POOL_MIN_BYTES = 64;
+    static constexpr std::size_t POOL_MAX_BYTES = POOL_MIN_BYTES << ( POOL_CLASSES - 1 );
+    static constexpr std::size_t POOL_MAX_FREE = 64;
+
+    struct Counters {
+      std::atomic<std::size_t> current{0};
+      std::atomic<std::size_t> peak{0};
+      std::atomic<std::size_t> allocations{0};
+      std::atomic<std::size_t> live{0};
+      std::atomic<std::size_t> internal{0};
+    };
+
+    static VKAPI_ATTR void *VKAPI_CALL allocation( void *userData, std::size_t size, std::size_t alignment,
+                                                   VkSystemAllocationScope scope );
+    static VKAPI_ATTR void *VKAPI_CALL reallocation( void *userData, void *original, std::size_t size,
+                                                     std::size_t alignment, VkSystemAllocationScope scope );
+    static VKAPI_ATTR void VKAPI_CALL free( void *userData, void *memory );
+    static VKAPI_ATTR void VKAPI_CALL internalAllocation( void *userData, std::size_t size,
+                                                          VkInternalAllocationType type,
+                                                          VkSystemAllocationScope scope );
+    static VKAPI_ATTR void VKAPI_CALL internalFree( void *userData, std::size_t size,
+                                                    VkInternalAllocationType type,
+                                                    VkSystemAllocationScope scope );
+
+    void *allocate( std::size_t size, std::size_t alignment, VkSystemAllocationScope scope ) noexcept;
+    void deallocate( void *memory ) noexcept;
+
+    VkAllocationCallbacks m_callbacks;
+    std::array<Counters, SCOPE_COUNT> m_scopes;
+    std::atomic<std::size_t> m_recycled{0};
+
+    bool m_recycle;
+
+    // The arena, its live blocks and the free lists, shared by all threads
+    std::mutex m_mutex;
+    FrameArena m_commandArena;
+    std::size_t m_commandLive = 0;
+    std::array<void *, POOL_CLASSES> m_free{};
+    std::array<std::size_t, POOL_CLASSES> m_freeCount{};
+  };
+
+}    // namespace fn
@@ -0,0 +1,48 @@
+/* =======================================================================
+   $File: model.hh
+   $Date: 16-10-2026
+   $Revision: 16-10-2026
+   $Creator: Orestis Ro Stelmach
+   $Email: stelmach.ro[at]gmail.com
+   $Notice:
+   ======================================================================== */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "resources/resource.hh"
+
+namespace fn {
+
+  /// Indexed triangle mesh of a Wavefront .obj, vertices deduplicated.
+  class Model : public Resource {
+  public:
+    struct Vertex {
+      glm::vec3 position;
+      glm::vec3 color;
+      glm::vec2 texCoord;
+    };
+
+    bool decode( const std::vector<char> &bytes, const std::string &path ) override;
+    std::size_t memoryUsage() const noexcept override;
+
+    const std::vector<Vertex> &vertices() const noexcept {
+      return m_vertices;
+    }
+
+    const std::vector<uint32_t> &indices() const noexcept {
+      return m_indices;
+    }
+
+  private:
+    std::vector<Vertex> m_vertices;
+    std::vector<uint32_t> m_indices;
+  };
+
+}    // namespace fn
@@ -9,15 +9,31 @@
 
 #pragma once
 
+#include <cstddef>
+#include <string>
+#include <vector>
+
 #include "core/object.hh"
 
 namespace fn {
 
+  ///
+  /// Asset built from the bytes of a file. ResourceManager reads the file on
+  /// a loader thread and calls decode() on that same thread, so decode()
+  /// must not touch the renderer: GPU uploads happen later, from the data
+  /// the resource keeps.
+  ///
   class Resource : public Object {
   private:
   public:
     Resource() noexcept;
     virtual ~Resource() noexcept;
+
+    /// Builds the resource, false when the bytes are not a valid asset.
+    virtual bool decode( const std::vector<char> &bytes, const std::string &path ) = 0;
+
+    /// Bytes held by the decoded data, for ResourceStats.
+    virtual std::size_t memoryUsage() const noexcept;
   };
 
 }    // namespace fn
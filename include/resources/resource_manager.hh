@@ -0,0 +1,253 @@
+/* =======================================================================
+   $File: resource_manager.hh
+   $Date: 16-10-2026
+   $Revision: 16-10-2026
+   $Creator: Orestis Ro Stelmach
+   $Email: stelmach.ro[at]gmail.com
+   $Notice:
+   ======================================================================== */
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "core/pool_allocator.hh"
+#include "resources/resource.hh"
+
+namespace fn {
+
+  /// Order in which queued resources are picked up by the loader threads.
+  enum class ResourcePriority : uint8_t { Low, Normal, High, Critical };
+
+  enum class ResourceState : uint8_t {
+    /// Waiting for a loader thread.
+    Queued,
+    Loading,
+    Ready,
+    /// The file could not be read or decoded.
+    Failed,
+    /// The handle is stale, its resource has been unloaded.
+    Invalid
+  };
+
+  ///
+  /// Typed reference to a resource of a ResourceManager. The generation
+  /// tells a stale handle from the resource that took its slot.
+  ///
+  template <typename T>
+  struct Handle {
+    uint32_t index = ~0u;
+    uint32_t generation = 0;
+
+    bool isValid() const noexcept {
+      return index != ~0u;
+    }
+
+    friend bool operator==( Handle a, Handle b ) noexcept {
+      return a.index == b.index && a.generation == b.generation;
+    }
+
+    friend bool operator!=( Handle a, Handle b ) noexcept {
+      return !( a == b );
+    }
+  };
+
+  struct ResourceStats {
+    /// Files read and decoded, and the ones that failed.
+    std::size_t loaded = 0;
+    std::size_t failed = 0;
+
+    /// load() calls answered by a slot of the same path.
+    std::size_t pathHits = 0;
+
+    /// Files whose bytes matched a resident resource, decoded only once.
+    std::size_t contentHits = 0;
+
+    std::size_t unloaded = 0;
+
+    /// Slots in use and the memory of their decoded resources.
+    std::size_t resident = 0;
+    std::size_t memory = 0;
+  };
+
+  ///
+  /// Loads resources on background threads and hands out handles at once.
+  ///
+  ///   Handle<Texture> albedo = resources.load<Texture>( "../textures/chalet.jpg" );
+  ///   ...
+  ///   if ( std::shared_ptr<Texture> texture = resources.get( albedo ) ) upload( *texture );
+  ///   resources.release( albedo );
+  ///
+  /// Requests go into a priority queue served by `loaderThreads` threads,
+  /// first by priority then in request order. Loading a queued path again
+  /// with a higher priority moves it up.
+  ///
+  /// Resources are shared twice over: a path that is already known returns
+  /// the same slot, and a file with the same bytes as the file of a resident
+  /// resource of the same type shares that resource instead of decoding it
+  /// again. Hashes only find the candidate, the bytes are compared.
+  ///
+  /// Every load() and acquire() takes a reference, release() drops one.
+  /// Resources without references are unloaded by update() `unloadDelay`
+  /// frames later, so an asset that is released and loaded again in the
+  /// meantime, on a level change say, is not read twice. get() returns a
+  /// shared_ptr, a resource in use stays alive until it is let go.
+  ///
+  /// All members are thread safe.
+  ///
+  class ResourceManager {
+  public:
+    /// Frames in flight plus one, GPU copies are gone by then.
+    static constexpr uint64_t DEFAULT_UNLOAD_DELAY = 3;
+
+    explicit ResourceManager( uint32_t loaderThreads = 2, uint64_t unloadDelay = DEFAULT_UNLOAD_DELAY );
+    ~ResourceManager() noexcept;
+
+    ResourceManager( const ResourceManager & ) = delete;
+    ResourceManager &operator=( const ResourceManager & ) = delete;
+
+    template <typename T>
+    Handle<T> load( const std::string &path, ResourcePriority priority = ResourcePriority::Normal ) {
+      static_assert( std::is_base_of_v<Resource, T>, "resources derive from fn::Resource" );
+      const Slot::Id id = request( path, priority, typeTag<T>(), &make<T> );
+      return {id.index, id.generation};
+    }
+
+    /// The resource once it is Ready, nullptr before and on failure.
+    template <typename T>
+    std::shared_ptr<T> get( Handle<T> handle ) const {
+      return std::static_pointer_cast<T>( find( {handle.index, handle.generation}, typeTag<T>(), false ) );
+    }
+
+    /// get(), after blocking until the resource is Ready or Failed.
+    template <typename T>
+    std::shared_ptr<T> wait( Handle<T> handle ) const {
+      return std::static_pointer_cast<T>( find( {handle.index, handle.generation}, typeTag<T>(), true ) );
+    }
+
+    template <typename T>
+    ResourceState state( Handle<T> handle ) const {
+      return stateOf( {handle.index, handle.generation} );
+    }
+
+    template <typename T>
+    void acquire( Handle<T> handle ) {
+      reference( {handle.index, handle.generation}, true );
+    }
+
+    template <typename T>
+    void release( Handle<T> handle ) {
+      reference( {handle.index, handle.generation}, false );
+    }
+
+    /// Blocks until nothing is queued or loading.
+    void waitAll() const;
+
+    /// Once per frame, unloads resources released `unloadDelay` frames ago.
+    void update();
+
+    ResourceStats stats() const;
+
+  private:
+    using Factory = std::shared_ptr<Resource> ( * )();
+
+    struct Slot {
+      struct Id {
+        uint32_t index;
+        uint32_t generation;
+      };
+
+      std::string path;
+      const void *type = nullptr;
+      Factory factory = nullptr;
+      std::shared_ptr<Resource> resource;
+      ResourceState state = ResourceState::Invalid;
+      uint32_t generation = 0;
+      uint32_t references = 0;
+      uint64_t releasedFrame = 0;
+    };
+
+    struct Request {
+      ResourcePriority priority;
+      uint64_t sequence;
+      Slot::Id id;
+
+      // Highest priority on top, then the oldest request
+      bool operator<( const Request &other ) const noexcept {
+        if ( priority != other.priority ) return priority < other.priority;
+        return sequence > other.sequence;
+      }
+    };
+
+    template <typename T>
+    static const void *typeTag() noexcept {
+      static const char tag = 0;
+      return &tag;
+    }
+
+    // The object and its control block come from the pool of their type
+    template <typename T>
+    static std::shared_ptr<Resource> make() {
+      return std::allocate_shared<T>( PoolStdAllocator<T>() );
+    }
+
+    Slot::Id request( const std::string &path, ResourcePriority priority, const void *type, Factory factory );
+    std::shared_ptr<Resource> find( Slot::Id id, const void *type, bool block ) const;
+    ResourceState stateOf( Slot::Id id ) const;
+    void reference( Slot::Id id, bool acquire );
+
+    // Called with the lock held
+    Slot *slot( Slot::Id id ) noexcept;
+    const Slot *slot( Slot::Id id ) const noexcept;
+    void enqueue( Slot::Id id, ResourcePriority priority );
+
+    void loaderLoop() noexcept;
+
+    const uint64_t m_unloadDelay;
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_work;
+    mutable std::condition_variable m_done;
+
+    std::vector<Slot> m_slots;
+    std::vector<uint32_t> m_freeSlots;
+    std::unordered_map<std::string, uint32_t> m_byPath;
+
+    // Decoded resources by type, hash and size of their file, and the file
+    // they were decoded from, to compare the bytes of a hit against
+    struct Content {
+      std::weak_ptr<Resource> resource;
+      std::string path;
+    };
+    std::map<std::tuple<const void *, uint64_t, std::size_t>, Content> m_byContent;
+
+    std::priority_queue<Request> m_queue;
+    uint64_t m_sequence = 0;
+
+    // Slots queued or loading, waitAll() waits for zero
+    std::size_t m_pending = 0;
+
+    // Slots whose last reference went away, unloaded by update()
+    std::vector<Slot::Id> m_released;
+    uint64_t m_frame = 0;
+
+    ResourceStats m_stats;
+
+    bool m_stop = false;
+    std::vector<std::thread> m_threads;
+  };
+
+}    // namespace fn
@@ -0,0 +1,37 @@
+/* =======================================================================
+   $File: shader.hh
+   $Date: 16-10-2026
+   $Revision: 16-10-2026
+   $Creator: Orestis Ro Stelmach
+   $Email: stelmach.ro[at]gmail.com
+   $Notice:
+   ======================================================================== */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "resources/resource.hh"
+
+namespace fn {
+
+  /// SPIR-V module, checked for the magic number and kept as words.
+  class Shader : public Resource {
+  public:
+    static constexpr uint32_t SPIRV_MAGIC = 0x07230203;
+
+    bool decode( const std::vector<char> &bytes, const std::string &path ) override;
+    std::size_t memoryUsage() const noexcept override;
+
+    const std::vector<uint32_t> &code() const noexcept {
+      return m_code;
+    }
+
+  private:
+    std::vector<uint32_t> m_code;
+  };
+
+}    // namespace fn
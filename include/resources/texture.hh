@@ -0,0 +1,48 @@
+/* =======================================================================
+   $File: texture.hh
+   $Date: 16-10-2026
+   $Revision: 16-10-2026
+   $Creator: Orestis Ro Stelmach
+   $Email: stelmach.ro[at]gmail.com
+   $Notice:
+   ======================================================================== */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "resources/resource.hh"
+
+namespace fn {
+
+  /// RGBA8 image decoded with stb_image, pixels stay on the CPU for upload.
+  class Texture : public Resource {
+  public:
+    bool decode( const std::vector<char> &bytes, const std::string &path ) override;
+    std::size_t memoryUsage() const noexcept override;
+
+    uint32_t width() const noexcept {
+      return m_width;
+    }
+
+    uint32_t height() const noexcept {
+      return m_height;
+    }
+
+    /// Levels of a full mip chain down to 1x1.
+    uint32_t mipLevels() const noexcept;
+
+    const std::vector<uint8_t> &pixels() const noexcept {
+      return m_pixels;
+    }
+
+  private:
+    uint32_t m_width = 0;
+    uint32_t m_height = 0;
+    std::vector<uint8_t> m_pixels;
+  };
+
+}    // namespace fn
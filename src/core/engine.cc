@@ -1,18 +1,27 @@
 #include "core/engine.hh"
 #include "core/fission.hh"
 #include "core/logger.hh"
+#include "core/profiler.hh"
+#include "ecs/systems.hh"
 #include "renderer/base_renderer.hh"
 
+#include <thread>
+
 namespace fn {
 
   Engine *Engine::m_instance = nullptr;
-  Engine::Engine() noexcept {}
+  MemoryTracker::Snapshot Engine::m_memoryAtStart;
+
+  Engine::Engine() noexcept {
+    ecs::addTransformSystems( m_systems );
+  }
 
   Engine::~Engine() noexcept {}
 
   Engine *Engine::getInstance() noexcept {
 
     if ( !m_instance ) {
+      m_memoryAtStart = MemoryTracker::snapshot();
       m_instance = new Engine();
     }
 
@@ -23,24 +32,113 @@ namespace fn {
     if ( m_instance ) {
       delete m_instance;
       m_instance = nullptr;
+      if ( MemoryTracker::enabled ) MemoryTracker::reportLeaks( m_memoryAtStart );
     } else {
       log::fatal( "Attempted to destroy null engine object" );
     }
   }
 
   void Engine::mainLoop() noexcept {
+    FN_PROFILE_FUNCTION();
+    m_clock.reset();
+
+    // Each run returns when the window closes or the mode changes
     while ( !m_renderer->getShouldTerminate() ) {
-      float dt = 1.0f;
+      if ( getThreadingMode() == ThreadingMode::Pipelined ) {
+        runPipelined();
+      } else {
+        runSerial();
+      }
+    }
+  }
+
+  bool Engine::keepRunning( ThreadingMode mode ) const noexcept {
+    return !m_renderer->getShouldTerminate() && getThreadingMode() == mode;
+  }
+
+  void Engine::simulate( FrameState &frame ) noexcept {
+    FN_PROFILE_FUNCTION();
+    m_clock.beginFrame();
+
+    // Simulation advances in fixed steps, whatever the render throughput
+    while ( m_clock.step() ) {
+      m_renderer->update( static_cast<float>( m_clock.fixedStep() ) );
+    }
+
+    // World transforms and bounds once per frame, from the last step
+    m_systems.run( m_world, m_jobs );
+    m_resources.update();
 
-      m_renderer->render( dt );
-      m_renderer->update( dt );
+    // Overruns are logged once, at the frame they are noticed
+    MemoryTracker::checkBudgets();
+
+    frame.frameIndex = m_clock.frameIndex();
+    frame.simulationTime = m_clock.simulationTime();
+    frame.alpha = static_cast<float>( m_clock.alpha() );
+    m_renderer->captureFrame( frame );
+    ecs::gatherRenderables( m_world, nullptr, frame.transforms );
+  }
+
+  void Engine::runSerial() noexcept {
+    while ( keepRunning( ThreadingMode::Serial ) ) {
+      {
+        FN_PROFILE_SCOPE( "Engine::frame" );
+        simulate( m_frame );
+        FN_MEMORY_SCOPE( Renderer );
+        m_renderer->render( m_frame );
+        m_clock.endFrame();
+      }
+      Profiler::endFrame();
+    }
+  }
+
+  void Engine::runPipelined() noexcept {
+    m_pipeline.reset();
+
+    // The window and its events stay on the main thread, as GLFW requires,
+    // only render() moves to the render thread
+    std::thread renderThread( [this] {
+      FN_PROFILE_THREAD_NAME( "render" );
+      FN_MEMORY_SCOPE( Renderer );
+      while ( const FrameState *frame = m_pipeline.beginRead() ) {
+        FN_PROFILE_SCOPE( "Engine::render" );
+        m_renderer->render( *frame );
+        m_pipeline.endRead();
+      }
+    } );
+
+    while ( keepRunning( ThreadingMode::Pipelined ) ) {
+      {
+        FN_PROFILE_SCOPE( "Engine::frame" );
+
+        // Blocks while the renderer is still a frame behind
+        FrameState *frame = m_pipeline.beginWrite();
+        simulate( *frame );
+        m_pipeline.endWrite();
+        m_clock.endFrame();
+      }
+      Profiler::endFrame();
     }
+
+    // The last published frame is still drawn before the thread exits
+    m_pipeline.close();
+    renderThread.join();
   }
 
   void Engine::run() noexcept {
-    m_renderer->initWindow();
-    m_renderer->initRenderer();
+    FN_PROFILE_THREAD_NAME( "main" );
+    m_renderer->setResources( &m_resources );
+    {
+      FN_PROFILE_SCOPE( "Engine::startup" );
+      FN_MEMORY_SCOPE( Renderer );
+      m_renderer->initWindow();
+      m_renderer->initRenderer();
+    }
     this->mainLoop();
-    m_renderer->cleanUp();
+    {
+      FN_MEMORY_SCOPE( Renderer );
+      m_renderer->cleanUp();
+    }
+    if ( MemoryTracker::enabled ) MemoryTracker::report();
   }
 }    // namespace fn
@@ -0,0 +1,125 @@
+#include "core/frame_arena.hh"
+#include "core/logger.hh"
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+
+namespace fn {
+
+  // Header of a heap block a frame spilled into, the data follows it
+  struct FrameArena::Block {
+    Block *next;
+    std::size_t size;
+  };
+
+  namespace {
+
+    void poison( [[maybe_unused]] void *memory, [[maybe_unused]] std::size_t bytes,
+                 [[maybe_unused]] uint8_t value ) noexcept {
+#if defined( FN_ARENA_POISON )
+      std::memset( memory, value, bytes );
+#endif
+    }
+
+  }    // namespace
+
+  FrameArena::FrameArena( std::size_t capacity )
+      : m_begin( static_cast<unsigned char *>( ::operator new( std::max<std::size_t>( capacity, 1 ) ) ) )
+      , m_cursor( m_begin )
+      , m_end( m_begin + capacity )
+      , m_capacity( capacity )
+      , m_ownsBuffer( true ) {
+    poison( m_begin, m_capacity, RELEASED_BYTE );
+  }
+
+  FrameArena::FrameArena( void *buffer, std::size_t size ) noexcept
+      : m_begin( static_cast<unsigned char *>( buffer ) )
+      , m_cursor( m_begin )
+      , m_end( m_begin + size )
+      , m_capacity( size )
+      , m_ownsBuffer( false ) {}
+
+  FrameArena::~FrameArena() noexcept {
+    releaseOverflow();
+    if ( m_ownsBuffer ) {
+      ::operator delete( m_begin );
+    }
+  }
+
+  unsigned char *FrameArena::bump( std::size_t bytes, std::size_t alignment ) noexcept {
+    const auto address = reinterpret_cast<std::uintptr_t>( m_cursor );
+    const std::size_t padding = ( alignment - address % alignment ) % alignment;
+    const auto available = static_cast<std::size_t>( m_end - m_cursor );
+    if ( padding > available || bytes > available - padding ) {
+      return nullptr;
+    }
+
+    unsigned char *memory = m_cursor + padding;
+    m_cursor = memory + bytes;
+    m_used += padding + bytes;
+    return memory;
+  }
+
+  void *FrameArena::do_allocate( std::size_t bytes, std::size_t alignment ) {
+    unsigned char *memory = bump( bytes, alignment );
+
+    if ( !memory ) {
+      // Spill into a heap block with room for this and what usually follows
+      const std::size_t size = std::max( bytes + alignment, m_capacity );
+      auto *block = static_cast<Block *>( ::operator new( sizeof( Block ) + size ) );
+      if ( !m_overflow ) m_overflowCount++;
+      block->next = m_overflow;
+      block->size = size;
+      m_overflow = block;
+
+      m_cursor = reinterpret_cast<unsigned char *>( block + 1 );
+      m_end = m_cursor + size;
+      memory = bump( bytes, alignment );
+    }
+
+    poison( memory, bytes, ALLOCATED_BYTE );
+    return memory;
+  }
+
+  void FrameArena::reset() {
+    m_highWaterMark = highWaterMark();
+
+    if ( m_overflow ) {
+      releaseOverflow();
+
+      // Grow past the high water mark, so a frame like this one fits next time
+      std::size_t grown = std::max<std::size_t>( m_capacity * 2, 64 );
+      while ( grown < m_highWaterMark ) grown *= 2;
+
+      auto *buffer = static_cast<unsigned char *>( ::operator new( grown ) );
+      if ( m_ownsBuffer ) {
+        ::operator delete( m_begin );
+      }
+      m_begin = buffer;
+      m_capacity = grown;
+      m_ownsBuffer = true;
+      poison( m_begin, m_capacity, RELEASED_BYTE );
+    } else {
+      poison( m_begin, static_cast<std::size_t>( m_cursor - m_begin ), RELEASED_BYTE );
+    }
+
+    m_cursor = m_begin;
+    m_end = m_begin + m_capacity;
+    m_used = 0;
+  }
+
+  void FrameArena::releaseOverflow() noexcept {
+    while ( m_overflow ) {
+      Block *next = m_overflow->next;
+      ::operator delete( m_overflow );
+      m_overflow = next;
+    }
+  }
+
+  void FrameArena::report( const char *name ) const noexcept {
+    log::info( "Frame arena %s: %zu of %zu bytes at peak, spilled into the heap %u times\n", name,
+               highWaterMark(), m_capacity, m_overflowCount );
+  }
+
+}    // namespace fn
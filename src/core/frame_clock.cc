@@ -0,0 +1,101 @@
+#include "core/frame_clock.hh"
+
+#include <algorithm>
+#include <thread>
+
+namespace fn {
+
+  FrameClock::FrameClock( double fixedStep ) noexcept
+      : m_fixedStep( fromSeconds( fixedStep ) )
+      , m_maxFrameTime( fromSeconds( 0.25 ) )
+      , m_targetFrameTime( duration::zero() )
+      , m_spinTime( fromSeconds( 0.002 ) )
+      , m_maxSteps( 8 ) {
+    reset();
+  }
+
+  void FrameClock::setFixedStep( double seconds ) noexcept {
+    m_fixedStep = std::max( fromSeconds( seconds ), duration( 1 ) );
+  }
+
+  void FrameClock::setMaxFrameTime( double seconds ) noexcept {
+    m_maxFrameTime = fromSeconds( seconds );
+  }
+
+  void FrameClock::setMaxSteps( uint32_t steps ) noexcept {
+    m_maxSteps = std::max( steps, 1u );
+  }
+
+  void FrameClock::setTargetFrameRate( double framesPerSecond ) noexcept {
+    m_targetFrameTime = framesPerSecond > 0.0 ? fromSeconds( 1.0 / framesPerSecond ) : duration::zero();
+  }
+
+  void FrameClock::setSpinTime( double seconds ) noexcept {
+    m_spinTime = fromSeconds( seconds );
+  }
+
+  void FrameClock::reset() noexcept {
+    m_frameStart = clock::now();
+    m_frameTime = duration::zero();
+    m_accumulator = duration::zero();
+    m_simulationTime = duration::zero();
+    m_droppedTime = duration::zero();
+    m_frameIndex = 0;
+    m_stepsThisFrame = 0;
+  }
+
+  void FrameClock::beginFrame() noexcept {
+    const clock::time_point now = clock::now();
+    const duration elapsed = now - m_frameStart;
+    m_frameStart = now;
+    beginFrame( elapsed );
+  }
+
+  void FrameClock::beginFrame( duration elapsed ) noexcept {
+    m_frameTime = elapsed;
+    m_frameIndex++;
+    m_stepsThisFrame = 0;
+
+    if ( elapsed > m_maxFrameTime ) {
+      m_droppedTime += elapsed - m_maxFrameTime;
+      elapsed = m_maxFrameTime;
+    }
+    m_accumulator += elapsed;
+  }
+
+  bool FrameClock::step() noexcept {
+    if ( m_accumulator < m_fixedStep ) {
+      return false;
+    }
+
+    if ( m_stepsThisFrame == m_maxSteps ) {
+      // Keep the phase within the step so alpha() stays meaningful
+      const duration excess = m_accumulator - m_accumulator % m_fixedStep;
+      m_droppedTime += excess;
+      m_accumulator -= excess;
+      return false;
+    }
+
+    m_accumulator -= m_fixedStep;
+    m_simulationTime += m_fixedStep;
+    m_stepsThisFrame++;
+    return true;
+  }
+
+  void FrameClock::endFrame() noexcept {
+    if ( m_targetFrameTime == duration::zero() ) {
+      return;
+    }
+
+    const clock::time_point deadline = m_frameStart + m_targetFrameTime;
+    const duration remaining = deadline - clock::now();
+    if ( remaining > m_spinTime ) {
+      std::this_thread::sleep_for( remaining - m_spinTime );
+    }
+
+    while ( clock::now() < deadline ) {
+      std::this_thread::yield();
+    }
+  }
+
+}    // namespace fn
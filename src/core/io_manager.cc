@@ -1,4 +1,5 @@
 #include "core/io_manager.hh"
+#include "core/profiler.hh"
 
 namespace fn {
 
@@ -23,6 +24,8 @@ namespace fn {
   }
 
   void IOManager::update( [[maybe_unused]] float dt ) noexcept {
+    FN_PROFILE_FUNCTION();
+
     //@fix: this assertion check here is bad, try to solve it
     FN_ASSERT_M( m_window,
                  "Window ojbect has not been set in IOManager class" );
@@ -153,4 +156,17 @@ namespace fn {
     return m_mousePos.y;
   }
 
+  void IOManager::snapshot( InputSnapshot &input ) const noexcept {
+    input.mouseX = m_mousePos.x;
+    input.mouseY = m_mousePos.y;
+    input.leftMouse = m_mouseButtons.left;
+    input.rightMouse = m_mouseButtons.right;
+    input.middleMouse = m_mouseButtons.middle;
+
+    input.heldKeys.clear();
+    for ( auto &i : m_pressedKeys ) {
+      if ( i.second ) input.heldKeys.push_back( i.first );
+    }
+  }
+
 }    // namespace fn
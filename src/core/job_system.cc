@@ -0,0 +1,300 @@
+#include "core/job_system.hh"
+
+#include <algorithm>
+#include <cstring>
+#include <thread>
+
+namespace fn {
+
+  namespace {
+
+    // Jobs a worker can have in flight, its deque and its job pool
+    constexpr int64_t QUEUE_CAPACITY = 4096;
+    constexpr int64_t QUEUE_MASK = QUEUE_CAPACITY - 1;
+    static_assert( ( QUEUE_CAPACITY & QUEUE_MASK ) == 0, "capacity must be a power of two" );
+
+    // Failed rounds of stealing before an idle worker goes to sleep
+    constexpr int IDLE_SPINS = 64;
+
+  }    // namespace
+
+  struct JobSystem::Job {
+    Function function;
+    alignas( std::max_align_t ) unsigned char storage[ STORAGE_SIZE ];
+    std::size_t begin;
+    std::size_t end;
+    std::size_t grain;
+    JobCounter *counter;
+
+    // Set while the job is queued or running, only the owner allocates it again
+    std::atomic<bool> busy{false};
+  };
+
+  namespace {
+
+    ///
+    /// Chase-Lev deque with the memory orders of Le et al., "Correct and
+    /// Efficient Work-Stealing for Weak Memory Models" ( PPoPP 2013 ). The
+    /// owner pushes and pops at the bottom, thieves steal from the top.
+    /// Slots are published with release / acquire rather than relaxed, which
+    /// is free on x86 and lets ThreadSanitizer follow the job contents.
+    ///
+    class WorkStealingDeque {
+    public:
+      using Job = JobSystem::Job;
+
+      // Owner only. False when full, the caller then runs the job itself.
+      bool push( Job *job ) noexcept {
+        const int64_t b = m_bottom.load( std::memory_order_relaxed );
+        const int64_t t = m_top.load( std::memory_order_acquire );
+        if ( b - t >= QUEUE_CAPACITY ) return false;
+
+        m_buffer[ b & QUEUE_MASK ].store( job, std::memory_order_release );
+        std::atomic_thread_fence( std::memory_order_release );
+        m_bottom.store( b + 1, std::memory_order_relaxed );
+        return true;
+      }
+
+      // Owner only, newest job first
+      Job *pop() noexcept {
+        const int64_t b = m_bottom.load( std::memory_order_relaxed ) - 1;
+        m_bottom.store( b, std::memory_order_relaxed );
+        std::atomic_thread_fence( std::memory_order_seq_cst );
+        int64_t t = m_top.load( std::memory_order_relaxed );
+
+        if ( t > b ) {
+          m_bottom.store( b + 1, std::memory_order_relaxed );
+          return nullptr;
+        }
+
+        Job *job = m_buffer[ b & QUEUE_MASK ].load( std::memory_order_acquire );
+        if ( t == b ) {
+          // Last job, race the thieves for it
+          if ( !m_top.compare_exchange_strong( t, t + 1, std::memory_order_seq_cst,
+                                               std::memory_order_relaxed ) ) {
+            job = nullptr;
+          }
+          m_bottom.store( b + 1, std::memory_order_relaxed );
+        }
+        return job;
+      }
+
+      // Any thread, oldest job first
+      Job *steal() noexcept {
+        int64_t t = m_top.load( std::memory_order_acquire );
+        std::atomic_thread_fence( std::memory_order_seq_cst );
+        const int64_t b = m_bottom.load( std::memory_order_acquire );
+        if ( t >= b ) return nullptr;
+
+        Job *job = m_buffer[ t & QUEUE_MASK ].load( std::memory_order_acquire );
+        if ( !m_top.compare_exchange_strong( t, t + 1, std::memory_order_seq_cst,
+                                             std::memory_order_relaxed ) ) {
+          return nullptr;
+        }
+        return job;
+      }
+
+    private:
+      alignas( 64 ) std::atomic<int64_t> m_top{0};
+      alignas( 64 ) std::atomic<int64_t> m_bottom{0};
+      alignas( 64 ) std::atomic<Job *> m_buffer[ QUEUE_CAPACITY ];
+    };
+
+    thread_local const JobSystem *t_system = nullptr;
+    thread_local JobSystem::Worker *t_worker = nullptr;
+
+  }    // namespace
+
+  struct alignas( 64 ) JobSystem::Worker {
+    WorkStealingDeque queue;
+    Job jobs[ QUEUE_CAPACITY ];
+    std::size_t nextJob = 0;
+    uint32_t index = 0;
+    uint32_t random = 0;
+    std::thread thread;
+  };
+
+  JobSystem::JobSystem( uint32_t threadCount ) noexcept {
+    if ( threadCount == 0 ) {
+      threadCount = std::max( 1u, std::thread::hardware_concurrency() );
+    }
+
+    m_workers.reserve( threadCount );
+    for ( uint32_t i = 0; i < threadCount; i++ ) {
+      m_workers.push_back( std::make_unique<Worker>() );
+      m_workers.back()->index = i;
+      m_workers.back()->random = 0x9e3779b9u * ( i + 1 );
+    }
+
+    t_system = this;
+    t_worker = m_workers[ 0 ].get();
+
+    for ( uint32_t i = 1; i < threadCount; i++ ) {
+      Worker &worker = *m_workers[ i ];
+      worker.thread = std::thread( [this, &worker] { workerLoop( worker ); } );
+    }
+  }
+
+  JobSystem::~JobSystem() noexcept {
+    {
+      std::lock_guard<std::mutex> lock( m_sleepMutex );
+      m_stop.store( true );
+    }
+    m_wake.notify_all();
+
+    for ( auto &worker : m_workers ) {
+      if ( worker->thread.joinable() ) worker->thread.join();
+    }
+
+    if ( t_system == this ) {
+      t_system = nullptr;
+      t_worker = nullptr;
+    }
+  }
+
+  uint32_t JobSystem::currentThread() const noexcept {
+    const Worker *worker = currentWorker();
+    return worker ? worker->index : threadCount();
+  }
+
+  JobSystem::Worker *JobSystem::currentWorker() const noexcept {
+    return t_system == this ? t_worker : nullptr;
+  }
+
+  void JobSystem::submit( JobCounter &counter, Function function, const void *storage,
+                          std::size_t size, std::size_t begin, std::size_t end,
+                          std::size_t grain ) noexcept {
+    Worker *worker = currentWorker();
+    Job *job = worker ? allocate( *worker ) : nullptr;
+
+    if ( !job ) {
+      // Foreign thread or every job of this worker in flight
+      function( storage, begin, end );
+      return;
+    }
+
+    job->function = function;
+    std::memcpy( job->storage, storage, size );
+    job->begin = begin;
+    job->end = end;
+    job->grain = grain;
+    job->counter = &counter;
+
+    counter.m_pending.fetch_add( 1, std::memory_order_relaxed );
+    push( *worker, job );
+  }
+
+  JobSystem::Job *JobSystem::allocate( Worker &worker ) noexcept {
+    for ( int64_t i = 0; i < QUEUE_CAPACITY; i++ ) {
+      Job &job = worker.jobs[ worker.nextJob++ & static_cast<std::size_t>( QUEUE_MASK ) ];
+      if ( !job.busy.load( std::memory_order_acquire ) ) {
+        job.busy.store( true, std::memory_order_relaxed );
+        return &job;
+      }
+    }
+    return nullptr;
+  }
+
+  void JobSystem::push( Worker &worker, Job *job ) noexcept {
+    if ( !worker.queue.push( job ) ) {
+      execute( worker, job );
+      return;
+    }
+
+    m_queued.fetch_add( 1, std::memory_order_seq_cst );
+    if ( m_sleeping.load( std::memory_order_seq_cst ) > 0 ) {
+      std::lock_guard<std::mutex> lock( m_sleepMutex );
+      m_wake.notify_one();
+    }
+  }
+
+  JobSystem::Job *JobSystem::findJob( Worker &worker ) noexcept {
+    Job *job = worker.queue.pop();
+
+    if ( !job && m_workers.size() > 1 ) {
+      // xorshift, so workers do not all raid the same victim
+      worker.random ^= worker.random << 13;
+      worker.random ^= worker.random >> 17;
+      worker.random ^= worker.random << 5;
+
+      const std::size_t count = m_workers.size();
+      const std::size_t first = worker.random % count;
+      for ( std::size_t i = 0; i < count && !job; i++ ) {
+        Worker &victim = *m_workers[ ( first + i ) % count ];
+        if ( &victim != &worker ) job = victim.queue.steal();
+      }
+    }
+
+    if ( job ) m_queued.fetch_sub( 1, std::memory_order_relaxed );
+    return job;
+  }
+
+  void JobSystem::execute( Worker &worker, Job *job ) noexcept {
+    // Keep the lower half of a large range and offer the upper half
+    while ( job->end - job->begin > job->grain ) {
+      Job *half = allocate( worker );
+      if ( !half ) break;
+
+      const std::size_t middle = job->begin + ( job->end - job->begin ) / 2;
+      half->function = job->function;
+      std::memcpy( half->storage, job->storage, STORAGE_SIZE );
+      half->begin = middle;
+      half->end = job->end;
+      half->grain = job->grain;
+      half->counter = job->counter;
+      job->end = middle;
+
+      job->counter->m_pending.fetch_add( 1, std::memory_order_relaxed );
+      push( worker, half );
+    }
+
+    job->function( job->storage, job->begin, job->end );
+
+    // The counter may go away as soon as it reaches zero, touch nothing after
+    JobCounter *counter = job->counter;
+    job->busy.store( false, std::memory_order_release );
+    counter->m_pending.fetch_sub( 1, std::memory_order_acq_rel );
+  }
+
+  void JobSystem::wait( const JobCounter &counter ) noexcept {
+    Worker *worker = currentWorker();
+
+    while ( !counter.done() ) {
+      Job *job = worker ? findJob( *worker ) : nullptr;
+      if ( job ) {
+        execute( *worker, job );
+      } else {
+        std::this_thread::yield();
+      }
+    }
+  }
+
+  void JobSystem::workerLoop( Worker &worker ) noexcept {
+    t_system = this;
+    t_worker = &worker;
+
+    int idle = 0;
+    while ( !m_stop.load( std::memory_order_relaxed ) ) {
+      if ( Job *job = findJob( worker ) ) {
+        execute( worker, job );
+        idle = 0;
+        continue;
+      }
+
+      if ( ++idle < IDLE_SPINS ) {
+        std::this_thread::yield();
+        continue;
+      }
+
+      std::unique_lock<std::mutex> lock( m_sleepMutex );
+      m_sleeping.fetch_add( 1, std::memory_order_seq_cst );
+      m_wake.wait( lock, [this] {
+        return m_stop.load( std::memory_order_relaxed ) ||
+               m_queued.load( std::memory_order_seq_cst ) > 0;
+      } );
+      m_sleeping.fetch_sub( 1, std::memory_order_relaxed );
+      idle = 0;
+    }
+  }
+
+}    // namespace fn
@@ -0,0 +1,288 @@
+#include "core/memory_tracker.hh"
+#include "core/logger.hh"
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+namespace fn {
+
+  namespace {
+
+    // Right before every block, the raw pointer is what malloc() returned
+    struct Header {
+      void *raw;
+      std::size_t size;
+      MemoryTag tag;
+    };
+
+    // A cache line per tag, threads charging different tags do not contend
+    struct alignas( 64 ) Counters {
+      std::atomic<std::size_t> current{0};
+      std::atomic<std::size_t> peak{0};
+      std::atomic<std::size_t> allocations{0};
+      std::atomic<std::size_t> live{0};
+      std::atomic<std::size_t> budget{0};
+
+      // Set when current went over budget, cleared by checkBudgets()
+      std::atomic<bool> overBudget{false};
+    };
+
+    // Constant initialized, allocations during static initialization are counted too
+    Counters g_counters[ MEMORY_TAG_COUNT ];
+
+    thread_local MemoryTag t_tag = MemoryTag::General;
+
+    constexpr const char *TAG_NAMES[ MEMORY_TAG_COUNT ] = {"General", "Renderer", "Math",
+                                                           "Assets",  "Logging",  "Ecs"};
+
+    Counters &counters( MemoryTag tag ) noexcept {
+      return g_counters[ static_cast<std::size_t>( tag ) ];
+    }
+
+    Header *header( void *memory ) noexcept {
+      return reinterpret_cast<Header *>( static_cast<unsigned char *>( memory ) - sizeof( Header ) );
+    }
+
+  }    // namespace
+
+  const char *memoryTagName( MemoryTag tag ) noexcept {
+    return tag < MemoryTag::Count ? TAG_NAMES[ static_cast<std::size_t>( tag ) ] : "Unknown";
+  }
+
+  void *MemoryTracker::allocate( std::size_t size, std::size_t alignment, MemoryTag tag ) noexcept {
+    if ( alignment < alignof( Header ) ) alignment = alignof( Header );
+    if ( tag >= MemoryTag::Count ) tag = MemoryTag::General;
+
+    // Room for the header and for moving the block up to its alignment
+    const std::size_t extra = sizeof( Header ) + alignment - 1;
+    if ( size > SIZE_MAX - extra ) return nullptr;
+
+    void *raw = std::malloc( size + extra );
+    if ( !raw ) return nullptr;
+
+    const auto address = reinterpret_cast<std::uintptr_t>( raw ) + sizeof( Header );
+    void *memory = reinterpret_cast<void *>( ( address + alignment - 1 ) & ~( alignment - 1 ) );
+    *header( memory ) = {raw, size, tag};
+
+    Counters &charged = counters( tag );
+    charged.allocations.fetch_add( 1, std::memory_order_relaxed );
+    charged.live.fetch_add( 1, std::memory_order_relaxed );
+    const std::size_t current = charged.current.fetch_add( size, std::memory_order_relaxed ) + size;
+
+    std::size_t peak = charged.peak.load( std::memory_order_relaxed );
+    while ( current > peak &&
+            !charged.peak.compare_exchange_weak( peak, current, std::memory_order_relaxed ) ) {
+    }
+
+    const std::size_t budget = charged.budget.load( std::memory_order_relaxed );
+    if ( budget > 0 && current > budget ) charged.overBudget.store( true, std::memory_order_relaxed );
+
+    return memory;
+  }
+
+  void MemoryTracker::deallocate( void *memory ) noexcept {
+    if ( !memory ) return;
+
+    const Header block = *header( memory );
+    Counters &charged = counters( block.tag );
+    charged.current.fetch_sub( block.size, std::memory_order_relaxed );
+    charged.live.fetch_sub( 1, std::memory_order_relaxed );
+    std::free( block.raw );
+  }
+
+  void *MemoryTracker::reallocate( void *memory, std::size_t size, MemoryTag tag ) noexcept {
+    if ( !memory ) return allocate( size, alignof( std::max_align_t ), tag );
+
+    const Header block = *header( memory );
+    void *moved = allocate( size, alignof( std::max_align_t ), block.tag );
+    if ( !moved ) return nullptr;
+
+    std::memcpy( moved, memory, block.size < size ? block.size : size );
+    deallocate( memory );
+    return moved;
+  }
+
+  MemoryTag MemoryTracker::currentTag() noexcept {
+    return t_tag;
+  }
+
+  void MemoryTracker::setCurrentTag( MemoryTag tag ) noexcept {
+    t_tag = tag;
+  }
+
+  MemoryStats MemoryTracker::stats( MemoryTag tag ) noexcept {
+    const Counters &charged = counters( tag );
+    MemoryStats stats;
+    stats.current = charged.current.load( std::memory_order_relaxed );
+    stats.peak = charged.peak.load( std::memory_order_relaxed );
+    stats.allocations = charged.allocations.load( std::memory_order_relaxed );
+    stats.live = charged.live.load( std::memory_order_relaxed );
+    stats.budget = charged.budget.load( std::memory_order_relaxed );
+    return stats;
+  }
+
+  void MemoryTracker::setBudget( MemoryTag tag, std::size_t bytes ) noexcept {
+    Counters &charged = counters( tag );
+    charged.budget.store( bytes, std::memory_order_relaxed );
+    charged.overBudget.store( bytes > 0 && charged.current.load( std::memory_order_relaxed ) > bytes,
+                              std::memory_order_relaxed );
+  }
+
+  bool MemoryTracker::checkBudgets() noexcept {
+    bool within = true;
+    for ( std::size_t i = 0; i < MEMORY_TAG_COUNT; i++ ) {
+      const auto tag = static_cast<MemoryTag>( i );
+      Counters &charged = counters( tag );
+      const std::size_t budget = charged.budget.load( std::memory_order_relaxed );
+      if ( budget == 0 ) continue;
+
+      if ( charged.overBudget.exchange( false, std::memory_order_relaxed ) ) {
+        log::warning( "Memory %s went over its budget of %zu bytes, %zu at peak\n", memoryTagName( tag ),
+                      budget, charged.peak.load( std::memory_order_relaxed ) );
+      }
+      within = within && charged.current.load( std::memory_order_relaxed ) <= budget;
+    }
+    return within;
+  }
+
+  MemoryTracker::Snapshot MemoryTracker::snapshot() noexcept {
+    Snapshot taken;
+    for ( std::size_t i = 0; i < MEMORY_TAG_COUNT; i++ ) {
+      taken.live[ i ] = g_counters[ i ].live.load( std::memory_order_relaxed );
+      taken.bytes[ i ] = g_counters[ i ].current.load( std::memory_order_relaxed );
+    }
+    return taken;
+  }
+
+  std::size_t MemoryTracker::reportLeaks( const Snapshot &since ) noexcept {
+    const Snapshot now = snapshot();
+
+    std::size_t leaked = 0;
+    for ( std::size_t i = 0; i < MEMORY_TAG_COUNT; i++ ) {
+      if ( now.live[ i ] <= since.live[ i ] ) continue;
+
+      const std::size_t bytes = now.bytes[ i ] > since.bytes[ i ] ? now.bytes[ i ] - since.bytes[ i ] : 0;
+      log::warning( "Memory %s: %zu allocations of %zu bytes were not freed\n",
+                    memoryTagName( static_cast<MemoryTag>( i ) ), now.live[ i ] - since.live[ i ], bytes );
+      leaked += bytes;
+    }
+    return leaked;
+  }
+
+  void MemoryTracker::report() noexcept {
+    for ( std::size_t i = 0; i < MEMORY_TAG_COUNT; i++ ) {
+      const MemoryStats tag = stats( static_cast<MemoryTag>( i ) );
+      if ( tag.allocations == 0 ) continue;
+
+      log::info( "Memory %-8s %10zu bytes now, %10zu at peak, %zu allocations, %zu live\n",
+                 memoryTagName( static_cast<MemoryTag>( i ) ), tag.current, tag.peak, tag.allocations,
+                 tag.live );
+      if ( tag.budget > 0 ) {
+        log::info( "Memory %-8s budget of %zu bytes\n", memoryTagName( static_cast<MemoryTag>( i ) ), tag.budget );
+      }
+    }
+  }
+
+}    // namespace fn
+
+#if defined( FN_MEMORY_TRACKING )
+
+// Every global new and delete, charged to the tag of the calling thread
+
+namespace {
+
+  void *trackedNew( std::size_t size, std::size_t alignment ) {
+    void *memory = fn::MemoryTracker::allocate( size, alignment, fn::MemoryTracker::currentTag() );
+    if ( !memory ) throw std::bad_alloc();
+    return memory;
+  }
+
+  void *trackedNew( std::size_t size, std::size_t alignment, const std::nothrow_t & ) noexcept {
+    return fn::MemoryTracker::allocate( size, alignment, fn::MemoryTracker::currentTag() );
+  }
+
+}    // namespace
+
+void *operator new( std::size_t size ) {
+  return trackedNew( size, __STDCPP_DEFAULT_NEW_ALIGNMENT__ );
+}
+
+void *operator new[]( std::size_t size ) {
+  return trackedNew( size, __STDCPP_DEFAULT_NEW_ALIGNMENT__ );
+}
+
+void *operator new( std::size_t size, const std::nothrow_t &nothrow ) noexcept {
+  return trackedNew( size, __STDCPP_DEFAULT_NEW_ALIGNMENT__, nothrow );
+}
+
+void *operator new[]( std::size_t size, const std::nothrow_t &nothrow ) noexcept {
+  return trackedNew( size, __STDCPP_DEFAULT_NEW_ALIGNMENT__, nothrow );
+}
+
+void *operator new( std::size_t size, std::align_val_t alignment ) {
+  return trackedNew( size, static_cast<std::size_t>( alignment ) );
+}
+
+void *operator new[]( std::size_t size, std::align_val_t alignment ) {
+  return trackedNew( size, static_cast<std::size_t>( alignment ) );
+}
+
+void *operator new( std::size_t size, std::align_val_t alignment, const std::nothrow_t &nothrow ) noexcept {
+  return trackedNew( size, static_cast<std::size_t>( alignment ), nothrow );
+}
+
+void *operator new[]( std::size_t size, std::align_val_t alignment, const std::nothrow_t &nothrow ) noexcept {
+  return trackedNew( size, static_cast<std::size_t>( alignment ), nothrow );
+}
+
+void operator delete( void *memory ) noexcept {
+  fn::MemoryTracker::deallocate( memory );
+}
+
+void operator delete[]( void *memory ) noexcept {
+  fn::MemoryTracker::deallocate( memory );
+}
+
+void operator delete( void *memory, std::size_t ) noexcept {
+  fn::MemoryTracker::deallocate( memory );
+}
+
+void operator delete[]( void *memory, std::size_t ) noexcept {
+  fn::MemoryTracker::deallocate( memory );
+}
+
+void operator delete( void *memory, const std::nothrow_t & ) noexcept {
+  fn::MemoryTracker::deallocate( memory );
+}
+
+void operator delete[]( void *memory, const std::nothrow_t & ) noexcept {
+  fn::MemoryTracker::deallocate( memory );
+}
+
+void operator delete( void *memory, std::align_val_t ) noexcept {
+  fn::MemoryTracker::deallocate( memory );
+}
+
+void operator delete[]( void *memory, std::align_val_t ) noexcept {
+  fn::MemoryTracker::deallocate( memory );
+}
+
+void operator delete( void *memory, std::size_t, std::align_val_t ) noexcept {
+  fn::MemoryTracker::deallocate( memory );
+}
+
+void operator delete[]( void *memory, std::size_t, std::align_val_t ) noexcept {
+  fn::MemoryTracker::deallocate( memory );
+}
+
+void operator delete( void *memory, std::align_val_t, const std::nothrow_t & ) noexcept {
+  fn::MemoryTracker::deallocate( memory );
+}
+
+void operator delete[]( void *memory, std::align_val_t, const std::nothrow_t & ) noexcept {
+  fn::MemoryTracker::deallocate( memory );
+}
+
+#endif
@@ -0,0 +1,281 @@
+#include "core/profiler.hh"
+#include "core/logger.hh"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <ostream>
+#include <vector>
+
+namespace fn {
+
+  std::atomic<bool> Profiler::m_capturing{false};
+
+  namespace {
+
+    constexpr uint64_t EVENT_MASK = Profiler::EVENTS_PER_THREAD - 1;
+    static_assert( ( Profiler::EVENTS_PER_THREAD & EVENT_MASK ) == 0, "capacity must be a power of two" );
+
+    // Atomic fields, the exporter may read a slot while its thread writes it
+    struct Event {
+      std::atomic<const char *> name{nullptr};
+      std::atomic<uint64_t> begin{0};
+      std::atomic<uint64_t> end{0};
+
+      // Set for counter samples, taken at begin
+      std::atomic<bool> counter{false};
+      std::atomic<double> value{0.0};
+    };
+
+    struct ThreadEvents {
+      uint32_t id = 0;
+      std::string name;
+
+      // Events written, and events whose writing has started: a copy of a
+      // slot is only valid if its thread did not start to reuse it meanwhile
+      std::atomic<uint64_t> written{0};
+      std::atomic<uint64_t> reserved{0};
+
+      // Allocated by the first event of the thread, threads that only get a
+      // name, or record outside of any capture, never pay for the ring
+      std::atomic<Event *> events{nullptr};
+
+      ~ThreadEvents() noexcept {
+        delete[] events.load( std::memory_order_relaxed );
+      }
+    };
+
+    struct Registry {
+      std::mutex mutex;
+      std::vector<std::unique_ptr<ThreadEvents>> threads;
+
+      std::atomic<uint64_t> captureBegin{0};
+      std::atomic<uint32_t> framesLeft{0};
+      std::string capturePath;
+    };
+
+    // Never destroyed, threads may still record during static destruction
+    Registry &registry() noexcept {
+      static Registry *instance = new Registry();
+      return *instance;
+    }
+
+    thread_local ThreadEvents *t_events = nullptr;
+
+    // Buffers outlive their threads, so do the events of the trace
+    ThreadEvents &threadEvents() {
+      if ( !t_events ) {
+        Registry &shared = registry();
+        std::lock_guard<std::mutex> lock( shared.mutex );
+        shared.threads.push_back( std::make_unique<ThreadEvents>() );
+        t_events = shared.threads.back().get();
+        t_events->id = static_cast<uint32_t>( shared.threads.size() - 1 );
+        t_events->name = "thread " + std::to_string( t_events->id );
+      }
+      return *t_events;
+    }
+
+    void writeString( std::ostream &out, const char *text ) {
+      out << '"';
+      for ( const char *c = text; *c; c++ ) {
+        if ( *c == '"' || *c == '\\' ) {
+          out << '\\' << *c;
+        } else if ( static_cast<unsigned char>( *c ) < 0x20 ) {
+          out << ' ';
+        } else {
+          out << *c;
+        }
+      }
+      out << '"';
+    }
+
+    // Chrome traces count in microseconds
+    void writeMicroseconds( std::ostream &out, uint64_t nanoseconds ) {
+      char buffer[ 32 ];
+      std::snprintf( buffer, sizeof( buffer ), "%.3f", static_cast<double>( nanoseconds ) / 1000.0 );
+      out << buffer;
+    }
+
+    struct Copy {
+      const char *name;
+      uint64_t begin;
+      uint64_t end;
+      bool counter;
+      double value;
+    };
+
+    void push( const char *name, uint64_t begin, uint64_t end, bool counter, double value ) noexcept {
+      ThreadEvents &events = threadEvents();
+      Event *ring = events.events.load( std::memory_order_relaxed );
+      if ( !ring ) {
+        ring = new ( std::nothrow ) Event[ Profiler::EVENTS_PER_THREAD ];
+        if ( !ring ) return;
+        events.events.store( ring, std::memory_order_release );
+      }
+      const uint64_t index = events.written.load( std::memory_order_relaxed );
+
+      events.reserved.store( index + 1, std::memory_order_relaxed );
+      std::atomic_thread_fence( std::memory_order_release );
+
+      Event &event = ring[ index & EVENT_MASK ];
+      event.name.store( name, std::memory_order_relaxed );
+      event.begin.store( begin, std::memory_order_relaxed );
+      event.end.store( end, std::memory_order_relaxed );
+      event.counter.store( counter, std::memory_order_relaxed );
+      event.value.store( value, std::memory_order_relaxed );
+      events.written.store( index + 1, std::memory_order_release );
+    }
+
+    struct ThreadCopy {
+      uint32_t id;
+      std::string name;
+      std::vector<Copy> events;
+    };
+
+  }    // namespace
+
+  uint64_t Profiler::now() noexcept {
+    using clock = std::chrono::steady_clock;
+    static const clock::time_point epoch = clock::now();
+    return static_cast<uint64_t>( std::chrono::duration_cast<std::chrono::nanoseconds>( clock::now() - epoch ).count() );
+  }
+
+  void Profiler::start() noexcept {
+    registry().captureBegin.store( now(), std::memory_order_relaxed );
+    m_capturing.store( true, std::memory_order_relaxed );
+  }
+
+  void Profiler::stop() noexcept {
+    m_capturing.store( false, std::memory_order_relaxed );
+  }
+
+  void Profiler::captureFrames( uint32_t frames, const std::string &path ) {
+    if ( frames == 0 ) return;
+
+    Registry &shared = registry();
+    {
+      std::lock_guard<std::mutex> lock( shared.mutex );
+      shared.capturePath = path;
+    }
+    shared.framesLeft.store( frames, std::memory_order_relaxed );
+    start();
+  }
+
+  void Profiler::endFrame() noexcept {
+    Registry &shared = registry();
+    if ( shared.framesLeft.load( std::memory_order_relaxed ) == 0 ) return;
+    if ( shared.framesLeft.fetch_sub( 1, std::memory_order_relaxed ) != 1 ) return;
+
+    stop();
+    std::string path;
+    {
+      std::lock_guard<std::mutex> lock( shared.mutex );
+      path = shared.capturePath;
+    }
+    if ( writeTrace( path ) ) log::info( "Profiler trace written to %s\n", path.c_str() );
+  }
+
+  void Profiler::setThreadName( const std::string &name ) {
+    ThreadEvents &events = threadEvents();
+    std::lock_guard<std::mutex> lock( registry().mutex );
+    events.name = name;
+  }
+
+  void Profiler::record( const char *name, uint64_t begin, uint64_t end ) noexcept {
+    push( name, begin, end, false, 0.0 );
+  }
+
+  void Profiler::counter( const char *name, double value ) noexcept {
+    if ( !isCapturing() ) return;
+    const uint64_t time = now();
+    push( name, time, time, true, value );
+  }
+
+  bool Profiler::writeTrace( const std::string &path ) {
+    std::ofstream file( path );
+    if ( !file.is_open() ) {
+      log::error( "Failed to open profiler trace %s\n", path.c_str() );
+      return false;
+    }
+
+    writeTrace( file );
+    return static_cast<bool>( file );
+  }
+
+  void Profiler::writeTrace( std::ostream &out ) {
+    Registry &shared = registry();
+    const uint64_t captureBegin = shared.captureBegin.load( std::memory_order_relaxed );
+
+    // Copied under the lock, written out after it
+    std::vector<ThreadCopy> threads;
+    {
+      std::lock_guard<std::mutex> lock( shared.mutex );
+      threads.reserve( shared.threads.size() );
+
+      for ( const auto &events : shared.threads ) {
+        ThreadCopy &copy = threads.emplace_back();
+        copy.id = events->id;
+        copy.name = events->name;
+
+        const Event *ring = events->events.load( std::memory_order_acquire );
+        if ( !ring ) continue;
+
+        const uint64_t written = events->written.load( std::memory_order_acquire );
+        const uint64_t first = written > EVENTS_PER_THREAD ? written - EVENTS_PER_THREAD : 0;
+        for ( uint64_t i = first; i < written; i++ ) {
+          const Event &event = ring[ i & EVENT_MASK ];
+          copy.events.push_back( {event.name.load( std::memory_order_relaxed ),
+                                  event.begin.load( std::memory_order_relaxed ),
+                                  event.end.load( std::memory_order_relaxed ),
+                                  event.counter.load( std::memory_order_relaxed ),
+                                  event.value.load( std::memory_order_relaxed )} );
+        }
+
+        // Drop the slots the thread started to overwrite while they were copied
+        std::atomic_thread_fence( std::memory_order_acquire );
+        const uint64_t reserved = events->reserved.load( std::memory_order_relaxed );
+        const uint64_t valid = reserved > EVENTS_PER_THREAD ? reserved - EVENTS_PER_THREAD : 0;
+        if ( valid > first ) {
+          const uint64_t torn = std::min<uint64_t>( valid - first, copy.events.size() );
+          copy.events.erase( copy.events.begin(), copy.events.begin() + static_cast<std::ptrdiff_t>( torn ) );
+        }
+      }
+    }
+
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    bool first = true;
+    for ( const ThreadCopy &thread : threads ) {
+      out << ( first ? "\n" : ",\n" );
+      first = false;
+      out << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << thread.id << ",\"args\":{\"name\":";
+      writeString( out, thread.name.c_str() );
+      out << "}}";
+
+      for ( const Copy &event : thread.events ) {
+        if ( !event.name || event.begin < captureBegin ) continue;
+
+        out << ",\n{\"name\":";
+        writeString( out, event.name );
+        if ( event.counter ) {
+          out << ",\"ph\":\"C\",\"pid\":1,\"tid\":" << thread.id << ",\"ts\":";
+          writeMicroseconds( out, event.begin - captureBegin );
+          char value[ 32 ];
+          std::snprintf( value, sizeof( value ), "%.6g", event.value );
+          out << ",\"args\":{\"value\":" << value << "}}";
+        } else {
+          out << ",\"cat\":\"cpu\",\"ph\":\"X\",\"pid\":1,\"tid\":" << thread.id << ",\"ts\":";
+          writeMicroseconds( out, event.begin - captureBegin );
+          out << ",\"dur\":";
+          writeMicroseconds( out, event.end - event.begin );
+          out << "}";
+        }
+      }
+    }
+    out << "\n]}\n";
+  }
+
+}    // namespace fn
@@ -0,0 +1,52 @@
+#include "ecs/scheduler.hh"
+
+#include <algorithm>
+#include <utility>
+
+namespace fn {
+
+  namespace ecs {
+
+    namespace {
+
+      bool conflicts( ComponentMask readsA, ComponentMask writesA, ComponentMask readsB,
+                      ComponentMask writesB ) noexcept {
+        return ( writesA & ( readsB | writesB ) ) || ( writesB & readsA );
+      }
+
+    }    // namespace
+
+    void SystemScheduler::add( const char *name, ComponentMask reads, ComponentMask writes, Function function ) {
+      uint32_t phase = 0;
+      for ( const System &system : m_systems ) {
+        if ( conflicts( system.reads, system.writes, reads, writes ) ) {
+          phase = std::max( phase, system.phase + 1 );
+        }
+      }
+
+      if ( phase == m_phases.size() ) m_phases.emplace_back();
+      m_phases[ phase ].push_back( static_cast<uint32_t>( m_systems.size() ) );
+      m_systems.push_back( {name, reads, writes, std::move( function ), phase} );
+    }
+
+    void SystemScheduler::run( World &world, JobSystem &jobs ) {
+      for ( const std::vector<uint32_t> &phase : m_phases ) {
+        if ( phase.size() == 1 ) {
+          m_systems[ phase.front() ].function( world, jobs );
+          continue;
+        }
+
+        JobCounter counter;
+        World *target = &world;
+        JobSystem *system = &jobs;
+        for ( uint32_t index : phase ) {
+          const Function *function = &m_systems[ index ].function;
+          jobs.schedule( counter, [function, target, system] { ( *function )( *target, *system ); } );
+        }
+        jobs.wait( counter );
+      }
+    }
+
+  }    // namespace ecs
+
+}    // namespace fn
@@ -0,0 +1,74 @@
+#include "ecs/systems.hh"
+#include "math/batch.hh"
+
+#include <cmath>
+#include <type_traits>
+
+namespace fn {
+
+  namespace ecs {
+
+    static_assert( sizeof( WorldBounds ) == sizeof( AABB ) && std::is_standard_layout_v<WorldBounds>,
+                   "a WorldBounds column is read as an array of AABB" );
+
+    void updateTransforms( World &world, JobSystem &jobs ) {
+      world.parallelEach<const LocalTransform, WorldTransform>(
+          jobs, []( const LocalTransform &local, WorldTransform &transform ) {
+            transform.matrix = Affine3::fromTRS( local.position, local.rotation, local.scale );
+          } );
+    }
+
+    void updateBounds( World &world, JobSystem &jobs ) {
+      world.parallelEach<const WorldTransform, const LocalBounds, WorldBounds>(
+          jobs, []( const WorldTransform &transform, const LocalBounds &local, WorldBounds &bounds ) {
+            // Arvo: the extents along each world axis are the absolute
+            // linear part applied to the local extents
+            const Affine3 &m = transform.matrix;
+            const Vec3 center = m.transformPoint( local.box.center() );
+            const Vec3 e = local.box.extents();
+            auto extent = [&e]( const Vec4 &row ) {
+              return std::fabs( row.x ) * e.x + std::fabs( row.y ) * e.y + std::fabs( row.z ) * e.z;
+            };
+            const Vec3 extents( extent( m[ 0 ] ), extent( m[ 1 ] ), extent( m[ 2 ] ) );
+            bounds.box = AABB( center - extents, center + extents );
+          } );
+    }
+
+    void addTransformSystems( SystemScheduler &systems ) {
+      systems.add( "transforms", componentMask<LocalTransform>(), componentMask<WorldTransform>(),
+                   updateTransforms );
+      systems.add( "bounds", componentMask<WorldTransform, LocalBounds>(), componentMask<WorldBounds>(),
+                   updateBounds );
+    }
+
+    std::size_t gatherRenderables( World &world, const Frustum *frustum, std::vector<glm::mat4> &transforms ) {
+      transforms.clear();
+
+      std::size_t culled = 0;
+      std::vector<uint32_t> visible;
+      world.eachChunk<const WorldTransform, const Renderable>( [&]( const ChunkView &chunk ) {
+        const WorldTransform *models = chunk.column<const WorldTransform>();
+        const WorldBounds *bounds = chunk.column<const WorldBounds>();
+
+        if ( !frustum || !bounds ) {
+          for ( uint32_t i = 0; i < chunk.count(); i++ ) {
+            transforms.push_back( static_cast<glm::mat4>( models[ i ].matrix ) );
+          }
+          return;
+        }
+
+        visible.resize( chunk.count() );
+        const std::size_t count =
+            Math::cullBoxes( *frustum, reinterpret_cast<const AABB *>( bounds ), chunk.count(), visible.data() );
+        for ( std::size_t i = 0; i < count; i++ ) {
+          transforms.push_back( static_cast<glm::mat4>( models[ visible[ i ] ].matrix ) );
+        }
+        culled += chunk.count() - count;
+      } );
+
+      return culled;
+    }
+
+  }    // namespace ecs
+
+}    // namespace fn
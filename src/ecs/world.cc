@@ -0,0 +1,214 @@
+#include "ecs/world.hh"
+#include "core/logger.hh"
+#include "core/memory_tracker.hh"
+
+#include <algorithm>
+
+namespace fn {
+
+  namespace ecs {
+
+    namespace {
+
+      std::array<ComponentInfo, MAX_COMPONENTS> g_components;
+      uint32_t g_componentCount = 0;
+      std::mutex g_registryMutex;
+
+      std::size_t alignUp( std::size_t offset, std::size_t alignment ) noexcept {
+        return ( offset + alignment - 1 ) / alignment * alignment;
+      }
+
+      // Offsets of the columns for `rows` rows, returns the bytes they take
+      std::size_t layout( Archetype &archetype, uint32_t rows ) noexcept {
+        std::size_t offset = sizeof( Entity ) * rows;
+        for ( std::size_t column = 0; column < archetype.components.size(); column++ ) {
+          const ComponentInfo &info = componentInfo( archetype.components[ column ] );
+          offset = alignUp( offset, info.alignment );
+          archetype.offsets[ column ] = offset;
+          offset += info.size * rows;
+        }
+        return offset;
+      }
+
+    }    // namespace
+
+    namespace detail {
+
+      uint32_t registerComponent( const ComponentInfo &info ) noexcept {
+        std::lock_guard<std::mutex> lock( g_registryMutex );
+        const uint32_t id = g_componentCount;
+        if ( id == MAX_COMPONENTS ) {
+          log::fatal( "More than %u component types\n", MAX_COMPONENTS );
+        }
+        if ( info.alignment > Archetype::CHUNK_ALIGNMENT ) {
+          log::fatal( "Component alignment %zu above the chunk alignment\n", info.alignment );
+        }
+
+        g_components[ id ] = info;
+        g_componentCount = id + 1;
+        return id;
+      }
+
+    }    // namespace detail
+
+    const ComponentInfo &componentInfo( uint32_t id ) noexcept {
+      return g_components[ id ];
+    }
+
+    World::World() noexcept = default;
+
+    World::~World() noexcept {
+      for ( auto &archetype : m_archetypes ) {
+        for ( std::size_t column = 0; column < archetype->components.size(); column++ ) {
+          const ComponentInfo &info = componentInfo( archetype->components[ column ] );
+          for ( uint32_t row = 0; row < archetype->size; row++ ) {
+            info.destroy( archetype->component( static_cast<uint32_t>( column ), row ) );
+          }
+        }
+        for ( const Archetype::Chunk &chunk : archetype->chunks ) {
+          ::operator delete( chunk.data, std::align_val_t( Archetype::CHUNK_ALIGNMENT ) );
+        }
+      }
+    }
+
+    Entity World::create() {
+      Entity entity;
+      if ( m_freeIndices.empty() ) {
+        entity.index = static_cast<uint32_t>( m_records.size() );
+        m_records.push_back( {nullptr, 0, 0} );
+      } else {
+        entity.index = m_freeIndices.back();
+        m_freeIndices.pop_back();
+      }
+      entity.generation = m_records[ entity.index ].generation;
+
+      Archetype &empty = archetypeFor( 0 );
+      m_records[ entity.index ].archetype = &empty;
+      m_records[ entity.index ].row = allocateRow( empty, entity );
+      return entity;
+    }
+
+    void World::destroy( Entity entity ) noexcept {
+      if ( !isAlive( entity ) ) return;
+
+      Record &record = m_records[ entity.index ];
+      Archetype &archetype = *record.archetype;
+      for ( std::size_t column = 0; column < archetype.components.size(); column++ ) {
+        componentInfo( archetype.components[ column ] )
+            .destroy( archetype.component( static_cast<uint32_t>( column ), record.row ) );
+      }
+      removeRow( archetype, record.row );
+
+      record.archetype = nullptr;
+      record.generation++;
+      m_freeIndices.push_back( entity.index );
+    }
+
+    Archetype &World::archetypeFor( ComponentMask mask ) {
+      auto found = m_archetypesByMask.find( mask );
+      if ( found != m_archetypesByMask.end() ) return *found->second;
+
+      auto archetype = std::make_unique<Archetype>();
+      archetype->mask = mask;
+      archetype->columns.fill( -1 );
+      for ( uint32_t id = 0; id < MAX_COMPONENTS; id++ ) {
+        if ( mask & ( ComponentMask( 1 ) << id ) ) {
+          archetype->columns[ id ] = static_cast<int8_t>( archetype->components.size() );
+          archetype->components.push_back( id );
+          archetype->sizes.push_back( componentInfo( id ).size );
+        }
+      }
+      archetype->offsets.resize( archetype->components.size() );
+
+      // As many rows as fit in a chunk, and at least one for huge components
+      std::size_t rowBytes = sizeof( Entity );
+      for ( std::size_t size : archetype->sizes ) rowBytes += size;
+      uint32_t rows = static_cast<uint32_t>( std::max<std::size_t>( Archetype::CHUNK_BYTES / rowBytes, 1 ) );
+      while ( rows > 1 && layout( *archetype, rows ) > Archetype::CHUNK_BYTES ) rows--;
+      archetype->capacity = rows;
+      archetype->chunkBytes = layout( *archetype, rows );
+
+      Archetype *created = archetype.get();
+      m_archetypes.push_back( std::move( archetype ) );
+      m_archetypesByMask.emplace( mask, created );
+
+      std::lock_guard<std::mutex> lock( m_queryMutex );
+      for ( auto &query : m_queries ) {
+        if ( ( mask & query.first ) == query.first ) query.second.push_back( created );
+      }
+      return *created;
+    }
+
+    const std::vector<Archetype *> &World::matching( ComponentMask mask ) {
+      std::lock_guard<std::mutex> lock( m_queryMutex );
+      auto found = m_queries.find( mask );
+      if ( found != m_queries.end() ) return found->second;
+
+      std::vector<Archetype *> &archetypes = m_queries[ mask ];
+      for ( auto &archetype : m_archetypes ) {
+        if ( ( archetype->mask & mask ) == mask ) archetypes.push_back( archetype.get() );
+      }
+      return archetypes;
+    }
+
+    void World::moveEntity( Entity entity, Archetype &to ) {
+      Record &record = m_records[ entity.index ];
+      Archetype &from = *record.archetype;
+      const uint32_t row = allocateRow( to, entity );
+
+      for ( std::size_t column = 0; column < from.components.size(); column++ ) {
+        const uint32_t id = from.components[ column ];
+        void *component = from.component( static_cast<uint32_t>( column ), record.row );
+        if ( to.columns[ id ] >= 0 ) {
+          componentInfo( id ).relocate( to.component( static_cast<uint32_t>( to.columns[ id ] ), row ), component );
+        } else {
+          componentInfo( id ).destroy( component );
+        }
+      }
+      removeRow( from, record.row );
+
+      record.archetype = &to;
+      record.row = row;
+    }
+
+    uint32_t World::allocateRow( Archetype &archetype, Entity entity ) {
+      if ( archetype.size == archetype.chunks.size() * archetype.capacity ) {
+        FN_MEMORY_SCOPE( Ecs );
+        auto *data = static_cast<unsigned char *>(
+            ::operator new( archetype.chunkBytes, std::align_val_t( Archetype::CHUNK_ALIGNMENT ) ) );
+        archetype.chunks.push_back( {data, 0} );
+      }
+
+      const uint32_t row = archetype.size++;
+      Archetype::Chunk &chunk = archetype.chunks[ row / archetype.capacity ];
+      archetype.entities( chunk )[ chunk.count++ ] = entity;
+      return row;
+    }
+
+    void World::removeRow( Archetype &archetype, uint32_t row ) noexcept {
+      const uint32_t last = archetype.size - 1;
+      Archetype::Chunk &lastChunk = archetype.chunks[ last / archetype.capacity ];
+
+      // Fill the hole with the last row, chunks stay dense
+      if ( row != last ) {
+        for ( std::size_t column = 0; column < archetype.components.size(); column++ ) {
+          componentInfo( archetype.components[ column ] )
+              .relocate( archetype.component( static_cast<uint32_t>( column ), row ),
+                         archetype.component( static_cast<uint32_t>( column ), last ) );
+        }
+
+        const Entity moved = archetype.entities( lastChunk )[ last % archetype.capacity ];
+        archetype.entities( archetype.chunks[ row / archetype.capacity ] )[ row % archetype.capacity ] = moved;
+        m_records[ moved.index ].row = row;
+      }
+
+      archetype.size--;
+      if ( --lastChunk.count == 0 ) {
+        ::operator delete( lastChunk.data, std::align_val_t( Archetype::CHUNK_ALIGNMENT ) );
+        archetype.chunks.pop_back();
+      }
+    }
+
+  }    // namespace ecs
+
+}    // namespace fn
@@ -0,0 +1,250 @@
+/* =======================================================================
+   $File: affine.cc
+   $Date: 16/10/2026
+   $Revision:
+   $Creator: Rostislav Orestis Stelmach
+   $Notice:  This file is a part of Thesis project ( stracer ) for
+   the Technical Educational Institute of Western Macedonia
+   Supervisor: Dr. George Sisias
+   ======================================================================== */
+
+//Engine Internal
+#include "math/affine.hh"
+#include "math/simd.hh"
+
+namespace fn {
+
+  namespace {
+
+    //
+    // Kernels work on 12 contiguous floats, three rows of ( linear | translation ).
+    // The implicit last row ( 0, 0, 0, 1 ) is never stored nor multiplied.
+    //
+
+    void multiplyKernel(const float* a, const float* b, float* out) noexcept {
+#if defined(FN_SIMD_SSE41)
+      const __m128 b0 = _mm_load_ps(b + 0);
+      const __m128 b1 = _mm_load_ps(b + 4);
+      const __m128 b2 = _mm_load_ps(b + 8);
+
+      __m128 rows[3] = { _mm_load_ps(a + 0), _mm_load_ps(a + 4), _mm_load_ps(a + 8) };
+      for ( int i = 0; i < 3; i++ ) {
+        // a_i3 only meets the implicit 1 of b, so it passes straight through
+        __m128 r = _mm_blend_ps(_mm_setzero_ps(), rows[i], 0x8);
+        r = simd::madd(simd::splat<0>(rows[i]), b0, r);
+        r = simd::madd(simd::splat<1>(rows[i]), b1, r);
+        r = simd::madd(simd::splat<2>(rows[i]), b2, r);
+        rows[i] = r;
+      }
+
+      _mm_store_ps(out + 0, rows[0]);
+      _mm_store_ps(out + 4, rows[1]);
+      _mm_store_ps(out + 8, rows[2]);
+#else
+      float result[12];
+      for ( int r = 0; r < 3; r++ ) {
+        for ( int c = 0; c < 4; c++ ) {
+          result[r * 4 + c] =
+            a[r * 4 + 0] * b[0 + c] + a[r * 4 + 1] * b[4 + c] + a[r * 4 + 2] * b[8 + c];
+        }
+        result[r * 4 + 3] += a[r * 4 + 3];
+      }
+      for ( int i = 0; i < 12; i++ ) out[i] = result[i];
+#endif
+    }
+
+#if defined(FN_SIMD_SSE41)
+
+    inline __m128 cross3(__m128 a, __m128 b) noexcept {
+      return simd::nmadd(simd::swizzle<2, 0, 1, 3>(a), simd::swizzle<1, 2, 0, 3>(b),
+                         _mm_mul_ps(simd::swizzle<1, 2, 0, 3>(a), simd::swizzle<2, 0, 1, 3>(b)));
+    }
+
+    // c0, c1, c2 are the columns of the inverse linear part before the scale,
+    // the new translation is -( inverse * t )
+    inline void storeInverse(__m128 c0, __m128 c1, __m128 c2, const float* in, __m128 scale,
+                             float* out) noexcept {
+      __m128 t = _mm_mul_ps(c0, _mm_set1_ps(in[3]));
+      t = simd::madd(c1, _mm_set1_ps(in[7]), t);
+      t = simd::madd(c2, _mm_set1_ps(in[11]), t);
+      t = _mm_mul_ps(t, _mm_sub_ps(_mm_setzero_ps(), scale));
+
+      __m128 c3 = _mm_setzero_ps();
+      _MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+
+      _mm_store_ps(out + 0, _mm_blend_ps(_mm_mul_ps(c0, scale), simd::splat<0>(t), 0x8));
+      _mm_store_ps(out + 4, _mm_blend_ps(_mm_mul_ps(c1, scale), simd::splat<1>(t), 0x8));
+      _mm_store_ps(out + 8, _mm_blend_ps(_mm_mul_ps(c2, scale), simd::splat<2>(t), 0x8));
+    }
+
+#endif
+
+    // Returns the determinant of the linear part, out is not written when it is 0
+    float inverseKernel(const float* in, float* out) noexcept {
+#if defined(FN_SIMD_SSE41)
+      const __m128 r0 = _mm_load_ps(in + 0);
+      const __m128 r1 = _mm_load_ps(in + 4);
+      const __m128 r2 = _mm_load_ps(in + 8);
+
+      // Inverse of a 3x3 with rows r0, r1, r2 has columns ( r1 x r2, r2 x r0, r0 x r1 ) / det
+      const __m128 c0 = cross3(r1, r2);
+      const __m128 c1 = cross3(r2, r0);
+      const __m128 c2 = cross3(r0, r1);
+
+      const float d = _mm_cvtss_f32(_mm_dp_ps(r0, c0, 0x71));
+      if ( d == 0.0f ) {
+        return d;
+      }
+
+      storeInverse(c0, c1, c2, in, _mm_set1_ps(1.0f / d), out);
+      return d;
+#else
+      const float a00 = in[0], a01 = in[1], a02 = in[2];
+      const float a10 = in[4], a11 = in[5], a12 = in[6];
+      const float a20 = in[8], a21 = in[9], a22 = in[10];
+
+      const float c00 = a11 * a22 - a12 * a21;
+      const float c10 = a12 * a20 - a10 * a22;
+      const float c20 = a10 * a21 - a11 * a20;
+
+      const float d = a00 * c00 + a01 * c10 + a02 * c20;
+      if ( d == 0.0f ) {
+        return d;
+      }
+
+      const float id = 1.0f / d;
+      const float i00 = c00 * id, i01 = (a02 * a21 - a01 * a22) * id, i02 = (a01 * a12 - a02 * a11) * id;
+      const float i10 = c10 * id, i11 = (a00 * a22 - a02 * a20) * id, i12 = (a02 * a10 - a00 * a12) * id;
+      const float i20 = c20 * id, i21 = (a01 * a20 - a00 * a21) * id, i22 = (a00 * a11 - a01 * a10) * id;
+
+      const float tx = in[3], ty = in[7], tz = in[11];
+
+      out[0] = i00; out[1] = i01; out[2]  = i02; out[3]  = -(i00 * tx + i01 * ty + i02 * tz);
+      out[4] = i10; out[5] = i11; out[6]  = i12; out[7]  = -(i10 * tx + i11 * ty + i12 * tz);
+      out[8] = i20; out[9] = i21; out[10] = i22; out[11] = -(i20 * tx + i21 * ty + i22 * tz);
+
+      return d;
+#endif
+    }
+
+    // Orthonormal linear part, the inverse is its transpose
+    void rigidInverseKernel(const float* in, float* out) noexcept {
+#if defined(FN_SIMD_SSE41)
+      // Columns of the transpose are the rows, their w lanes are dropped by the transpose
+      storeInverse(_mm_load_ps(in + 0), _mm_load_ps(in + 4), _mm_load_ps(in + 8), in,
+                   _mm_set1_ps(1.0f), out);
+#else
+      const float tx = in[3], ty = in[7], tz = in[11];
+
+      float result[12];
+      for ( int r = 0; r < 3; r++ ) {
+        result[r * 4 + 0] = in[0 + r];
+        result[r * 4 + 1] = in[4 + r];
+        result[r * 4 + 2] = in[8 + r];
+        result[r * 4 + 3] = -(in[0 + r] * tx + in[4 + r] * ty + in[8 + r] * tz);
+      }
+      for ( int i = 0; i < 12; i++ ) out[i] = result[i];
+#endif
+    }
+
+  }
+
+  Affine3::Affine3(const glm::mat4& a)
+    : m{ row_major(a[0][0], a[1][0], a[2][0], a[3][0]),
+         row_major(a[0][1], a[1][1], a[2][1], a[3][1]),
+         row_major(a[0][2], a[1][2], a[2][2], a[3][2]) } { }
+
+  Affine3 Affine3::fromRotation(const Quat& q) {
+
+    return fromTRS(Vec3(0.0f), q, Vec3(1.0f));
+  }
+
+  Affine3 Affine3::fromTRS(const Vec3& t, const Quat& r, const Vec3& s) {
+
+    const float xx = r.x * r.x, yy = r.y * r.y, zz = r.z * r.z;
+    const float xy = r.x * r.y, xz = r.x * r.z, yz = r.y * r.z;
+    const float wx = r.w * r.x, wy = r.w * r.y, wz = r.w * r.z;
+
+    // Rows of Quat::toMatrix(), with column j scaled by s[j]
+    return Affine3(
+      row_major((1.0f - 2.0f * (yy + zz)) * s.x, 2.0f * (xy - wz) * s.y, 2.0f * (xz + wy) * s.z, t.x),
+      row_major(2.0f * (xy + wz) * s.x, (1.0f - 2.0f * (xx + zz)) * s.y, 2.0f * (yz - wx) * s.z, t.y),
+      row_major(2.0f * (xz - wy) * s.x, 2.0f * (yz + wx) * s.y, (1.0f - 2.0f * (xx + yy)) * s.z, t.z)
+      );
+  }
+
+  Affine3::operator glm::mat4() const {
+
+    glm::mat4 result(1.0f);
+
+    for ( int r = 0; r < 3; r++ ) {
+      result[0][r] = this->m[r].x;
+      result[1][r] = this->m[r].y;
+      result[2][r] = this->m[r].z;
+      result[3][r] = this->m[r].w;
+    }
+
+    return result;
+  }
+
+  Affine3& Affine3::operator *=(const Affine3& rhs) {
+
+    multiplyKernel(this->data(), rhs.data(), this->data());
+    return *this;
+  }
+
+  Affine3 operator *(const Affine3& lhs, const Affine3& rhs) {
+
+    Affine3 result;
+    multiplyKernel(lhs.data(), rhs.data(), result.data());
+    return result;
+  }
+
+  float Affine3::determinant() const {
+
+    return dotProduct(Vec3(m[0].x, m[0].y, m[0].z),
+                      crossProduct(Vec3(m[1].x, m[1].y, m[1].z), Vec3(m[2].x, m[2].y, m[2].z)));
+  }
+
+  void Affine3::inverse() {
+
+    inverseKernel(this->data(), this->data());
+  }
+
+  Affine3 Affine3::inversed() const {
+
+    Affine3 result(*this);
+    result.inverse();
+    return result;
+  }
+
+  void Affine3::rigidInverse() {
+
+    rigidInverseKernel(this->data(), this->data());
+  }
+
+  Affine3 Affine3::rigidInversed() const {
+
+    Affine3 result(*this);
+    result.rigidInverse();
+    return result;
+  }
+
+  Vec3 Affine3::transformPoint(const Vec3& p) const {
+
+    return Vec3(
+      m[0].x * p.x + m[0].y * p.y + m[0].z * p.z + m[0].w,
+      m[1].x * p.x + m[1].y * p.y + m[1].z * p.z + m[1].w,
+      m[2].x * p.x + m[2].y * p.y + m[2].z * p.z + m[2].w
+      );
+  }
+
+  Vec3 Affine3::transformVector(const Vec3& v) const {
+
+    return Vec3(
+      m[0].x * v.x + m[0].y * v.y + m[0].z * v.z,
+      m[1].x * v.x + m[1].y * v.y + m[1].z * v.z,
+      m[2].x * v.x + m[2].y * v.y + m[2].z * v.z
+      );
+  }
+}
@@ -0,0 +1,901 @@
+/* =======================================================================
+   $File: batch.cc
+   $Date: 16/10/2026
+   $Revision:
+   $Creator: Rostislav Orestis Stelmach
+   $Notice:  This file is a part of Thesis project ( stracer ) for
+   the Technical Educational Institute of Western Macedonia
+   Supervisor: Dr. George Sisias
+   ======================================================================== */
+
+//Engine Internal
+#include "math/batch.hh"
+#include "math/math_utils.hh"
+#include "math/simd.hh"
+
+//C++ Includes
+#include <cmath>
+
+namespace fn {
+
+  namespace Math {
+
+    namespace {
+
+      //
+      // Lane operations shared by the batched inverses. A lane is a float for
+      // the scalar tail, or one matrix element of 4 / 8 matrices at once.
+      //
+
+      inline float add(float a, float b) noexcept { return a + b; }
+      inline float sub(float a, float b) noexcept { return a - b; }
+      inline float mul(float a, float b) noexcept { return a * b; }
+      inline float reciprocal(float a) noexcept { return 1.0f / a; }
+      inline float neg(float a) noexcept { return -a; }
+      inline bool isZero(float a) noexcept { return a == 0.0f; }
+      inline float root(float a) noexcept { return std::sqrt(a); }
+      inline float minimum(float a, float b) noexcept { return a < b ? a : b; }
+      inline bool isNegative(float a) noexcept { return a < 0.0f; }
+      inline bool either(bool a, bool b) noexcept { return a || b; }
+      inline float select(bool mask, float a, float b) noexcept { return mask ? a : b; }
+      inline unsigned maskBits(bool mask) noexcept { return mask ? 1u : 0u; }
+      inline float quotient(float a, float b) noexcept { return a / b; }
+      inline float nearest(float a) noexcept { return std::nearbyint(a); }
+      inline float absolute(float a) noexcept { return std::fabs(a); }
+      inline float withSignOf(float a, float s) noexcept { return std::copysign(a, s); }
+      inline float inverseRoot(float a) noexcept { return fastRsqrt(a); }
+      inline void store(float* p, float v) noexcept { *p = v; }
+      template <typename V> V broadcast(float v) noexcept;
+      template <> inline float broadcast<float>(float v) noexcept { return v; }
+      template <typename V> V load(const float* p) noexcept;
+      template <> inline float load<float>(const float* p) noexcept { return *p; }
+
+#if defined(FN_SIMD_SSE41)
+      inline __m128 add(__m128 a, __m128 b) noexcept { return _mm_add_ps(a, b); }
+      inline __m128 sub(__m128 a, __m128 b) noexcept { return _mm_sub_ps(a, b); }
+      inline __m128 mul(__m128 a, __m128 b) noexcept { return _mm_mul_ps(a, b); }
+      inline __m128 reciprocal(__m128 a) noexcept { return _mm_div_ps(_mm_set1_ps(1.0f), a); }
+      inline __m128 neg(__m128 a) noexcept { return _mm_xor_ps(a, _mm_set1_ps(-0.0f)); }
+      inline __m128 root(__m128 a) noexcept { return _mm_sqrt_ps(a); }
+      inline __m128 minimum(__m128 a, __m128 b) noexcept { return _mm_min_ps(a, b); }
+      inline __m128 isNegative(__m128 a) noexcept { return _mm_cmplt_ps(a, _mm_setzero_ps()); }
+      inline __m128 isZero(__m128 a) noexcept { return _mm_cmpeq_ps(a, _mm_setzero_ps()); }
+      inline __m128 either(__m128 a, __m128 b) noexcept { return _mm_or_ps(a, b); }
+      inline __m128 select(__m128 mask, __m128 a, __m128 b) noexcept { return _mm_blendv_ps(b, a, mask); }
+      inline unsigned maskBits(__m128 mask) noexcept { return static_cast<unsigned>(_mm_movemask_ps(mask)); }
+      inline __m128 quotient(__m128 a, __m128 b) noexcept { return _mm_div_ps(a, b); }
+      inline __m128 nearest(__m128 a) noexcept { return _mm_round_ps(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+      inline __m128 absolute(__m128 a) noexcept { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a); }
+      // `a` must be positive, the sign bit of `s` is or'ed in
+      inline __m128 withSignOf(__m128 a, __m128 s) noexcept { return _mm_or_ps(a, _mm_and_ps(s, _mm_set1_ps(-0.0f))); }
+      inline void store(float* p, __m128 v) noexcept { _mm_storeu_ps(p, v); }
+      template <> inline __m128 broadcast<__m128>(float v) noexcept { return _mm_set1_ps(v); }
+      template <> inline __m128 load<__m128>(const float* p) noexcept { return _mm_loadu_ps(p); }
+
+      // Same Newton step as fastRsqrt, so every lane matches the scalar result
+      inline __m128 inverseRoot(__m128 a) noexcept {
+        const __m128 y = _mm_rsqrt_ps(a);
+        const __m128 h = _mm_mul_ps(_mm_mul_ps(_mm_mul_ps(_mm_set1_ps(0.5f), a), y), y);
+        return _mm_mul_ps(y, _mm_sub_ps(_mm_set1_ps(1.5f), h));
+      }
+
+      // Loads four floats from each of four records `stride` floats apart and
+      // transposes them, v[j] holds element j of every record
+      inline void gather4(const float* base, size_t stride, __m128 (&v)[4]) noexcept {
+        __m128 r0 = _mm_load_ps(base);
+        __m128 r1 = _mm_load_ps(base + stride);
+        __m128 r2 = _mm_load_ps(base + 2 * stride);
+        __m128 r3 = _mm_load_ps(base + 3 * stride);
+        _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+        v[0] = r0;
+        v[1] = r1;
+        v[2] = r2;
+        v[3] = r3;
+      }
+
+      inline void scatter4(const __m128 (&v)[4], float* base, size_t stride) noexcept {
+        __m128 r0 = v[0];
+        __m128 r1 = v[1];
+        __m128 r2 = v[2];
+        __m128 r3 = v[3];
+        _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+        _mm_store_ps(base, r0);
+        _mm_store_ps(base + stride, r1);
+        _mm_store_ps(base + 2 * stride, r2);
+        _mm_store_ps(base + 3 * stride, r3);
+      }
+
+      constexpr size_t MATRIX_STRIDE = sizeof(Matrix4) / sizeof(float);
+      constexpr size_t QUAT_STRIDE = sizeof(Quat) / sizeof(float);
+      constexpr size_t SPHERE_STRIDE = sizeof(Sphere) / sizeof(float);
+      constexpr size_t BOX_STRIDE = sizeof(AABB) / sizeof(float);
+      static_assert(BOX_STRIDE == 6, "AABB must be two packed Vec3");
+
+      // Four matrices to sixteen vectors, v[c * 4 + r] holds element ( c, r ) of each one
+      void load4(const Matrix4* m, __m128 (&v)[16]) noexcept {
+        for ( int c = 0; c < 4; c++ ) {
+          __m128 col[4];
+          gather4(m[0].data() + c * 4, MATRIX_STRIDE, col);
+          for ( int r = 0; r < 4; r++ ) v[c * 4 + r] = col[r];
+        }
+      }
+
+      void store4(__m128 (&v)[16], Matrix4* m) noexcept {
+        for ( int c = 0; c < 4; c++ ) {
+          const __m128 col[4] = { v[c * 4 + 0], v[c * 4 + 1], v[c * 4 + 2], v[c * 4 + 3] };
+          scatter4(col, m[0].data() + c * 4, MATRIX_STRIDE);
+        }
+      }
+
+      // Boxes are six floats apart, so the two halves are read unaligned and
+      // overlap on min.z and max.x
+      void loadBounds(const AABB* b, __m128 (&mn)[3], __m128 (&mx)[3]) noexcept {
+        const float* base = &b[0].min.x;
+        __m128 r0 = _mm_loadu_ps(base);
+        __m128 r1 = _mm_loadu_ps(base + BOX_STRIDE);
+        __m128 r2 = _mm_loadu_ps(base + 2 * BOX_STRIDE);
+        __m128 r3 = _mm_loadu_ps(base + 3 * BOX_STRIDE);
+        _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+        mn[0] = r0;
+        mn[1] = r1;
+        mn[2] = r2;
+        mx[0] = r3;
+
+        r0 = _mm_loadu_ps(base + 2);
+        r1 = _mm_loadu_ps(base + BOX_STRIDE + 2);
+        r2 = _mm_loadu_ps(base + 2 * BOX_STRIDE + 2);
+        r3 = _mm_loadu_ps(base + 3 * BOX_STRIDE + 2);
+        _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+        mx[1] = r2;
+        mx[2] = r3;
+      }
+
+      void loadSpheres(const Sphere* s, __m128 (&v)[4]) noexcept {
+        gather4(&s[0].center.x, SPHERE_STRIDE, v);
+      }
+#endif
+
+#if defined(FN_SIMD_AVX2)
+      inline __m256 add(__m256 a, __m256 b) noexcept { return _mm256_add_ps(a, b); }
+      inline __m256 sub(__m256 a, __m256 b) noexcept { return _mm256_sub_ps(a, b); }
+      inline __m256 mul(__m256 a, __m256 b) noexcept { return _mm256_mul_ps(a, b); }
+      inline __m256 reciprocal(__m256 a) noexcept { return _mm256_div_ps(_mm256_set1_ps(1.0f), a); }
+      inline __m256 neg(__m256 a) noexcept { return _mm256_xor_ps(a, _mm256_set1_ps(-0.0f)); }
+      inline __m256 root(__m256 a) noexcept { return _mm256_sqrt_ps(a); }
+      inline __m256 minimum(__m256 a, __m256 b) noexcept { return _mm256_min_ps(a, b); }
+      inline __m256 isNegative(__m256 a) noexcept { return _mm256_cmp_ps(a, _mm256_setzero_ps(), _CMP_LT_OQ); }
+      inline __m256 isZero(__m256 a) noexcept { return _mm256_cmp_ps(a, _mm256_setzero_ps(), _CMP_EQ_OQ); }
+      inline __m256 either(__m256 a, __m256 b) noexcept { return _mm256_or_ps(a, b); }
+      inline __m256 select(__m256 mask, __m256 a, __m256 b) noexcept { return _mm256_blendv_ps(b, a, mask); }
+      inline unsigned maskBits(__m256 mask) noexcept { return static_cast<unsigned>(_mm256_movemask_ps(mask)); }
+      inline __m256 quotient(__m256 a, __m256 b) noexcept { return _mm256_div_ps(a, b); }
+      inline __m256 nearest(__m256 a) noexcept { return _mm256_round_ps(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+      inline __m256 absolute(__m256 a) noexcept { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a); }
+      inline __m256 withSignOf(__m256 a, __m256 s) noexcept { return _mm256_or_ps(a, _mm256_and_ps(s, _mm256_set1_ps(-0.0f))); }
+      inline void store(float* p, __m256 v) noexcept { _mm256_storeu_ps(p, v); }
+      template <> inline __m256 broadcast<__m256>(float v) noexcept { return _mm256_set1_ps(v); }
+      template <> inline __m256 load<__m256>(const float* p) noexcept { return _mm256_loadu_ps(p); }
+
+      inline __m256 inverseRoot(__m256 a) noexcept {
+        const __m256 y = _mm256_rsqrt_ps(a);
+        const __m256 h = _mm256_mul_ps(_mm256_mul_ps(_mm256_mul_ps(_mm256_set1_ps(0.5f), a), y), y);
+        return _mm256_mul_ps(y, _mm256_sub_ps(_mm256_set1_ps(1.5f), h));
+      }
+
+      // 4x4 transpose inside each 128 bit half
+      inline void transpose8(__m256& r0, __m256& r1, __m256& r2, __m256& r3) noexcept {
+        const __m256 t0 = _mm256_unpacklo_ps(r0, r1);
+        const __m256 t1 = _mm256_unpacklo_ps(r2, r3);
+        const __m256 t2 = _mm256_unpackhi_ps(r0, r1);
+        const __m256 t3 = _mm256_unpackhi_ps(r2, r3);
+        r0 = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(1, 0, 1, 0));
+        r1 = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(3, 2, 3, 2));
+        r2 = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(1, 0, 1, 0));
+        r3 = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(3, 2, 3, 2));
+      }
+
+      // Eight records, the first four go to the low half of every vector
+      inline void gather8(const float* base, size_t stride, __m256 (&v)[4]) noexcept {
+        for ( size_t k = 0; k < 4; k++ ) {
+          v[k] = _mm256_set_m128(_mm_load_ps(base + (k + 4) * stride),
+                                 _mm_load_ps(base + k * stride));
+        }
+        transpose8(v[0], v[1], v[2], v[3]);
+      }
+
+      inline void scatter8(const __m256 (&v)[4], float* base, size_t stride) noexcept {
+        __m256 r[4] = { v[0], v[1], v[2], v[3] };
+        transpose8(r[0], r[1], r[2], r[3]);
+        for ( size_t k = 0; k < 4; k++ ) {
+          _mm_store_ps(base + k * stride, _mm256_castps256_ps128(r[k]));
+          _mm_store_ps(base + (k + 4) * stride, _mm256_extractf128_ps(r[k], 1));
+        }
+      }
+
+      void load8(const Matrix4* m, __m256 (&v)[16]) noexcept {
+        for ( int c = 0; c < 4; c++ ) {
+          __m256 col[4];
+          gather8(m[0].data() + c * 4, MATRIX_STRIDE, col);
+          for ( int r = 0; r < 4; r++ ) v[c * 4 + r] = col[r];
+        }
+      }
+
+      void store8(__m256 (&v)[16], Matrix4* m) noexcept {
+        for ( int c = 0; c < 4; c++ ) {
+          const __m256 col[4] = { v[c * 4 + 0], v[c * 4 + 1], v[c * 4 + 2], v[c * 4 + 3] };
+          scatter8(col, m[0].data() + c * 4, MATRIX_STRIDE);
+        }
+      }
+
+      void loadBounds(const AABB* b, __m256 (&mn)[3], __m256 (&mx)[3]) noexcept {
+        const float* base = &b[0].min.x;
+        __m256 lo[4], hi[4];
+        for ( size_t k = 0; k < 4; k++ ) {
+          lo[k] = _mm256_set_m128(_mm_loadu_ps(base + (k + 4) * BOX_STRIDE),
+                                  _mm_loadu_ps(base + k * BOX_STRIDE));
+          hi[k] = _mm256_set_m128(_mm_loadu_ps(base + (k + 4) * BOX_STRIDE + 2),
+                                  _mm_loadu_ps(base + k * BOX_STRIDE + 2));
+        }
+        transpose8(lo[0], lo[1], lo[2], lo[3]);
+        transpose8(hi[0], hi[1], hi[2], hi[3]);
+        mn[0] = lo[0];
+        mn[1] = lo[1];
+        mn[2] = lo[2];
+        mx[0] = lo[3];
+        mx[1] = hi[2];
+        mx[2] = hi[3];
+      }
+
+      void loadSpheres(const Sphere* s, __m256 (&v)[4]) noexcept {
+        gather8(&s[0].center.x, SPHERE_STRIDE, v);
+      }
+#endif
+
+      void loadBounds(const AABB* b, float (&mn)[3], float (&mx)[3]) noexcept {
+        for ( unsigned j = 0; j < 3; j++ ) {
+          mn[j] = b->min[j];
+          mx[j] = b->max[j];
+        }
+      }
+
+      void loadSpheres(const Sphere* s, float (&v)[4]) noexcept {
+        v[0] = s->center.x;
+        v[1] = s->center.y;
+        v[2] = s->center.z;
+        v[3] = s->radius;
+      }
+
+      // General 4x4 inverse by cofactors, in place. Singular lanes keep their input.
+      template <typename V>
+      V inverseLanes(V (&a)[16]) noexcept {
+        const V s0 = sub(mul(a[0], a[5]), mul(a[4], a[1]));
+        const V s1 = sub(mul(a[0], a[6]), mul(a[4], a[2]));
+        const V s2 = sub(mul(a[0], a[7]), mul(a[4], a[3]));
+        const V s3 = sub(mul(a[1], a[6]), mul(a[5], a[2]));
+        const V s4 = sub(mul(a[1], a[7]), mul(a[5], a[3]));
+        const V s5 = sub(mul(a[2], a[7]), mul(a[6], a[3]));
+
+        const V c5 = sub(mul(a[10], a[15]), mul(a[14], a[11]));
+        const V c4 = sub(mul(a[9], a[15]), mul(a[13], a[11]));
+        const V c3 = sub(mul(a[9], a[14]), mul(a[13], a[10]));
+        const V c2 = sub(mul(a[8], a[15]), mul(a[12], a[11]));
+        const V c1 = sub(mul(a[8], a[14]), mul(a[12], a[10]));
+        const V c0 = sub(mul(a[8], a[13]), mul(a[12], a[9]));
+
+        const V det = add(sub(add(sub(mul(s0, c5), mul(s1, c4)), mul(s2, c3)),
+                              sub(mul(s4, c1), mul(s3, c2))), mul(s5, c0));
+        const V id = reciprocal(det);
+
+        // x * p - y * q + z * r
+        auto cof = [](V x, V p, V y, V q, V z, V r) noexcept {
+          return add(sub(mul(x, p), mul(y, q)), mul(z, r));
+        };
+
+        V out[16];
+        out[0]  = cof(a[5], c5, a[6], c4, a[7], c3);
+        out[1]  = neg(cof(a[1], c5, a[2], c4, a[3], c3));
+        out[2]  = cof(a[13], s5, a[14], s4, a[15], s3);
+        out[3]  = neg(cof(a[9], s5, a[10], s4, a[11], s3));
+
+        out[4]  = neg(cof(a[4], c5, a[6], c2, a[7], c1));
+        out[5]  = cof(a[0], c5, a[2], c2, a[3], c1);
+        out[6]  = neg(cof(a[12], s5, a[14], s2, a[15], s1));
+        out[7]  = cof(a[8], s5, a[10], s2, a[11], s1);
+
+        out[8]  = cof(a[4], c4, a[5], c2, a[7], c0);
+        out[9]  = neg(cof(a[0], c4, a[1], c2, a[3], c0));
+        out[10] = cof(a[12], s4, a[13], s2, a[15], s0);
+        out[11] = neg(cof(a[8], s4, a[9], s2, a[11], s0));
+
+        out[12] = neg(cof(a[4], c3, a[5], c1, a[6], c0));
+        out[13] = cof(a[0], c3, a[1], c1, a[2], c0);
+        out[14] = neg(cof(a[12], s3, a[13], s1, a[14], s0));
+        out[15] = cof(a[8], s3, a[9], s1, a[10], s0);
+
+        const auto singular = isZero(det);
+        for ( int i = 0; i < 16; i++ ) a[i] = select(singular, a[i], mul(out[i], id));
+        return det;
+      }
+
+      // Inverse of the 3x3 block plus translation, in place. The last row is
+      // rewritten as ( 0, 0, 0, 1 ). Singular lanes keep their input.
+      template <typename V>
+      V inverseAffineLanes(V (&a)[16]) noexcept {
+        V out[16];
+        out[0]  = sub(mul(a[5], a[10]), mul(a[9], a[6]));
+        out[4]  = neg(sub(mul(a[4], a[10]), mul(a[8], a[6])));
+        out[8]  = sub(mul(a[4], a[9]), mul(a[8], a[5]));
+        out[1]  = neg(sub(mul(a[1], a[10]), mul(a[9], a[2])));
+        out[5]  = sub(mul(a[0], a[10]), mul(a[8], a[2]));
+        out[9]  = neg(sub(mul(a[0], a[9]), mul(a[8], a[1])));
+        out[2]  = sub(mul(a[1], a[6]), mul(a[5], a[2]));
+        out[6]  = neg(sub(mul(a[0], a[6]), mul(a[4], a[2])));
+        out[10] = sub(mul(a[0], a[5]), mul(a[4], a[1]));
+
+        const V det = add(add(mul(a[0], out[0]), mul(a[4], out[1])), mul(a[8], out[2]));
+        const V id = reciprocal(det);
+
+        for ( int c = 0; c < 3; c++ )
+          for ( int r = 0; r < 3; r++ )
+            out[c * 4 + r] = mul(out[c * 4 + r], id);
+
+        for ( int r = 0; r < 3; r++ ) {
+          out[12 + r] = neg(add(add(mul(out[r], a[12]), mul(out[4 + r], a[13])),
+                                mul(out[8 + r], a[14])));
+        }
+
+        const V zero = broadcast<V>(0.0f);
+        out[3] = zero;
+        out[7] = zero;
+        out[11] = zero;
+        out[15] = broadcast<V>(1.0f);
+
+        const auto singular = isZero(det);
+        for ( int i = 0; i < 16; i++ ) a[i] = select(singular, a[i], out[i]);
+        return det;
+      }
+
+      // q[0..3] holds x, y, z, w of every lane
+      template <typename V>
+      V quatDot(const V (&a)[4], const V (&b)[4]) noexcept {
+        return add(add(mul(a[0], b[0]), mul(a[1], b[1])), add(mul(a[2], b[2]), mul(a[3], b[3])));
+      }
+
+      template <typename V>
+      void nlerpLanes(const V (&a)[4], const V (&b)[4], V t, V (&out)[4]) noexcept {
+        const auto flip = isNegative(quatDot(a, b));
+        for ( int j = 0; j < 4; j++ ) {
+          const V bj = select(flip, neg(b[j]), b[j]);
+          out[j] = add(a[j], mul(sub(bj, a[j]), t));
+        }
+        const V inv = reciprocal(root(quatDot(out, out)));
+        for ( int j = 0; j < 4; j++ ) out[j] = mul(out[j], inv);
+      }
+
+      //
+      // sin( t theta ) / sin( theta ) as a series in ( cos( theta ) - 1 ):
+      //   sum a_i ( x - 1 )^i,  a_0 = t,  a_i = a_i-1 ( t^2 - i^2 ) / ( i ( 2i + 1 ) )
+      // Sixteen terms stay under 2.1e-6 absolute error over the shortest arc,
+      // with no trig and no special case for nearly parallel inputs.
+      //
+      constexpr int SLERP_TERMS = 16;
+
+      template <typename V>
+      V slerpWeight(V t, V xm1) noexcept {
+        const V tt = mul(t, t);
+        V term = t;
+        V sum = t;
+        V power = broadcast<V>(1.0f);
+        for ( int i = 1; i < SLERP_TERMS; i++ ) {
+          const float fi = static_cast<float>(i);
+          const V factor = mul(sub(tt, broadcast<V>(fi * fi)),
+                               broadcast<V>(1.0f / (fi * (2.0f * fi + 1.0f))));
+          term = mul(term, factor);
+          power = mul(power, xm1);
+          sum = add(sum, mul(term, power));
+        }
+        return sum;
+      }
+
+      template <typename V>
+      void slerpLanes(const V (&a)[4], const V (&b)[4], V t, V (&out)[4]) noexcept {
+        V d = quatDot(a, b);
+        const auto flip = isNegative(d);
+        d = minimum(select(flip, neg(d), d), broadcast<V>(1.0f));
+
+        const V xm1 = sub(d, broadcast<V>(1.0f));
+        const V u0 = slerpWeight(sub(broadcast<V>(1.0f), t), xm1);
+        const V u1 = slerpWeight(t, xm1);
+        const V u1s = select(flip, neg(u1), u1);
+        for ( int j = 0; j < 4; j++ ) out[j] = add(mul(a[j], u0), mul(b[j], u1s));
+      }
+
+      //
+      // Lane versions of the fast approximations in math_utils.hh. They run the
+      // same operations in the same order, so the scalar tail reproduces
+      // Math::fastSin and friends bit for bit.
+      //
+
+      template <size_t N, typename V>
+      V polynomial(const float (&c)[N], V x) noexcept {
+        V r = broadcast<V>(c[N - 1]);
+        for ( size_t i = N - 1; i > 0; i-- ) r = add(mul(r, x), broadcast<V>(c[i - 1]));
+        return r;
+      }
+
+      template <typename V>
+      void sinCosLanes(V x, V& s, V& c) noexcept {
+        const V k = nearest(mul(x, broadcast<V>(poly::INV_TWO_PI)));
+        V y = sub(sub(sub(x, mul(k, broadcast<V>(poly::TWO_PI_A))),
+                      mul(k, broadcast<V>(poly::TWO_PI_B))),
+                  mul(k, broadcast<V>(poly::TWO_PI_C)));
+
+        const auto above = isNegative(sub(broadcast<V>(poly::HALF_PI), y));
+        const auto below = isNegative(add(y, broadcast<V>(poly::HALF_PI)));
+        y = select(above, sub(broadcast<V>(poly::PI), y),
+                   select(below, sub(broadcast<V>(-poly::PI), y), y));
+        const V sign = select(either(above, below), broadcast<V>(-1.0f), broadcast<V>(1.0f));
+
+        const V yy = mul(y, y);
+        s = mul(y, polynomial(poly::SIN, yy));
+        c = mul(sign, polynomial(poly::COS, yy));
+      }
+
+      template <typename V>
+      V atan2Lanes(V y, V x) noexcept {
+        const V ax = absolute(x);
+        const V ay = absolute(y);
+        const auto steep = isNegative(sub(ax, ay));
+        const V hi = select(steep, ay, ax);
+        const V lo = select(steep, ax, ay);
+        const V a = select(isZero(hi), broadcast<V>(0.0f), quotient(lo, hi));
+
+        V r = mul(a, polynomial(poly::ATAN, mul(a, a)));
+        r = select(steep, sub(broadcast<V>(poly::HALF_PI), r), r);
+        r = select(isNegative(x), sub(broadcast<V>(poly::PI), r), r);
+        return withSignOf(r, y);
+      }
+
+      template <typename V>
+      V acosLanes(V x) noexcept {
+        const V ax = absolute(x);
+        const V r = mul(root(sub(broadcast<V>(1.0f), ax)), polynomial(poly::ACOS, ax));
+        return select(isNegative(x), sub(broadcast<V>(poly::PI), r), r);
+      }
+
+      // 1 / | v |, follows the build wide precision like Math::rsqrt
+      template <typename V>
+      V inverseLength(V squared) noexcept {
+        if constexpr ( DEFAULT_PRECISION == Precision::Fast ) return inverseRoot(squared);
+        else return reciprocal(root(squared));
+      }
+
+      // Calls kernel( i, in[i..] ) over the stream, widest lanes first, then the scalar tail
+      template <typename Kernel>
+      void mapStream(const float* in, size_t count, Kernel kernel) noexcept {
+        size_t i = 0;
+
+#if defined(FN_SIMD_AVX2)
+        for ( ; i + 8 <= count; i += 8 ) kernel(i, load<__m256>(in + i));
+#endif
+#if defined(FN_SIMD_SSE41)
+        for ( ; i + 4 <= count; i += 4 ) kernel(i, load<__m128>(in + i));
+#endif
+        for ( ; i < count; i++ ) kernel(i, in[i]);
+      }
+
+      // Runs `kernel` over quaternion pairs, widest lanes first, then the scalar tail
+      template <typename Kernel>
+      void interpolateStream(const Quat* a, const Quat* b, const float* t, Quat* out,
+                             size_t count, Kernel kernel) noexcept {
+        size_t i = 0;
+
+#if defined(FN_SIMD_AVX2)
+        for ( ; i + 8 <= count; i += 8 ) {
+          __m256 qa[4], qb[4], r[4];
+          gather8(&a[i].x, QUAT_STRIDE, qa);
+          gather8(&b[i].x, QUAT_STRIDE, qb);
+          kernel(qa, qb, _mm256_loadu_ps(t + i), r);
+          scatter8(r, &out[i].x, QUAT_STRIDE);
+        }
+#endif
+#if defined(FN_SIMD_SSE41)
+        for ( ; i + 4 <= count; i += 4 ) {
+          __m128 qa[4], qb[4], r[4];
+          gather4(&a[i].x, QUAT_STRIDE, qa);
+          gather4(&b[i].x, QUAT_STRIDE, qb);
+          kernel(qa, qb, _mm_loadu_ps(t + i), r);
+          scatter4(r, &out[i].x, QUAT_STRIDE);
+        }
+#endif
+        for ( ; i < count; i++ ) {
+          const float qa[4] = { a[i].x, a[i].y, a[i].z, a[i].w };
+          const float qb[4] = { b[i].x, b[i].y, b[i].z, b[i].w };
+          float r[4];
+          kernel(qa, qb, t[i], r);
+          out[i] = Quat(r[0], r[1], r[2], r[3]);
+        }
+      }
+
+      // Runs `kernel` over the matrices, widest lanes first, then the scalar tail
+      template <typename Kernel>
+      size_t inverseStream(const Matrix4* in, Matrix4* out, size_t count,
+                           bool* singular, Kernel kernel) noexcept {
+        size_t flagged = 0;
+        size_t i = 0;
+
+        auto flag = [&](unsigned bits, size_t lanes) noexcept {
+          for ( size_t k = 0; k < lanes; k++ ) {
+            const unsigned bit = ( bits >> k ) & 1u;
+            flagged += bit;
+            if ( singular ) singular[i + k] = bit != 0;
+          }
+        };
+
+#if defined(FN_SIMD_AVX2)
+        for ( ; i + 8 <= count; i += 8 ) {
+          __m256 v[16];
+          load8(in + i, v);
+          const unsigned bits = maskBits(isZero(kernel(v)));
+          store8(v, out + i);
+          flag(bits, 8);
+        }
+#endif
+#if defined(FN_SIMD_SSE41)
+        for ( ; i + 4 <= count; i += 4 ) {
+          __m128 v[16];
+          load4(in + i, v);
+          const unsigned bits = maskBits(isZero(kernel(v)));
+          store4(v, out + i);
+          flag(bits, 4);
+        }
+#endif
+        for ( ; i < count; i++ ) {
+          float v[16];
+          const float* src = in[i].data();
+          for ( int k = 0; k < 16; k++ ) v[k] = src[k];
+          const unsigned bits = maskBits(isZero(kernel(v)));
+          float* dst = out[i].data();
+          for ( int k = 0; k < 16; k++ ) dst[k] = v[k];
+          flag(bits, 1);
+        }
+
+        return flagged;
+      }
+
+      // Frustum planes broadcasted once per lane width, n is ( n, d ) and a is | n |
+      template <typename V>
+      void broadcastPlanes(const Frustum& f, V (&n)[Frustum::COUNT][4], V (&a)[Frustum::COUNT][3]) noexcept {
+        for ( int p = 0; p < Frustum::COUNT; p++ ) {
+          const Vec4& plane = f.plane(static_cast<Frustum::Side>(p));
+          for ( unsigned j = 0; j < 4; j++ ) n[p][j] = broadcast<V>(plane[j]);
+          for ( unsigned j = 0; j < 3; j++ ) a[p][j] = broadcast<V>(std::fabs(plane[j]));
+        }
+      }
+
+      // Mask of the boxes completely behind one of the planes
+      template <typename V>
+      auto boxesOutside(const V (&n)[Frustum::COUNT][4], const V (&a)[Frustum::COUNT][3],
+                        const AABB* boxes) noexcept {
+        V mn[3], mx[3];
+        loadBounds(boxes, mn, mx);
+
+        const V half = broadcast<V>(0.5f);
+        V c[3], e[3];
+        for ( int j = 0; j < 3; j++ ) {
+          c[j] = mul(add(mn[j], mx[j]), half);
+          e[j] = mul(sub(mx[j], mn[j]), half);
+        }
+
+        // Distance of the farthest corner along each plane normal
+        auto distance = [&](int p) noexcept {
+          const V center = add(add(mul(n[p][0], c[0]), mul(n[p][1], c[1])),
+                               add(mul(n[p][2], c[2]), n[p][3]));
+          const V radius = add(add(mul(a[p][0], e[0]), mul(a[p][1], e[1])), mul(a[p][2], e[2]));
+          return add(center, radius);
+        };
+
+        auto outside = isNegative(distance(0));
+        for ( int p = 1; p < Frustum::COUNT; p++ ) outside = either(outside, isNegative(distance(p)));
+        return outside;
+      }
+
+      template <typename V>
+      auto spheresOutside(const V (&n)[Frustum::COUNT][4], const V (&)[Frustum::COUNT][3],
+                          const Sphere* spheres) noexcept {
+        V s[4];
+        loadSpheres(spheres, s);
+
+        auto distance = [&](int p) noexcept {
+          return add(add(add(mul(n[p][0], s[0]), mul(n[p][1], s[1])),
+                         add(mul(n[p][2], s[2]), n[p][3])), s[3]);
+        };
+
+        auto outside = isNegative(distance(0));
+        for ( int p = 1; p < Frustum::COUNT; p++ ) outside = either(outside, isNegative(distance(p)));
+        return outside;
+      }
+
+      // Runs `kernel` over groups of volumes, widest lanes first, then the scalar
+      // tail, and compacts the indices of the lanes it did not cull
+      template <typename Kernel>
+      size_t cullStream(const Frustum& frustum, size_t count, uint32_t* visible,
+                        Kernel kernel) noexcept {
+        size_t found = 0;
+        size_t i = 0;
+
+        // Always writes, only advances on visible lanes, so there is no branch
+        auto emit = [&](unsigned culled, size_t lanes) noexcept {
+          for ( size_t k = 0; k < lanes; k++ ) {
+            visible[found] = static_cast<uint32_t>(i + k);
+            found += ( ( culled >> k ) & 1u ) ^ 1u;
+          }
+        };
+
+#if defined(FN_SIMD_AVX2)
+        {
+          __m256 n[Frustum::COUNT][4], a[Frustum::COUNT][3];
+          broadcastPlanes(frustum, n, a);
+          for ( ; i + 8 <= count; i += 8 ) emit(maskBits(kernel(n, a, i)), 8);
+        }
+#endif
+#if defined(FN_SIMD_SSE41)
+        {
+          __m128 n[Frustum::COUNT][4], a[Frustum::COUNT][3];
+          broadcastPlanes(frustum, n, a);
+          for ( ; i + 4 <= count; i += 4 ) emit(maskBits(kernel(n, a, i)), 4);
+        }
+#endif
+        float n[Frustum::COUNT][4], a[Frustum::COUNT][3];
+        broadcastPlanes(frustum, n, a);
+        for ( ; i < count; i++ ) emit(maskBits(kernel(n, a, i)), 1);
+
+        return found;
+      }
+
+      // Matrix elements broadcasted once per call, e[c][r] is column c, row r
+      struct Coefficients {
+        explicit Coefficients(const Matrix4& m) noexcept {
+          const float* d = m.data();
+          for ( int c = 0; c < 4; c++ )
+            for ( int r = 0; r < 3; r++ )
+              e[c][r] = d[c * 4 + r];
+        }
+        float e[4][3];
+      };
+
+      // Shared body of transformPoints / transformVectors, w is 1 or 0
+      void transformStream(const Matrix4& m, ConstVec3Stream in, Vec3Stream out,
+                           size_t count, bool translate) noexcept {
+        const Coefficients k(m);
+        const float w = translate ? 1.0f : 0.0f;
+        size_t i = 0;
+
+#if defined(FN_SIMD_AVX2)
+        __m256 e8[4][3];
+        for ( int c = 0; c < 4; c++ )
+          for ( int r = 0; r < 3; r++ )
+            e8[c][r] = _mm256_set1_ps(k.e[c][r] * (c == 3 ? w : 1.0f));
+
+        for ( ; i + 8 <= count; i += 8 ) {
+          const __m256 x = _mm256_loadu_ps(in.x + i);
+          const __m256 y = _mm256_loadu_ps(in.y + i);
+          const __m256 z = _mm256_loadu_ps(in.z + i);
+          __m256 r[3];
+          for ( int j = 0; j < 3; j++ ) {
+            r[j] = simd::madd(e8[0][j], x, e8[3][j]);
+            r[j] = simd::madd(e8[1][j], y, r[j]);
+            r[j] = simd::madd(e8[2][j], z, r[j]);
+          }
+          _mm256_storeu_ps(out.x + i, r[0]);
+          _mm256_storeu_ps(out.y + i, r[1]);
+          _mm256_storeu_ps(out.z + i, r[2]);
+        }
+#endif
+#if defined(FN_SIMD_SSE41)
+        __m128 e4[4][3];
+        for ( int c = 0; c < 4; c++ )
+          for ( int r = 0; r < 3; r++ )
+            e4[c][r] = _mm_set1_ps(k.e[c][r] * (c == 3 ? w : 1.0f));
+
+        for ( ; i + 4 <= count; i += 4 ) {
+          const __m128 x = _mm_loadu_ps(in.x + i);
+          const __m128 y = _mm_loadu_ps(in.y + i);
+          const __m128 z = _mm_loadu_ps(in.z + i);
+          __m128 r[3];
+          for ( int j = 0; j < 3; j++ ) {
+            r[j] = simd::madd(e4[0][j], x, e4[3][j]);
+            r[j] = simd::madd(e4[1][j], y, r[j]);
+            r[j] = simd::madd(e4[2][j], z, r[j]);
+          }
+          _mm_storeu_ps(out.x + i, r[0]);
+          _mm_storeu_ps(out.y + i, r[1]);
+          _mm_storeu_ps(out.z + i, r[2]);
+        }
+#endif
+        for ( ; i < count; i++ ) {
+          const float x = in.x[i];
+          const float y = in.y[i];
+          const float z = in.z[i];
+          out.x[i] = k.e[0][0] * x + k.e[1][0] * y + k.e[2][0] * z + k.e[3][0] * w;
+          out.y[i] = k.e[0][1] * x + k.e[1][1] * y + k.e[2][1] * z + k.e[3][1] * w;
+          out.z[i] = k.e[0][2] * x + k.e[1][2] * y + k.e[2][2] * z + k.e[3][2] * w;
+        }
+      }
+
+    }
+
+    void transformPoints(const Matrix4& m, ConstVec3Stream in, Vec3Stream out, size_t count) noexcept {
+      transformStream(m, in, out, count, true);
+    }
+
+    void transformVectors(const Matrix4& m, ConstVec3Stream in, Vec3Stream out, size_t count) noexcept {
+      transformStream(m, in, out, count, false);
+    }
+
+    void dot(ConstVec3Stream a, ConstVec3Stream b, float* out, size_t count) noexcept {
+      size_t i = 0;
+
+#if defined(FN_SIMD_AVX2)
+      for ( ; i + 8 <= count; i += 8 ) {
+        __m256 r = _mm256_mul_ps(_mm256_loadu_ps(a.x + i), _mm256_loadu_ps(b.x + i));
+        r = simd::madd(_mm256_loadu_ps(a.y + i), _mm256_loadu_ps(b.y + i), r);
+        r = simd::madd(_mm256_loadu_ps(a.z + i), _mm256_loadu_ps(b.z + i), r);
+        _mm256_storeu_ps(out + i, r);
+      }
+#endif
+#if defined(FN_SIMD_SSE41)
+      for ( ; i + 4 <= count; i += 4 ) {
+        __m128 r = _mm_mul_ps(_mm_loadu_ps(a.x + i), _mm_loadu_ps(b.x + i));
+        r = simd::madd(_mm_loadu_ps(a.y + i), _mm_loadu_ps(b.y + i), r);
+        r = simd::madd(_mm_loadu_ps(a.z + i), _mm_loadu_ps(b.z + i), r);
+        _mm_storeu_ps(out + i, r);
+      }
+#endif
+      for ( ; i < count; i++ ) {
+        out[i] = a.x[i] * b.x[i] + a.y[i] * b.y[i] + a.z[i] * b.z[i];
+      }
+    }
+
+    void cross(ConstVec3Stream a, ConstVec3Stream b, Vec3Stream out, size_t count) noexcept {
+      size_t i = 0;
+
+#if defined(FN_SIMD_AVX2)
+      for ( ; i + 8 <= count; i += 8 ) {
+        const __m256 ax = _mm256_loadu_ps(a.x + i);
+        const __m256 ay = _mm256_loadu_ps(a.y + i);
+        const __m256 az = _mm256_loadu_ps(a.z + i);
+        const __m256 bx = _mm256_loadu_ps(b.x + i);
+        const __m256 by = _mm256_loadu_ps(b.y + i);
+        const __m256 bz = _mm256_loadu_ps(b.z + i);
+        _mm256_storeu_ps(out.x + i, _mm256_sub_ps(_mm256_mul_ps(ay, bz), _mm256_mul_ps(az, by)));
+        _mm256_storeu_ps(out.y + i, _mm256_sub_ps(_mm256_mul_ps(az, bx), _mm256_mul_ps(ax, bz)));
+        _mm256_storeu_ps(out.z + i, _mm256_sub_ps(_mm256_mul_ps(ax, by), _mm256_mul_ps(ay, bx)));
+      }
+#endif
+#if defined(FN_SIMD_SSE41)
+      for ( ; i + 4 <= count; i += 4 ) {
+        const __m128 ax = _mm_loadu_ps(a.x + i);
+        const __m128 ay = _mm_loadu_ps(a.y + i);
+        const __m128 az = _mm_loadu_ps(a.z + i);
+        const __m128 bx = _mm_loadu_ps(b.x + i);
+        const __m128 by = _mm_loadu_ps(b.y + i);
+        const __m128 bz = _mm_loadu_ps(b.z + i);
+        _mm_storeu_ps(out.x + i, _mm_sub_ps(_mm_mul_ps(ay, bz), _mm_mul_ps(az, by)));
+        _mm_storeu_ps(out.y + i, _mm_sub_ps(_mm_mul_ps(az, bx), _mm_mul_ps(ax, bz)));
+        _mm_storeu_ps(out.z + i, _mm_sub_ps(_mm_mul_ps(ax, by), _mm_mul_ps(ay, bx)));
+      }
+#endif
+      for ( ; i < count; i++ ) {
+        const float ax = a.x[i], ay = a.y[i], az = a.z[i];
+        const float bx = b.x[i], by = b.y[i], bz = b.z[i];
+        out.x[i] = ay * bz - az * by;
+        out.y[i] = az * bx - ax * bz;
+        out.z[i] = ax * by - ay * bx;
+      }
+    }
+
+    void normalize(Vec3Stream v, size_t count) noexcept {
+      size_t i = 0;
+
+#if defined(FN_SIMD_AVX2)
+      const __m256 one8 = _mm256_set1_ps(1.0f);
+      const __m256 zero8 = _mm256_setzero_ps();
+      for ( ; i + 8 <= count; i += 8 ) {
+        const __m256 x = _mm256_loadu_ps(v.x + i);
+        const __m256 y = _mm256_loadu_ps(v.y + i);
+        const __m256 z = _mm256_loadu_ps(v.z + i);
+        __m256 len = _mm256_mul_ps(x, x);
+        len = simd::madd(y, y, len);
+        len = simd::madd(z, z, len);
+        const __m256 nonzero = _mm256_cmp_ps(len, zero8, _CMP_NEQ_OQ);
+        const __m256 inv = _mm256_blendv_ps(one8, inverseLength(len), nonzero);
+        _mm256_storeu_ps(v.x + i, _mm256_mul_ps(x, inv));
+        _mm256_storeu_ps(v.y + i, _mm256_mul_ps(y, inv));
+        _mm256_storeu_ps(v.z + i, _mm256_mul_ps(z, inv));
+      }
+#endif
+#if defined(FN_SIMD_SSE41)
+      const __m128 one4 = _mm_set1_ps(1.0f);
+      const __m128 zero4 = _mm_setzero_ps();
+      for ( ; i + 4 <= count; i += 4 ) {
+        const __m128 x = _mm_loadu_ps(v.x + i);
+        const __m128 y = _mm_loadu_ps(v.y + i);
+        const __m128 z = _mm_loadu_ps(v.z + i);
+        __m128 len = _mm_mul_ps(x, x);
+        len = simd::madd(y, y, len);
+        len = simd::madd(z, z, len);
+        const __m128 nonzero = _mm_cmpneq_ps(len, zero4);
+        const __m128 inv = _mm_blendv_ps(one4, inverseLength(len), nonzero);
+        _mm_storeu_ps(v.x + i, _mm_mul_ps(x, inv));
+        _mm_storeu_ps(v.y + i, _mm_mul_ps(y, inv));
+        _mm_storeu_ps(v.z + i, _mm_mul_ps(z, inv));
+      }
+#endif
+      for ( ; i < count; i++ ) {
+        const float len = v.x[i] * v.x[i] + v.y[i] * v.y[i] + v.z[i] * v.z[i];
+        if ( len == 0.0f )
+          continue;
+        const float inv = inverseLength(len);
+        v.x[i] *= inv;
+        v.y[i] *= inv;
+        v.z[i] *= inv;
+      }
+    }
+
+    void sinCosBatch(const float* x, float* s, float* c, size_t count) noexcept {
+      mapStream(x, count, [s, c](size_t i, auto v) noexcept {
+        decltype(v) vs, vc;
+        sinCosLanes(v, vs, vc);
+        store(s + i, vs);
+        store(c + i, vc);
+      });
+    }
+
+    void atan2Batch(const float* y, const float* x, float* out, size_t count) noexcept {
+      mapStream(y, count, [x, out](size_t i, auto v) noexcept {
+        store(out + i, atan2Lanes(v, load<decltype(v)>(x + i)));
+      });
+    }
+
+    void acosBatch(const float* x, float* out, size_t count) noexcept {
+      mapStream(x, count, [out](size_t i, auto v) noexcept { store(out + i, acosLanes(v)); });
+    }
+
+    void rsqrtBatch(const float* x, float* out, size_t count) noexcept {
+      mapStream(x, count, [out](size_t i, auto v) noexcept { store(out + i, inverseRoot(v)); });
+    }
+
+    size_t inverseBatch(const Matrix4* in, Matrix4* out, size_t count, bool* singular) noexcept {
+      return inverseStream(in, out, count, singular,
+                           [](auto& v) noexcept { return inverseLanes(v); });
+    }
+
+    size_t inverseAffineBatch(const Matrix4* in, Matrix4* out, size_t count, bool* singular) noexcept {
+      return inverseStream(in, out, count, singular,
+                           [](auto& v) noexcept { return inverseAffineLanes(v); });
+    }
+
+    void nlerpBatch(const Quat* a, const Quat* b, const float* t, Quat* out, size_t count) noexcept {
+      interpolateStream(a, b, t, out, count,
+                        [](const auto& qa, const auto& qb, auto w, auto& r) noexcept { nlerpLanes(qa, qb, w, r); });
+    }
+
+    void slerpBatch(const Quat* a, const Quat* b, const float* t, Quat* out, size_t count) noexcept {
+      interpolateStream(a, b, t, out, count,
+                        [](const auto& qa, const auto& qb, auto w, auto& r) noexcept { slerpLanes(qa, qb, w, r); });
+    }
+
+    size_t cullBoxes(const Frustum& frustum, const AABB* boxes, size_t count,
+                     uint32_t* visible) noexcept {
+      return cullStream(frustum, count, visible,
+                        [boxes](const auto& n, const auto& a, size_t i) noexcept { return boxesOutside(n, a, boxes + i); });
+    }
+
+    size_t cullSpheres(const Frustum& frustum, const Sphere* spheres, size_t count,
+                       uint32_t* visible) noexcept {
+      return cullStream(frustum, count, visible,
+                        [spheres](const auto& n, const auto& a, size_t i) noexcept { return spheresOutside(n, a, spheres + i); });
+    }
+  }
+}
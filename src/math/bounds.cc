@@ -0,0 +1,88 @@
+/* =======================================================================
+   $File: bounds.cc
+   $Date: 16/10/2026
+   $Revision:
+   $Creator: Rostislav Orestis Stelmach
+   $Notice:  This file is a part of Thesis project ( stracer ) for
+   the Technical Educational Institute of Western Macedonia
+   Supervisor: Dr. George Sisias
+   ======================================================================== */
+
+//Engine Internal
+#include "math/bounds.hh"
+
+//C++ Includes
+#include <cmath>
+
+namespace fn {
+
+  namespace {
+
+    Vec4 normalizedPlane(const Vec4& p) {
+
+      const float inv = 1.0f / std::sqrt(p.x * p.x + p.y * p.y + p.z * p.z);
+      return p * inv;
+    }
+
+    // Signed distance of the box to the plane, measured from its farthest corner
+    float boxDistance(const Vec4& p, const Vec3& c, const Vec3& e) {
+
+      return p.x * c.x + p.y * c.y + p.z * c.z + p.w +
+             std::fabs(p.x) * e.x + std::fabs(p.y) * e.y + std::fabs(p.z) * e.z;
+    }
+
+  }
+
+  Frustum::Frustum(const Matrix4& viewProjection, ClipDepth depth) {
+
+    // Clip space rows, the matrix is column major
+    Vec4 row[4];
+    for ( unsigned r = 0; r < 4; r++ ) {
+      row[r] = Vec4(viewProjection[0][r], viewProjection[1][r],
+                    viewProjection[2][r], viewProjection[3][r]);
+    }
+
+    planes[Left]   = normalizedPlane(row[3] + row[0]);
+    planes[Right]  = normalizedPlane(row[3] - row[0]);
+    planes[Bottom] = normalizedPlane(row[3] + row[1]);
+    planes[Top]    = normalizedPlane(row[3] - row[1]);
+    planes[Near]   = normalizedPlane(depth == ClipDepth::ZeroToOne ? row[2] : row[3] + row[2]);
+    planes[Far]    = normalizedPlane(row[3] - row[2]);
+  }
+
+  Frustum::Frustum(const glm::mat4& viewProjection, ClipDepth depth)
+    : Frustum(Matrix4(viewProjection), depth) { }
+
+  bool Frustum::isVisible(const Vec3& point) const {
+
+    for ( const Vec4& p : planes ) {
+      if ( p.x * point.x + p.y * point.y + p.z * point.z + p.w < 0.0f ) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  bool Frustum::isVisible(const AABB& box) const {
+
+    const Vec3 c = box.center();
+    const Vec3 e = box.extents();
+    for ( const Vec4& p : planes ) {
+      if ( boxDistance(p, c, e) < 0.0f ) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  bool Frustum::isVisible(const Sphere& sphere) const {
+
+    const Vec3& c = sphere.center;
+    for ( const Vec4& p : planes ) {
+      if ( p.x * c.x + p.y * c.y + p.z * c.z + p.w + sphere.radius < 0.0f ) {
+        return false;
+      }
+    }
+    return true;
+  }
+}
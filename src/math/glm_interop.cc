@@ -0,0 +1,104 @@
+/* =======================================================================
+   $File: glm_interop.cc
+   $Date: 16/10/2026
+   $Revision:
+   $Creator: Rostislav Orestis Stelmach
+   $Notice:  This file is a part of Thesis project ( stracer ) for
+   the Technical Educational Institute of Western Macedonia
+   Supervisor: Dr. George Sisias
+   ======================================================================== */
+
+//Engine Internal
+#include "math/glm_interop.hh"
+
+//C++ Includes
+#include <cstring>
+
+namespace fn {
+
+  namespace {
+
+    constexpr size_t STAGE_SIZE = 64;
+
+    bool allAligned(const glm::mat4* a, const glm::mat4* b, const glm::mat4* c) noexcept {
+      return Math::isMatrix4Aligned(a) && Math::isMatrix4Aligned(b) && Math::isMatrix4Aligned(c);
+    }
+
+    void stageIn(const glm::mat4* in, Matrix4* stage, size_t n) noexcept {
+      std::memcpy(stage[0].data(), &in[0][0].x, n * sizeof(glm::mat4));
+    }
+
+    void stageOut(const Matrix4* stage, glm::mat4* out, size_t n) noexcept {
+      std::memcpy(&out[0][0].x, stage[0].data(), n * sizeof(glm::mat4));
+    }
+
+    // Runs an inverseBatch style kernel on glm arrays, in place when aligned
+    template <typename Kernel>
+    size_t invertStaged(Kernel kernel, const glm::mat4* in, glm::mat4* out, size_t count,
+                        bool* singular) noexcept {
+
+      if ( allAligned(in, in, out) ) {
+        return kernel(Math::asMatrix4(in), Math::asMatrix4(out), count, singular);
+      }
+
+      Matrix4 stage[STAGE_SIZE];
+      size_t flagged = 0;
+
+      for ( size_t base = 0; base < count; base += STAGE_SIZE ) {
+        const size_t n = count - base < STAGE_SIZE ? count - base : STAGE_SIZE;
+        stageIn(in + base, stage, n);
+        flagged += kernel(stage, stage, n, singular ? singular + base : nullptr);
+        stageOut(stage, out + base, n);
+      }
+
+      return flagged;
+    }
+
+  }
+
+  namespace Math {
+
+    void multiply(const glm::mat4* lhs, const glm::mat4* rhs, glm::mat4* out, size_t count) noexcept {
+
+      if ( allAligned(lhs, rhs, out) ) {
+        multiply(asMatrix4(lhs), asMatrix4(rhs), asMatrix4(out), count);
+        return;
+      }
+
+      Matrix4 a[STAGE_SIZE], b[STAGE_SIZE];
+
+      for ( size_t base = 0; base < count; base += STAGE_SIZE ) {
+        const size_t n = count - base < STAGE_SIZE ? count - base : STAGE_SIZE;
+        stageIn(lhs + base, a, n);
+        stageIn(rhs + base, b, n);
+        multiply(a, b, a, n);
+        stageOut(a, out + base, n);
+      }
+    }
+
+    size_t inverseBatch(const glm::mat4* in, glm::mat4* out, size_t count, bool* singular) noexcept {
+
+      return invertStaged([](const Matrix4* i, Matrix4* o, size_t n, bool* s) {
+                            return inverseBatch(i, o, n, s);
+                          }, in, out, count, singular);
+    }
+
+    size_t inverseAffineBatch(const glm::mat4* in, glm::mat4* out, size_t count, bool* singular) noexcept {
+
+      return invertStaged([](const Matrix4* i, Matrix4* o, size_t n, bool* s) {
+                            return inverseAffineBatch(i, o, n, s);
+                          }, in, out, count, singular);
+    }
+
+    // A single matrix is cheaper to copy than to check
+    void transformPoints(const glm::mat4& m, ConstVec3Stream in, Vec3Stream out, size_t count) noexcept {
+
+      transformPoints(Matrix4(m), in, out, count);
+    }
+
+    void transformVectors(const glm::mat4& m, ConstVec3Stream in, Vec3Stream out, size_t count) noexcept {
+
+      transformVectors(Matrix4(m), in, out, count);
+    }
+  }
+}
@@ -10,173 +10,328 @@
 
 //Engine Internal
 #include "math/matrix.hh"
+#include "math/batch.hh"
+#include "math/simd.hh"
 #include "core/fission.hh"
 
 //C++ Includes
+#include <cstring>
 #include <iostream>
 
 namespace fn {
 
-  Matrix4 Matrix4::compute_inverse(const Matrix4 &rhs)
-  {
-    Matrix4 result;
-    float d = determinant();
-    d = 1.0f / d;
-
-    result[0][0] = d * (rhs[2][1] * rhs[3][2] * rhs[1][3]  -  rhs[3][1] * rhs[2][2] * rhs[1][3]  +  rhs[3][1] * rhs[1][2] * rhs[2][3]  -  rhs[1][1] * rhs[3][2] * rhs[2][3]  -  rhs[2][1] * rhs[1][2] * rhs[3][3]  +  rhs[1][1] * rhs[2][2] * rhs[3][3]);
-    result[1][0] = d * (rhs[3][0] * rhs[2][2] * rhs[1][3]  -  rhs[2][0] * rhs[3][2] * rhs[1][3]  -  rhs[3][0] * rhs[1][2] * rhs[2][3]  +  rhs[1][0] * rhs[3][2] * rhs[2][3]  +  rhs[2][0] * rhs[1][2] * rhs[3][3]  -  rhs[1][0] * rhs[2][2] * rhs[3][3]);
-    result[2][0] = d * (rhs[2][0] * rhs[3][1] * rhs[1][3]  -  rhs[3][0] * rhs[2][1] * rhs[1][3]  +  rhs[3][0] * rhs[1][1] * rhs[2][3]  -  rhs[1][0] * rhs[3][1] * rhs[2][3]  -  rhs[2][0] * rhs[1][1] * rhs[3][3]  +  rhs[1][0] * rhs[2][1] * rhs[3][3]);
-    result[3][0] = d * (rhs[3][0] * rhs[2][1] * rhs[1][2]  -  rhs[2][0] * rhs[3][1] * rhs[1][2]  -  rhs[3][0] * rhs[1][1] * rhs[2][2]  +  rhs[1][0] * rhs[3][1] * rhs[2][2]  +  rhs[2][0] * rhs[1][1] * rhs[3][2]  -  rhs[1][0] * rhs[2][1] * rhs[3][2]);
-    result[0][1] = d * (rhs[3][1] * rhs[2][2] * rhs[0][3]  -  rhs[2][1] * rhs[3][2] * rhs[0][3]  -  rhs[3][1] * rhs[0][2] * rhs[2][3]  +  rhs[0][1] * rhs[3][2] * rhs[2][3]  +  rhs[2][1] * rhs[0][2] * rhs[3][3]  -  rhs[0][1] * rhs[2][2] * rhs[3][3]);
-    result[1][1] = d * (rhs[2][0] * rhs[3][2] * rhs[0][3]  -  rhs[3][0] * rhs[2][2] * rhs[0][3]  +  rhs[3][0] * rhs[0][2] * rhs[2][3]  -  rhs[0][0] * rhs[3][2] * rhs[2][3]  -  rhs[2][0] * rhs[0][2] * rhs[3][3]  +  rhs[0][0] * rhs[2][2] * rhs[3][3]);
-    result[2][1] = d * (rhs[3][0] * rhs[2][1] * rhs[0][3]  -  rhs[2][0] * rhs[3][1] * rhs[0][3]  -  rhs[3][0] * rhs[0][1] * rhs[2][3]  +  rhs[0][0] * rhs[3][1] * rhs[2][3]  +  rhs[2][0] * rhs[0][1] * rhs[3][3]  -  rhs[0][0] * rhs[2][1] * rhs[3][3]);
-    result[3][1] = d * (rhs[2][0] * rhs[3][1] * rhs[0][2]  -  rhs[3][0] * rhs[2][1] * rhs[0][2]  +  rhs[3][0] * rhs[0][1] * rhs[2][2]  -  rhs[0][0] * rhs[3][1] * rhs[2][2]  -  rhs[2][0] * rhs[0][1] * rhs[3][2]  +  rhs[0][0] * rhs[2][1] * rhs[3][2]);
-    result[0][2] = d * (rhs[1][1] * rhs[3][2] * rhs[0][3]  -  rhs[3][1] * rhs[1][2] * rhs[0][3]  +  rhs[3][1] * rhs[0][2] * rhs[1][3]  -  rhs[0][1] * rhs[3][2] * rhs[1][3]  -  rhs[1][1] * rhs[0][2] * rhs[3][3]  +  rhs[0][1] * rhs[1][2] * rhs[3][3]);
-    result[1][2] = d * (rhs[3][0] * rhs[1][2] * rhs[0][3]  -  rhs[1][0] * rhs[3][2] * rhs[0][3]  -  rhs[3][0] * rhs[0][2] * rhs[1][3]  +  rhs[0][0] * rhs[3][2] * rhs[1][3]  +  rhs[1][0] * rhs[0][2] * rhs[3][3]  -  rhs[0][0] * rhs[1][2] * rhs[3][3]);
-    result[2][2] = d * (rhs[1][0] * rhs[3][1] * rhs[0][3]  -  rhs[3][0] * rhs[1][1] * rhs[0][3]  +  rhs[3][0] * rhs[0][1] * rhs[1][3]  -  rhs[0][0] * rhs[3][1] * rhs[1][3]  -  rhs[1][0] * rhs[0][1] * rhs[3][3]  +  rhs[0][0] * rhs[1][1] * rhs[3][3]);
-    result[3][2] = d * (rhs[3][0] * rhs[1][1] * rhs[0][2]  -  rhs[1][0] * rhs[3][1] * rhs[0][2]  -  rhs[3][0] * rhs[0][1] * rhs[1][2]  +  rhs[0][0] * rhs[3][1] * rhs[1][2]  +  rhs[1][0] * rhs[0][1] * rhs[3][2]  -  rhs[0][0] * rhs[1][1] * rhs[3][2]);
-    result[0][3] = d * (rhs[2][1] * rhs[1][2] * rhs[0][3]  -  rhs[1][1] * rhs[2][2] * rhs[0][3]  -  rhs[2][1] * rhs[0][2] * rhs[1][3]  +  rhs[0][1] * rhs[2][2] * rhs[1][3]  +  rhs[1][1] * rhs[0][2] * rhs[2][3]  -  rhs[0][1] * rhs[1][2] * rhs[2][3]);
-    result[1][3] = d * (rhs[1][0] * rhs[2][2] * rhs[0][3]  -  rhs[2][0] * rhs[1][2] * rhs[0][3]  +  rhs[2][0] * rhs[0][2] * rhs[1][3]  -  rhs[0][0] * rhs[2][2] * rhs[1][3]  -  rhs[1][0] * rhs[0][2] * rhs[2][3]  +  rhs[0][0] * rhs[1][2] * rhs[2][3]);
-    result[2][3] = d * (rhs[2][0] * rhs[1][1] * rhs[0][3]  -  rhs[1][0] * rhs[2][1] * rhs[0][3]  -  rhs[2][0] * rhs[0][1] * rhs[1][3]  +  rhs[0][0] * rhs[2][1] * rhs[1][3]  +  rhs[1][0] * rhs[0][1] * rhs[2][3]  -  rhs[0][0] * rhs[1][1] * rhs[2][3]);
-    result[3][3] = d * (rhs[1][0] * rhs[2][1] * rhs[0][2]  -  rhs[2][0] * rhs[1][1] * rhs[0][2]  +  rhs[2][0] * rhs[0][1] * rhs[1][2]  -  rhs[0][0] * rhs[2][1] * rhs[1][2]  -  rhs[1][0] * rhs[0][1] * rhs[2][2]  +  rhs[0][0] * rhs[1][1]*rhs[2][2]);
-
-    return result;
-  }
+  namespace {
+
+    //
+    // Kernels work on 16 contiguous floats in column major order. Each one
+    // picks the widest instruction set available ( see math/simd.hh ) and
+    // falls back to plain scalar code.
+    //
+
+#if defined(FN_SIMD_SSE41)
+
+    // 2x2 matrices packed in a __m128 as | x y | z w |
+    inline __m128 mat2Mul(__m128 a, __m128 b) noexcept {
+      return simd::madd(a, simd::swizzle<0, 3, 0, 3>(b),
+                        _mm_mul_ps(simd::swizzle<1, 0, 3, 2>(a), simd::swizzle<2, 1, 2, 1>(b)));
+    }
+
+    // adj(a) * b
+    inline __m128 mat2AdjMul(__m128 a, __m128 b) noexcept {
+      return _mm_sub_ps(_mm_mul_ps(simd::swizzle<3, 3, 0, 0>(a), b),
+                        _mm_mul_ps(simd::swizzle<1, 1, 2, 2>(a), simd::swizzle<2, 3, 0, 1>(b)));
+    }
+
+    // a * adj(b)
+    inline __m128 mat2MulAdj(__m128 a, __m128 b) noexcept {
+      return _mm_sub_ps(_mm_mul_ps(a, simd::swizzle<3, 0, 3, 0>(b)),
+                        _mm_mul_ps(simd::swizzle<1, 0, 3, 2>(a), simd::swizzle<2, 1, 2, 1>(b)));
+    }
+
+    // Determinants of the four 2x2 blocks, as ( |A| |B| |C| |D| )
+    inline __m128 blockDeterminants(__m128 c0, __m128 c1, __m128 c2, __m128 c3) noexcept {
+      return _mm_sub_ps(
+        _mm_mul_ps(_mm_shuffle_ps(c0, c2, FN_SHUFFLE(0, 2, 0, 2)),
+                   _mm_shuffle_ps(c1, c3, FN_SHUFFLE(1, 3, 1, 3))),
+        _mm_mul_ps(_mm_shuffle_ps(c0, c2, FN_SHUFFLE(1, 3, 1, 3)),
+                   _mm_shuffle_ps(c1, c3, FN_SHUFFLE(0, 2, 0, 2))));
+    }
+
+    // tr( a * b ) broadcasted to all lanes
+    inline __m128 mat2Trace(__m128 a, __m128 b) noexcept {
+      __m128 tr = _mm_mul_ps(a, simd::swizzle<0, 2, 1, 3>(b));
+      tr = _mm_hadd_ps(tr, tr);
+      return _mm_hadd_ps(tr, tr);
+    }
+
+#endif
+
+    void multiplyKernel(const float* a, const float* b, float* out) noexcept {
+#if defined(FN_SIMD_AVX2)
+      const __m128 a0 = _mm_load_ps(a + 0);
+      const __m128 a1 = _mm_load_ps(a + 4);
+      const __m128 a2 = _mm_load_ps(a + 8);
+      const __m128 a3 = _mm_load_ps(a + 12);
+
+      const __m256 aa0 = _mm256_set_m128(a0, a0);
+      const __m256 aa1 = _mm256_set_m128(a1, a1);
+      const __m256 aa2 = _mm256_set_m128(a2, a2);
+      const __m256 aa3 = _mm256_set_m128(a3, a3);
+
+      // Two result columns per iteration, each lane broadcasts its own column of b
+      const __m256 b01 = _mm256_loadu_ps(b + 0);
+      const __m256 b23 = _mm256_loadu_ps(b + 8);
+
+      __m256 r01 = _mm256_mul_ps(aa0, _mm256_permute_ps(b01, 0x00));
+      r01 = simd::madd(aa1, _mm256_permute_ps(b01, 0x55), r01);
+      r01 = simd::madd(aa2, _mm256_permute_ps(b01, 0xAA), r01);
+      r01 = simd::madd(aa3, _mm256_permute_ps(b01, 0xFF), r01);
+
+      __m256 r23 = _mm256_mul_ps(aa0, _mm256_permute_ps(b23, 0x00));
+      r23 = simd::madd(aa1, _mm256_permute_ps(b23, 0x55), r23);
+      r23 = simd::madd(aa2, _mm256_permute_ps(b23, 0xAA), r23);
+      r23 = simd::madd(aa3, _mm256_permute_ps(b23, 0xFF), r23);
+
+      _mm256_storeu_ps(out + 0, r01);
+      _mm256_storeu_ps(out + 8, r23);
+#elif defined(FN_SIMD_SSE41)
+      const __m128 a0 = _mm_load_ps(a + 0);
+      const __m128 a1 = _mm_load_ps(a + 4);
+      const __m128 a2 = _mm_load_ps(a + 8);
+      const __m128 a3 = _mm_load_ps(a + 12);
+
+      __m128 b0 = _mm_load_ps(b + 0);
+      __m128 b1 = _mm_load_ps(b + 4);
+      __m128 b2 = _mm_load_ps(b + 8);
+      __m128 b3 = _mm_load_ps(b + 12);
+
+      __m128 col[4] = { b0, b1, b2, b3 };
+      for ( int i = 0; i < 4; i++ ) {
+        __m128 r = _mm_mul_ps(a0, simd::splat<0>(col[i]));
+        r = simd::madd(a1, simd::splat<1>(col[i]), r);
+        r = simd::madd(a2, simd::splat<2>(col[i]), r);
+        r = simd::madd(a3, simd::splat<3>(col[i]), r);
+        col[i] = r;
+      }
+
+      _mm_store_ps(out + 0, col[0]);
+      _mm_store_ps(out + 4, col[1]);
+      _mm_store_ps(out + 8, col[2]);
+      _mm_store_ps(out + 12, col[3]);
+#else
+      float result[16];
+      for ( int c = 0; c < 4; c++ ) {
+        for ( int r = 0; r < 4; r++ ) {
+          result[c * 4 + r] =
+            a[0 + r] * b[c * 4 + 0] + a[4 + r] * b[c * 4 + 1] +
+            a[8 + r] * b[c * 4 + 2] + a[12 + r] * b[c * 4 + 3];
+        }
+      }
+      for ( int i = 0; i < 16; i++ ) out[i] = result[i];
+#endif
+    }
+
+    void transposeKernel(const float* in, float* out) noexcept {
+#if defined(FN_SIMD_SSE41)
+      const __m128 c0 = _mm_load_ps(in + 0);
+      const __m128 c1 = _mm_load_ps(in + 4);
+      const __m128 c2 = _mm_load_ps(in + 8);
+      const __m128 c3 = _mm_load_ps(in + 12);
+
+      const __m128 t0 = _mm_unpacklo_ps(c0, c1);
+      const __m128 t1 = _mm_unpacklo_ps(c2, c3);
+      const __m128 t2 = _mm_unpackhi_ps(c0, c1);
+      const __m128 t3 = _mm_unpackhi_ps(c2, c3);
+
+      _mm_store_ps(out + 0, _mm_movelh_ps(t0, t1));
+      _mm_store_ps(out + 4, _mm_movehl_ps(t1, t0));
+      _mm_store_ps(out + 8, _mm_movelh_ps(t2, t3));
+      _mm_store_ps(out + 12, _mm_movehl_ps(t3, t2));
+#else
+      float result[16];
+      for ( int c = 0; c < 4; c++ ) {
+        for ( int r = 0; r < 4; r++ ) {
+          result[r * 4 + c] = in[c * 4 + r];
+        }
+      }
+      for ( int i = 0; i < 16; i++ ) out[i] = result[i];
+#endif
+    }
+
+    // out = m * ( x, y, z, w )
+    void transformKernel(const float* m, float x, float y, float z, float w, float* out) noexcept {
+#if defined(FN_SIMD_SSE41)
+      __m128 r = _mm_mul_ps(_mm_load_ps(m + 0), _mm_set1_ps(x));
+      r = simd::madd(_mm_load_ps(m + 4), _mm_set1_ps(y), r);
+      r = simd::madd(_mm_load_ps(m + 8), _mm_set1_ps(z), r);
+      r = simd::madd(_mm_load_ps(m + 12), _mm_set1_ps(w), r);
+      _mm_storeu_ps(out, r);
+#else
+      for ( int i = 0; i < 4; i++ ) {
+        out[i] = m[0 + i] * x + m[4 + i] * y + m[8 + i] * z + m[12 + i] * w;
+      }
+#endif
+    }
+
+    float determinantKernel(const float* in) noexcept {
+#if defined(FN_SIMD_SSE41)
+      const __m128 c0 = _mm_load_ps(in + 0);
+      const __m128 c1 = _mm_load_ps(in + 4);
+      const __m128 c2 = _mm_load_ps(in + 8);
+      const __m128 c3 = _mm_load_ps(in + 12);
+
+      const __m128 A = _mm_movelh_ps(c0, c1);
+      const __m128 B = _mm_movehl_ps(c1, c0);
+      const __m128 C = _mm_movelh_ps(c2, c3);
+      const __m128 D = _mm_movehl_ps(c3, c2);
+
+      // |M| = |A||D| + |B||C| - tr( adj(A)B adj(D)C )
+      const __m128 det = blockDeterminants(c0, c1, c2, c3);
+      const __m128 dets = _mm_mul_ps(det, simd::swizzle<3, 2, 1, 0>(det));
+      const __m128 tr = mat2Trace(mat2AdjMul(A, B), mat2AdjMul(D, C));
+      return _mm_cvtss_f32(_mm_sub_ss(_mm_add_ss(dets, simd::splat<1>(dets)), tr));
+#else
+      const float a00 = in[0],  a01 = in[1],  a02 = in[2],  a03 = in[3];
+      const float a10 = in[4],  a11 = in[5],  a12 = in[6],  a13 = in[7];
+      const float a20 = in[8],  a21 = in[9],  a22 = in[10], a23 = in[11];
+      const float a30 = in[12], a31 = in[13], a32 = in[14], a33 = in[15];
+
+      const float s0 = a00 * a11 - a10 * a01;
+      const float s1 = a00 * a12 - a10 * a02;
+      const float s2 = a00 * a13 - a10 * a03;
+      const float s3 = a01 * a12 - a11 * a02;
+      const float s4 = a01 * a13 - a11 * a03;
+      const float s5 = a02 * a13 - a12 * a03;
+
+      const float c5 = a22 * a33 - a32 * a23;
+      const float c4 = a21 * a33 - a31 * a23;
+      const float c3 = a21 * a32 - a31 * a22;
+      const float c2 = a20 * a33 - a30 * a23;
+      const float c1 = a20 * a32 - a30 * a22;
+      const float c0 = a20 * a31 - a30 * a21;
+
+      return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+#endif
+    }
+
+    // Cofactor inverse that shares its 2x2 minors with the determinant, so
+    // the determinant is evaluated only once. Returns the determinant, out
+    // is written only when it is not zero.
+    float inverseKernel(const float* in, float* out) noexcept {
+#if defined(FN_SIMD_SSE41)
+      const __m128 c0 = _mm_load_ps(in + 0);
+      const __m128 c1 = _mm_load_ps(in + 4);
+      const __m128 c2 = _mm_load_ps(in + 8);
+      const __m128 c3 = _mm_load_ps(in + 12);
+
+      // Split the matrix in 2x2 blocks | A B |
+      //                                | C D |
+      const __m128 A = _mm_movelh_ps(c0, c1);
+      const __m128 B = _mm_movehl_ps(c1, c0);
+      const __m128 C = _mm_movelh_ps(c2, c3);
+      const __m128 D = _mm_movehl_ps(c3, c2);
+
+      const __m128 det = blockDeterminants(c0, c1, c2, c3);
+      const __m128 detA = simd::splat<0>(det);
+      const __m128 detB = simd::splat<1>(det);
+      const __m128 detC = simd::splat<2>(det);
+      const __m128 detD = simd::splat<3>(det);
+
+      const __m128 D_C = mat2AdjMul(D, C);
+      const __m128 A_B = mat2AdjMul(A, B);
+
+      __m128 X_ = _mm_sub_ps(_mm_mul_ps(detD, A), mat2Mul(B, D_C));
+      __m128 W_ = _mm_sub_ps(_mm_mul_ps(detA, D), mat2Mul(C, A_B));
+      __m128 Y_ = _mm_sub_ps(_mm_mul_ps(detB, C), mat2MulAdj(D, A_B));
+      __m128 Z_ = _mm_sub_ps(_mm_mul_ps(detC, B), mat2MulAdj(A, D_C));
+
+      __m128 detM = simd::madd(detA, detD, _mm_mul_ps(detB, detC));
+      detM = _mm_sub_ps(detM, mat2Trace(A_B, D_C));
+
+      const float d = _mm_cvtss_f32(detM);
+      if ( d == 0.0f ) return d;
+
+      const __m128 rDetM = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), detM);
+      X_ = _mm_mul_ps(X_, rDetM);
+      Y_ = _mm_mul_ps(Y_, rDetM);
+      Z_ = _mm_mul_ps(Z_, rDetM);
+      W_ = _mm_mul_ps(W_, rDetM);
+
+      // Adjugate shuffle and store shuffle folded together
+      _mm_store_ps(out + 0, _mm_shuffle_ps(X_, Y_, FN_SHUFFLE(3, 1, 3, 1)));
+      _mm_store_ps(out + 4, _mm_shuffle_ps(X_, Y_, FN_SHUFFLE(2, 0, 2, 0)));
+      _mm_store_ps(out + 8, _mm_shuffle_ps(Z_, W_, FN_SHUFFLE(3, 1, 3, 1)));
+      _mm_store_ps(out + 12, _mm_shuffle_ps(Z_, W_, FN_SHUFFLE(2, 0, 2, 0)));
+
+      return d;
+#else
+      const float a00 = in[0],  a01 = in[1],  a02 = in[2],  a03 = in[3];
+      const float a10 = in[4],  a11 = in[5],  a12 = in[6],  a13 = in[7];
+      const float a20 = in[8],  a21 = in[9],  a22 = in[10], a23 = in[11];
+      const float a30 = in[12], a31 = in[13], a32 = in[14], a33 = in[15];
+
+      const float s0 = a00 * a11 - a10 * a01;
+      const float s1 = a00 * a12 - a10 * a02;
+      const float s2 = a00 * a13 - a10 * a03;
+      const float s3 = a01 * a12 - a11 * a02;
+      const float s4 = a01 * a13 - a11 * a03;
+      const float s5 = a02 * a13 - a12 * a03;
+
+      const float c5 = a22 * a33 - a32 * a23;
+      const float c4 = a21 * a33 - a31 * a23;
+      const float c3 = a21 * a32 - a31 * a22;
+      const float c2 = a20 * a33 - a30 * a23;
+      const float c1 = a20 * a32 - a30 * a22;
+      const float c0 = a20 * a31 - a30 * a21;
+
+      const float d = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+      if ( d == 0.0f ) return d;
+
+      const float id = 1.0f / d;
+
+      out[0]  = ( a11 * c5 - a12 * c4 + a13 * c3) * id;
+      out[1]  = (-a01 * c5 + a02 * c4 - a03 * c3) * id;
+      out[2]  = ( a31 * s5 - a32 * s4 + a33 * s3) * id;
+      out[3]  = (-a21 * s5 + a22 * s4 - a23 * s3) * id;
+
+      out[4]  = (-a10 * c5 + a12 * c2 - a13 * c1) * id;
+      out[5]  = ( a00 * c5 - a02 * c2 + a03 * c1) * id;
+      out[6]  = (-a30 * s5 + a32 * s2 - a33 * s1) * id;
+      out[7]  = ( a20 * s5 - a22 * s2 + a23 * s1) * id;
+
+      out[8]  = ( a10 * c4 - a11 * c2 + a13 * c0) * id;
+      out[9]  = (-a00 * c4 + a01 * c2 - a03 * c0) * id;
+      out[10] = ( a30 * s4 - a31 * s2 + a33 * s0) * id;
+      out[11] = (-a20 * s4 + a21 * s2 - a23 * s0) * id;
+
+      out[12] = (-a10 * c3 + a11 * c1 - a12 * c0) * id;
+      out[13] = ( a00 * c3 - a01 * c1 + a02 * c0) * id;
+      out[14] = (-a30 * s3 + a31 * s1 - a32 * s0) * id;
+      out[15] = ( a20 * s3 - a21 * s1 + a22 * s0) * id;
+
+      return d;
+#endif
+    }
 
-  Matrix4::Matrix4() {
-
-    this->m[0] = col_major(1, 0, 0, 0);
-    this->m[1] = col_major(0, 1, 0, 0);
-    this->m[2] = col_major(0, 0, 1, 0);
-    this->m[3] = col_major(0, 0, 0, 1);
   }
 
-  Matrix4::Matrix4(const Matrix4& rhs) {
-
-    this->m[0] = rhs[0];
-    this->m[1] = rhs[1];
-    this->m[2] = rhs[2];
-    this->m[3] = rhs[3];
-
-  }
-
-  Matrix4::Matrix4(float s) {
-    this->m[0] = col_major(s, 0, 0, 0);
-    this->m[1] = col_major(0, s, 0, 0);
-    this->m[2] = col_major(0, 0, s, 0);
-    this->m[3] = col_major(0, 0, 0, s);
-  }
-
-  Matrix4::Matrix4(const col_major& v1, const col_major& v2, const col_major& v3, const col_major& v4) {
-
-    this->m[0] = v1;
-    this->m[1] = v2;
-    this->m[2] = v3;
-    this->m[3] = v4;
+  Matrix4 Matrix4::compute_inverse(const Matrix4 &rhs)
+  {
+    Matrix4 result(rhs);
+    inverseKernel(rhs.data(), result.data());
+    return result;
   }
 
+  // Same column major layout, see math/glm_interop.hh
   Matrix4::Matrix4(const glm::mat4& m) {
-    this->m[0][0] = m[0][0]; this->m[0][1] = m[0][1]; this->m[0][2] = m[0][2]; this->m[0][3] = m[0][3];
-    this->m[1][0] = m[1][0]; this->m[1][1] = m[1][1]; this->m[1][2] = m[1][2]; this->m[1][3] = m[1][3];
-    this->m[2][0] = m[2][0]; this->m[2][1] = m[2][1]; this->m[2][2] = m[2][2]; this->m[2][3] = m[2][3];
-    this->m[3][0] = m[3][0]; this->m[3][1] = m[3][1]; this->m[3][2] = m[3][2]; this->m[3][3] = m[3][3];
-  }
-
-  Matrix4::Matrix4(
-    float x0, float y0, float z0, float w0,
-    float x1, float y1, float z1, float w1,
-    float x2, float y2, float z2, float w2,
-    float x3, float y3, float z3, float w3
-    ) {
-
-    this->m[0] = col_major(x0, y0, z0, w0);
-    this->m[1] = col_major(x1, y1, z1, w1);
-    this->m[2] = col_major(x2, y2, z2, w2);
-    this->m[3] = col_major(x3, y3, z3, w3);
+    std::memcpy(this->data(), &m[0].x, sizeof(glm::mat4));
   }
 
-  Matrix4::operator glm::mat4() {
+  Matrix4::operator glm::mat4() const {
 
     glm::mat4 result;
-
-    result[0][0] = this->m[0][0]; result[0][1] = this->m[0][1]; result[0][2] = this->m[0][2]; result[0][3] = this->m[0][3];
-    result[1][0] = this->m[1][0]; result[1][1] = this->m[1][1]; result[1][2] = this->m[1][2]; result[1][3] = this->m[1][3];
-    result[2][0] = this->m[2][0]; result[2][1] = this->m[2][1]; result[2][2] = this->m[2][2]; result[2][3] = this->m[2][3];
-    result[3][0] = this->m[3][0]; result[3][1] = this->m[3][1]; result[3][2] = this->m[3][2]; result[3][3] = this->m[3][3];
-
+    std::memcpy(&result[0].x, this->data(), sizeof(glm::mat4));
     return result;
-
-  }
-
-  typename Matrix4::col_major& Matrix4::operator [](size_t index) {
-
-    FN_ASSERT(index < 4);
-    return this->m[index];
-  }
-
-  typename Matrix4::col_major const& Matrix4::operator [](size_t index) const {
-
-    FN_ASSERT(index < 4);
-    return this->m[index];
-  }
-
-
-  Matrix4& Matrix4::operator =(const Matrix4& rhs) {
-
-    this->m[0] = rhs[0];
-    this->m[1] = rhs[1];
-    this->m[2] = rhs[2];
-    this->m[3] = rhs[3];
-
-    return *this;
-  }
-
-  Matrix4& Matrix4::operator +=(float scalar) {
-
-    this->m[0] += scalar;
-    this->m[1] += scalar;
-    this->m[2] += scalar;
-    this->m[3] += scalar;
-    return *this;
-  }
-
-  Matrix4& Matrix4::operator +=(const Matrix4& rhs) {
-
-    this->m[0] += rhs[0];
-    this->m[1] += rhs[1];
-    this->m[2] += rhs[2];
-    this->m[3] += rhs[3];
-    return *this;
-
-  }
-
-  Matrix4& Matrix4::operator -=(float scalar) {
-
-    this->m[0] -= scalar;
-    this->m[1] -= scalar;
-    this->m[2] -= scalar;
-    this->m[3] -= scalar;
-    return *this;
-  }
-
-  Matrix4& Matrix4::operator -=(const Matrix4& rhs) {
-
-    this->m[0] -= rhs[0];
-    this->m[1] -= rhs[1];
-    this->m[2] -= rhs[2];
-    this->m[3] -= rhs[3];
-    return *this;
-
-  }
-
-  Matrix4& Matrix4::operator *=(float scalar) {
-
-    this->m[0] *= scalar;
-    this->m[1] *= scalar;
-    this->m[2] *= scalar;
-    this->m[3] *= scalar;
-    return *this;
-
   }
 
   Matrix4& Matrix4::operator *=(const Matrix4& rhs) {
@@ -184,292 +339,65 @@ namespace fn {
     return (*this = *this * rhs);
   }
 
-  Matrix4& Matrix4::operator /=(float scalar) {
-
-    this->m[0] /= scalar;
-    this->m[1] /= scalar;
-    this->m[2] /= scalar;
-    this->m[3] /= scalar;
-    return *this;
-  }
-
   Matrix4& Matrix4::operator /=(const Matrix4& rhs) {
 
     return (*this = *this * compute_inverse(rhs));
   }
 
-  Matrix4& Matrix4::operator ++() {
-
-    ++this->m[0];
-    ++this->m[1];
-    ++this->m[2];
-    ++this->m[3];
-    return *this;
-  }
-
-  Matrix4& Matrix4::operator --() {
-
-    --this->m[0];
-    --this->m[1];
-    --this->m[2];
-    --this->m[3];
-    return *this;
-  }
-
-  const Matrix4 Matrix4::operator ++(int) {
-
-    Matrix4 result(*this);
-    ++*this;
-    return result;
-  }
-
-  const Matrix4 Matrix4::operator --(int) {
-
-    Matrix4 result(*this);
-    --*this;
-    return result;
-  }
-
-  Matrix4 Matrix4::operator +(const Matrix4& rhs) {
-
-    return rhs;
-  }
-
-  Matrix4 Matrix4::operator -(const Matrix4& rhs) {
-
-    return Matrix4(
-      -rhs[0][0], -rhs[0][1], -rhs[0][2], -rhs[0][3],
-      -rhs[1][0], -rhs[1][1], -rhs[1][2], -rhs[1][3],
-      -rhs[2][0], -rhs[2][1], -rhs[2][2], -rhs[2][3],
-      -rhs[3][0], -rhs[3][1], -rhs[3][2], -rhs[3][3]
-      );
-  }
-
-  Vec3 Matrix4::getZVector() const {
-
-    return Vec3( this->m[2][0], this->m[2][1], this->m[2][2] );
-  }
-
-  Vec3 Matrix4::getYVector() const {
-
-    return Vec3( this->m[1][0], this->m[1][1], this->m[1][2] );
-  }
-
-  Vec3 Matrix4::getXVector() const {
-
-    return Vec3( this->m[0][0], this->m[0][1], this->m[0][2] );
-  }
-
-  void Matrix4::setXVector(const Vec3& v) {
-
-    this->m[0][0] = v.x;
-    this->m[0][1] = v.y;
-    this->m[0][2] = v.z;
-  }
-
-  void Matrix4::setYVector(const Vec3& v) {
-
-    this->m[1][0] = v.x;
-    this->m[1][1] = v.y;
-    this->m[1][2] = v.z;
-  }
-
-  void Matrix4::setZVector(const Vec3& v) {
-
-    this->m[2][0] = v.x;
-    this->m[2][1] = v.y;
-    this->m[2][2] = v.z;
-  }
-
   float Matrix4::determinant() const {
 
-    return
-      m[3][0] * m[2][1] * m[1][2] * m[0][3]  -  m[2][0] * m[3][1] * m[1][2] * m[0][3]  -  m[3][0] * m[1][1] * m[2][2] * m[0][3]  +  m[1][0] * m[3][1] * m[2][2] * m[0][3] +
-      m[2][0] * m[1][1] * m[3][2] * m[0][3]  -  m[1][0] * m[2][1] * m[3][2] * m[0][3]  -  m[3][0] * m[2][1] * m[0][2] * m[1][3]  +  m[2][0] * m[3][1] * m[0][2] * m[1][3] +
-      m[3][0] * m[0][1] * m[2][2] * m[1][3]  -  m[0][0] * m[3][1] * m[2][2] * m[1][3]  -  m[2][0] * m[0][1] * m[3][2] * m[1][3]  +  m[0][0] * m[2][1] * m[3][2] * m[1][3] +
-      m[3][0] * m[1][1] * m[0][2] * m[2][3]  -  m[1][0] * m[3][1] * m[0][2] * m[2][3]  -  m[3][0] * m[0][1] * m[1][2] * m[2][3]  +  m[0][0] * m[3][1] * m[1][2] * m[2][3] +
-      m[1][0] * m[0][1] * m[3][2] * m[2][3]  -  m[0][0] * m[1][1] * m[3][2] * m[2][3]  -  m[2][0] * m[1][1] * m[0][2] * m[3][3]  +  m[1][0] * m[2][1] * m[0][2] * m[3][3] +
-      m[2][0] * m[0][1] * m[1][2] * m[3][3]  -  m[0][0] * m[2][1] * m[1][2] * m[3][3]  -  m[1][0] * m[0][1] * m[2][2] * m[3][3]  +  m[0][0] * m[1][1] * m[2][2] * m[3][3];
-
+    return determinantKernel(data());
   }
 
   void Matrix4::inverse() {
 
-    Matrix4 result;
-    float d = determinant();
-    if( d == 0 ) return;
-    d = 1.0f / d;
-
-    result.m[0][0] = d * (m[2][1] * m[3][2] * m[1][3]  -  m[3][1] * m[2][2] * m[1][3]  +  m[3][1] * m[1][2] * m[2][3]  -  m[1][1] * m[3][2] * m[2][3]  -  m[2][1] * m[1][2] * m[3][3]  +  m[1][1] * m[2][2] * m[3][3]);
-    result.m[1][0] = d * (m[3][0] * m[2][2] * m[1][3]  -  m[2][0] * m[3][2] * m[1][3]  -  m[3][0] * m[1][2] * m[2][3]  +  m[1][0] * m[3][2] * m[2][3]  +  m[2][0] * m[1][2] * m[3][3]  -  m[1][0] * m[2][2] * m[3][3]);
-    result.m[2][0] = d * (m[2][0] * m[3][1] * m[1][3]  -  m[3][0] * m[2][1] * m[1][3]  +  m[3][0] * m[1][1] * m[2][3]  -  m[1][0] * m[3][1] * m[2][3]  -  m[2][0] * m[1][1] * m[3][3]  +  m[1][0] * m[2][1] * m[3][3]);
-    result.m[3][0] = d * (m[3][0] * m[2][1] * m[1][2]  -  m[2][0] * m[3][1] * m[1][2]  -  m[3][0] * m[1][1] * m[2][2]  +  m[1][0] * m[3][1] * m[2][2]  +  m[2][0] * m[1][1] * m[3][2]  -  m[1][0] * m[2][1] * m[3][2]);
-    result.m[0][1] = d * (m[3][1] * m[2][2] * m[0][3]  -  m[2][1] * m[3][2] * m[0][3]  -  m[3][1] * m[0][2] * m[2][3]  +  m[0][1] * m[3][2] * m[2][3]  +  m[2][1] * m[0][2] * m[3][3]  -  m[0][1] * m[2][2] * m[3][3]);
-    result.m[1][1] = d * (m[2][0] * m[3][2] * m[0][3]  -  m[3][0] * m[2][2] * m[0][3]  +  m[3][0] * m[0][2] * m[2][3]  -  m[0][0] * m[3][2] * m[2][3]  -  m[2][0] * m[0][2] * m[3][3]  +  m[0][0] * m[2][2] * m[3][3]);
-    result.m[2][1] = d * (m[3][0] * m[2][1] * m[0][3]  -  m[2][0] * m[3][1] * m[0][3]  -  m[3][0] * m[0][1] * m[2][3]  +  m[0][0] * m[3][1] * m[2][3]  +  m[2][0] * m[0][1] * m[3][3]  -  m[0][0] * m[2][1] * m[3][3]);
-    result.m[3][1] = d * (m[2][0] * m[3][1] * m[0][2]  -  m[3][0] * m[2][1] * m[0][2]  +  m[3][0] * m[0][1] * m[2][2]  -  m[0][0] * m[3][1] * m[2][2]  -  m[2][0] * m[0][1] * m[3][2]  +  m[0][0] * m[2][1] * m[3][2]);
-    result.m[0][2] = d * (m[1][1] * m[3][2] * m[0][3]  -  m[3][1] * m[1][2] * m[0][3]  +  m[3][1] * m[0][2] * m[1][3]  -  m[0][1] * m[3][2] * m[1][3]  -  m[1][1] * m[0][2] * m[3][3]  +  m[0][1] * m[1][2] * m[3][3]);
-    result.m[1][2] = d * (m[3][0] * m[1][2] * m[0][3]  -  m[1][0] * m[3][2] * m[0][3]  -  m[3][0] * m[0][2] * m[1][3]  +  m[0][0] * m[3][2] * m[1][3]  +  m[1][0] * m[0][2] * m[3][3]  -  m[0][0] * m[1][2] * m[3][3]);
-    result.m[2][2] = d * (m[1][0] * m[3][1] * m[0][3]  -  m[3][0] * m[1][1] * m[0][3]  +  m[3][0] * m[0][1] * m[1][3]  -  m[0][0] * m[3][1] * m[1][3]  -  m[1][0] * m[0][1] * m[3][3]  +  m[0][0] * m[1][1] * m[3][3]);
-    result.m[3][2] = d * (m[3][0] * m[1][1] * m[0][2]  -  m[1][0] * m[3][1] * m[0][2]  -  m[3][0] * m[0][1] * m[1][2]  +  m[0][0] * m[3][1] * m[1][2]  +  m[1][0] * m[0][1] * m[3][2]  -  m[0][0] * m[1][1] * m[3][2]);
-    result.m[0][3] = d * (m[2][1] * m[1][2] * m[0][3]  -  m[1][1] * m[2][2] * m[0][3]  -  m[2][1] * m[0][2] * m[1][3]  +  m[0][1] * m[2][2] * m[1][3]  +  m[1][1] * m[0][2] * m[2][3]  -  m[0][1] * m[1][2] * m[2][3]);
-    result.m[1][3] = d * (m[1][0] * m[2][2] * m[0][3]  -  m[2][0] * m[1][2] * m[0][3]  +  m[2][0] * m[0][2] * m[1][3]  -  m[0][0] * m[2][2] * m[1][3]  -  m[1][0] * m[0][2] * m[2][3]  +  m[0][0] * m[1][2] * m[2][3]);
-    result.m[2][3] = d * (m[2][0] * m[1][1] * m[0][3]  -  m[1][0] * m[2][1] * m[0][3]  -  m[2][0] * m[0][1] * m[1][3]  +  m[0][0] * m[2][1] * m[1][3]  +  m[1][0] * m[0][1] * m[2][3]  -  m[0][0] * m[1][1] * m[2][3]);
-    result.m[3][3] = d * (m[1][0] * m[2][1] * m[0][2]  -  m[2][0] * m[1][1] * m[0][2]  +  m[2][0] * m[0][1] * m[1][2]  -  m[0][0] * m[2][1] * m[1][2]  -  m[1][0] * m[0][1] * m[2][2]  +  m[0][0] * m[1][1]*m[2][2]);
-
-    *this = result;
-
-  }
-
-  void Matrix4::setIdentity() {
-    this->m[0][0] = 1;
-    this->m[1][1] = 1;
-    this->m[2][2] = 1;
-    this->m[3][3] = 1;
-  }
-
-  Matrix4 operator +(const Matrix4& lhs, const Matrix4& rhs) {
-
-    return Matrix4(
-      lhs[0] + rhs[0],
-      lhs[1] + rhs[1],
-      lhs[2] + rhs[2],
-      lhs[3] + rhs[3]
-      );
-  }
-
-  Matrix4 operator +(float scalar, const Matrix4& rhs) {
-
-    return Matrix4(
-      scalar + rhs[0],
-      scalar + rhs[1],
-      scalar + rhs[2],
-      scalar + rhs[3]
-      );
+    inverseKernel(data(), data());
   }
 
-  Matrix4 operator +(const Matrix4& lhs, float scalar) {
+  Matrix4 Matrix4::inversed() const {
 
-    return Matrix4(
-      lhs[0] + scalar,
-      lhs[1] + scalar,
-      lhs[2] + scalar,
-      lhs[3] + scalar
-      );
+    return compute_inverse(*this);
   }
 
-  Matrix4 operator -(const Matrix4& lhs, const Matrix4& rhs) {
+  void Matrix4::transpose() {
 
-    return Matrix4(
-      lhs[0] - rhs[0],
-      lhs[1] - rhs[1],
-      lhs[2] - rhs[2],
-      lhs[3] - rhs[3]
-      );
+    transposeKernel(data(), data());
   }
 
-  Matrix4 operator -(float scalar, const Matrix4& rhs) {
+  Matrix4 Matrix4::transposed() const {
 
-    return Matrix4(
-      scalar - rhs[0],
-      scalar - rhs[1],
-      scalar - rhs[2],
-      scalar - rhs[3]
-      );
-  }
-
-  Matrix4 operator -(const Matrix4& lhs, float scalar) {
-
-    return Matrix4(
-      lhs[0] - scalar,
-      lhs[1] - scalar,
-      lhs[2] - scalar,
-      lhs[3] - scalar
-      );
+    Matrix4 result;
+    transposeKernel(data(), result.data());
+    return result;
   }
 
-  Matrix4 operator *(const Matrix4& lhs, float scalar) {
+  Vec3 Matrix4::transformPoint(const Vec3& p) const {
 
-    return Matrix4(
-      lhs[0] * scalar,
-      lhs[1] * scalar,
-      lhs[2] * scalar,
-      lhs[3] * scalar
-      );
+    alignas(16) float r[4];
+    transformKernel(data(), p.x, p.y, p.z, 1.0f, r);
+    return Vec3(r[0], r[1], r[2]);
   }
 
-  Matrix4 operator *(float scalar, const Matrix4& rhs) {
+  Vec3 Matrix4::transformVector(const Vec3& v) const {
 
-    return Matrix4(
-      scalar * rhs[0],
-      scalar * rhs[1],
-      scalar * rhs[2],
-      scalar * rhs[3]
-      );
+    alignas(16) float r[4];
+    transformKernel(data(), v.x, v.y, v.z, 0.0f, r);
+    return Vec3(r[0], r[1], r[2]);
   }
 
   Matrix4 operator *(const Matrix4& lhs, const Matrix4& rhs) {
 
-//        Matrix4 result;
-//        result[0][0] = lhs[0][0] * rhs[0][0] + lhs[1][0] * rhs[0][1] + lhs[2][0] * rhs[0][2] + lhs[3][0] * rhs[0][3];
-//        result[1][0] = lhs[0][0] * rhs[1][0] + lhs[1][0] * rhs[1][1] + lhs[2][0] * rhs[1][2] + lhs[3][0] * rhs[1][3];
-//        result[2][0] = lhs[0][0] * rhs[2][0] + lhs[1][0] * rhs[2][1] + lhs[2][0] * rhs[2][2] + lhs[3][0] * rhs[2][3];
-//        result[3][0] = lhs[0][0] * rhs[3][0] + lhs[1][0] * rhs[3][1] + lhs[2][0] * rhs[3][2] + lhs[3][0] * rhs[3][3];
-//
-//        result[0][1] = lhs[0][1] * rhs[0][0] + lhs[1][1] * rhs[0][1] + lhs[2][1] * rhs[0][2] + lhs[3][1] * rhs[0][3];
-//        result[1][1] = lhs[0][1] * rhs[1][0] + lhs[1][1] * rhs[1][1] + lhs[2][1] * rhs[1][2] + lhs[3][1] * rhs[1][3];
-//        result[2][1] = lhs[0][1] * rhs[2][0] + lhs[1][1] * rhs[2][1] + lhs[2][1] * rhs[2][2] + lhs[3][1] * rhs[2][3];
-//        result[3][1] = lhs[0][1] * rhs[3][0] + lhs[1][1] * rhs[3][1] + lhs[2][1] * rhs[3][2] + lhs[3][1] * rhs[3][3];
-//
-//        result[0][2] = lhs[0][2] * rhs[0][0] + lhs[1][2] * rhs[0][1] + lhs[2][2] * rhs[0][2] + lhs[3][2] * rhs[0][3];
-//        result[1][2] = lhs[0][2] * rhs[1][0] + lhs[1][2] * rhs[1][1] + lhs[2][2] * rhs[1][2] + lhs[3][2] * rhs[1][3];
-//        result[2][2] = lhs[0][2] * rhs[2][0] + lhs[1][2] * rhs[2][1] + lhs[2][2] * rhs[2][2] + lhs[3][2] * rhs[2][3];
-//        result[3][2] = lhs[0][2] * rhs[3][0] + lhs[1][2] * rhs[3][1] + lhs[2][2] * rhs[3][2] + lhs[3][2] * rhs[3][3];
-//
-//        result[0][3] = lhs[0][3] * rhs[0][0] + lhs[1][3] * rhs[0][1] + lhs[2][3] * rhs[0][2] + lhs[3][3] * rhs[0][3];
-//        result[1][3] = lhs[0][3] * rhs[1][0] + lhs[1][3] * rhs[1][1] + lhs[2][3] * rhs[1][2] + lhs[3][3] * rhs[1][3];
-//        result[2][3] = lhs[0][3] * rhs[2][0] + lhs[1][3] * rhs[2][1] + lhs[2][3] * rhs[2][2] + lhs[3][3] * rhs[2][3];
-//        result[3][3] = lhs[0][3] * rhs[3][0] + lhs[1][3] * rhs[3][1] + lhs[2][3] * rhs[3][2] + lhs[3][3] * rhs[3][3];
-//        return result;
-
-    typename Matrix4::col_major const SrcA0 = lhs[0];
-    typename Matrix4::col_major const SrcA1 = lhs[1];
-    typename Matrix4::col_major const SrcA2 = lhs[2];
-    typename Matrix4::col_major const SrcA3 = lhs[3];
-
-    typename Matrix4::col_major const SrcB0 = rhs[0];
-    typename Matrix4::col_major const SrcB1 = rhs[1];
-    typename Matrix4::col_major const SrcB2 = rhs[2];
-    typename Matrix4::col_major const SrcB3 = rhs[3];
-
     Matrix4 Result;
-    Result[0] = SrcA0 * SrcB0[0] + SrcA1 * SrcB0[1] + SrcA2 * SrcB0[2] + SrcA3 * SrcB0[3];
-    Result[1] = SrcA0 * SrcB1[0] + SrcA1 * SrcB1[1] + SrcA2 * SrcB1[2] + SrcA3 * SrcB1[3];
-    Result[2] = SrcA0 * SrcB2[0] + SrcA1 * SrcB2[1] + SrcA2 * SrcB2[2] + SrcA3 * SrcB2[3];
-    Result[3] = SrcA0 * SrcB3[0] + SrcA1 * SrcB3[1] + SrcA2 * SrcB3[2] + SrcA3 * SrcB3[3];
+    multiplyKernel(lhs.data(), rhs.data(), Result.data());
     return Result;
 
   }
 
-  Matrix4 operator /(const Matrix4& lhs, float scalar) {
-
-    return Matrix4(
-      lhs[0] / scalar,
-      lhs[1] / scalar,
-      lhs[2] / scalar,
-      lhs[3] / scalar
-      );
-
-  }
-
-  Matrix4 operator /(float scalar, const Matrix4& rhs) {
+  Vec4 operator *(const Matrix4& lhs, const Vec4& rhs) {
 
-    return Matrix4(
-      scalar / rhs[0],
-      scalar / rhs[1],
-      scalar / rhs[2],
-      scalar / rhs[3]
-      );
+    alignas(16) float r[4];
+    transformKernel(lhs.data(), rhs.x, rhs.y, rhs.z, rhs.w, r);
+    return Vec4(r[0], r[1], r[2], r[3]);
   }
 
   Matrix4 operator /(const Matrix4& lhs, const Matrix4& rhs) {
@@ -478,16 +406,15 @@ namespace fn {
     return result /= rhs;
   }
 
-  bool operator ==(const Matrix4& lhs, const Matrix4& rhs) {
+  namespace Math {
 
-    return (lhs[0] == rhs[0]) && (lhs[1] == rhs[1]) && (lhs[2] == rhs[2]) && (lhs[3] == rhs[3]);
-  }
+    // Declared in math/batch.hh, lives here to share the multiply kernel
+    void multiply(const Matrix4* lhs, const Matrix4* rhs, Matrix4* out, size_t count) noexcept {
 
-  bool operator !=(const Matrix4& lhs, const Matrix4& rhs) {
-
-    return (lhs[0] != rhs[0]) || (lhs[1] != rhs[1]) || (lhs[2] != rhs[2]) || (lhs[3] != rhs[3]);
+      for ( size_t i = 0; i < count; i++ ) {
+        multiplyKernel(lhs[i].data(), rhs[i].data(), out[i].data());
+      }
+    }
   }
 
-
-
 }
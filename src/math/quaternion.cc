@@ -0,0 +1,125 @@
+/* =======================================================================
+   $File: quaternion.cc
+   $Date: 16/10/2026
+   $Revision:
+   $Creator: Rostislav Orestis Stelmach
+   $Notice:  This file is a part of Thesis project ( stracer ) for
+   the Technical Educational Institute of Western Macedonia
+   Supervisor: Dr. George Sisias
+   ======================================================================== */
+
+//Engine Internal
+#include "math/quaternion.hh"
+#include "math/math_utils.hh"
+
+//C++ Includes
+#include <cmath>
+
+namespace fn {
+
+  Quat Quat::fromAxisAngle(const Vec3& axis, float angle) {
+
+    const Vec3 n = axis.normalized();
+    float s, c;
+    Math::sincos(angle * 0.5f, s, c);
+    return Quat(n.x * s, n.y * s, n.z * s, c);
+  }
+
+  Quat Quat::fromMatrix(const Matrix4& m) {
+
+    // Shoemake, pivot on the largest diagonal term to stay away from sqrt( ~0 )
+    const float m00 = m[0][0], m11 = m[1][1], m22 = m[2][2];
+    const float trace = m00 + m11 + m22;
+
+    Quat q;
+    if ( trace > 0.0f ) {
+      const float s = std::sqrt(trace + 1.0f) * 2.0f;
+      q = Quat((m[1][2] - m[2][1]) / s, (m[2][0] - m[0][2]) / s, (m[0][1] - m[1][0]) / s, 0.25f * s);
+    } else if ( m00 > m11 && m00 > m22 ) {
+      const float s = std::sqrt(1.0f + m00 - m11 - m22) * 2.0f;
+      q = Quat(0.25f * s, (m[1][0] + m[0][1]) / s, (m[2][0] + m[0][2]) / s, (m[1][2] - m[2][1]) / s);
+    } else if ( m11 > m22 ) {
+      const float s = std::sqrt(1.0f + m11 - m00 - m22) * 2.0f;
+      q = Quat((m[1][0] + m[0][1]) / s, 0.25f * s, (m[2][1] + m[1][2]) / s, (m[2][0] - m[0][2]) / s);
+    } else {
+      const float s = std::sqrt(1.0f + m22 - m00 - m11) * 2.0f;
+      q = Quat((m[2][0] + m[0][2]) / s, (m[2][1] + m[1][2]) / s, 0.25f * s, (m[0][1] - m[1][0]) / s);
+    }
+    return q;
+  }
+
+  Matrix4 Quat::toMatrix() const {
+
+    const float xx = x * x, yy = y * y, zz = z * z;
+    const float xy = x * y, xz = x * z, yz = y * z;
+    const float wx = w * x, wy = w * y, wz = w * z;
+
+    return Matrix4(
+      1.0f - 2.0f * (yy + zz), 2.0f * (xy + wz), 2.0f * (xz - wy), 0.0f,
+      2.0f * (xy - wz), 1.0f - 2.0f * (xx + zz), 2.0f * (yz + wx), 0.0f,
+      2.0f * (xz + wy), 2.0f * (yz - wx), 1.0f - 2.0f * (xx + yy), 0.0f,
+      0.0f, 0.0f, 0.0f, 1.0f
+      );
+  }
+
+  float Quat::length() const {
+
+    return std::sqrt(squaredLength());
+  }
+
+  void Quat::normalize() {
+
+    *this = normalized();
+  }
+
+  Quat Quat::normalized() const {
+
+    const float inv = 1.0f / length();
+    return Quat(x * inv, y * inv, z * inv, w * inv);
+  }
+
+  Vec3 Quat::rotate(const Vec3& v) const {
+
+    // v + 2w( u x v ) + 2u x ( u x v ), with u the vector part
+    const Vec3 u = xyz();
+    const Vec3 t = 2.0f * crossProduct(u, v);
+    return v + w * t + crossProduct(u, t);
+  }
+
+  namespace Math {
+
+    Quat nlerp(const Quat& lhs, const Quat& rhs, float t) {
+
+      const float sign = dotProduct(lhs, rhs) < 0.0f ? -1.0f : 1.0f;
+      return Quat(
+        lhs.x + (sign * rhs.x - lhs.x) * t,
+        lhs.y + (sign * rhs.y - lhs.y) * t,
+        lhs.z + (sign * rhs.z - lhs.z) * t,
+        lhs.w + (sign * rhs.w - lhs.w) * t
+        ).normalized();
+    }
+
+    Quat slerp(const Quat& lhs, const Quat& rhs, float t) {
+
+      float d = dotProduct(lhs, rhs);
+      const float sign = d < 0.0f ? -1.0f : 1.0f;
+      d *= sign;
+
+      // Nearly parallel, sin( theta ) vanishes so fall back to nlerp
+      if ( d > 0.9995f ) {
+        return nlerp(lhs, rhs, t);
+      }
+
+      const float theta = std::acos(d);
+      const float inv = 1.0f / std::sin(theta);
+      const float a = std::sin((1.0f - t) * theta) * inv;
+      const float b = std::sin(t * theta) * inv * sign;
+      return Quat(
+        a * lhs.x + b * rhs.x,
+        a * lhs.y + b * rhs.y,
+        a * lhs.z + b * rhs.z,
+        a * lhs.w + b * rhs.w
+        );
+    }
+  }
+}
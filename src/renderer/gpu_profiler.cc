@@ -0,0 +1,232 @@
+#include "renderer/gpu_profiler.hh"
+#include "core/fission.hh"
+#include "core/logger.hh"
+#include "core/profiler.hh"
+
+#include <cstring>
+
+namespace fn {
+
+  namespace {
+
+    // Queried statistics, the results come in the order of their bits
+    constexpr VkQueryPipelineStatisticFlags STATISTICS =
+        VK_QUERY_PIPELINE_STATISTIC_INPUT_ASSEMBLY_VERTICES_BIT |
+        VK_QUERY_PIPELINE_STATISTIC_VERTEX_SHADER_INVOCATIONS_BIT |
+        VK_QUERY_PIPELINE_STATISTIC_CLIPPING_INVOCATIONS_BIT |
+        VK_QUERY_PIPELINE_STATISTIC_CLIPPING_PRIMITIVES_BIT |
+        VK_QUERY_PIPELINE_STATISTIC_FRAGMENT_SHADER_INVOCATIONS_BIT;
+    constexpr uint32_t STATISTICS_COUNT = 5;
+
+    constexpr VkQueryResultFlags RESULT_FLAGS = VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WITH_AVAILABILITY_BIT;
+
+  }    // namespace
+
+  void GpuProfiler::create( VkPhysicalDevice physicalDevice, VkDevice device, uint32_t queueFamily,
+                            bool pipelineStatistics, const VkAllocationCallbacks *allocator ) noexcept {
+    m_device = device;
+    m_allocator = allocator;
+
+    VkPhysicalDeviceProperties properties;
+    vkGetPhysicalDeviceProperties( physicalDevice, &properties );
+
+    uint32_t familyCount = 0;
+    vkGetPhysicalDeviceQueueFamilyProperties( physicalDevice, &familyCount, nullptr );
+    std::vector<VkQueueFamilyProperties> families( familyCount );
+    vkGetPhysicalDeviceQueueFamilyProperties( physicalDevice, &familyCount, families.data() );
+
+    const uint32_t validBits = queueFamily < familyCount ? families[ queueFamily ].timestampValidBits : 0;
+    if ( validBits > 0 && properties.limits.timestampPeriod > 0.0f ) {
+      m_timestampPeriod = static_cast<double>( properties.limits.timestampPeriod );
+      m_timestampMask = validBits >= 64 ? ~uint64_t( 0 ) : ( uint64_t( 1 ) << validBits ) - 1;
+    } else {
+      log::warning( "GPU timestamps are not supported by the graphics queue\n" );
+    }
+    m_statistics = pipelineStatistics;
+
+    m_immediate = createPool();
+  }
+
+  void GpuProfiler::destroy() noexcept {
+    setFrameCount( 0 );
+    destroyPool( m_immediate );
+    m_device = VK_NULL_HANDLE;
+  }
+
+  GpuProfiler::Pool GpuProfiler::createPool() noexcept {
+    Pool created;
+
+    if ( hasTimestamps() ) {
+      VkQueryPoolCreateInfo poolInfo = {};
+      poolInfo.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+      poolInfo.queryType = VK_QUERY_TYPE_TIMESTAMP;
+      poolInfo.queryCount = MAX_REGIONS * 2;
+      VK_CHECK_RESULT( vkCreateQueryPool( m_device, &poolInfo, m_allocator, &created.timestamps ) );
+    }
+
+    if ( m_statistics ) {
+      VkQueryPoolCreateInfo poolInfo = {};
+      poolInfo.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+      poolInfo.queryType = VK_QUERY_TYPE_PIPELINE_STATISTICS;
+      poolInfo.queryCount = 1;
+      poolInfo.pipelineStatistics = STATISTICS;
+      VK_CHECK_RESULT( vkCreateQueryPool( m_device, &poolInfo, m_allocator, &created.statistics ) );
+    }
+
+    return created;
+  }
+
+  void GpuProfiler::destroyPool( Pool &destroyed ) noexcept {
+    if ( destroyed.timestamps != VK_NULL_HANDLE ) {
+      vkDestroyQueryPool( m_device, destroyed.timestamps, m_allocator );
+    }
+    if ( destroyed.statistics != VK_NULL_HANDLE ) {
+      vkDestroyQueryPool( m_device, destroyed.statistics, m_allocator );
+    }
+    destroyed = Pool();
+  }
+
+  GpuProfiler::Pool &GpuProfiler::pool( uint32_t index ) noexcept {
+    return index == IMMEDIATE ? m_immediate : m_frames[ index ];
+  }
+
+  void GpuProfiler::setFrameCount( uint32_t count ) noexcept {
+    for ( Pool &frame : m_frames ) destroyPool( frame );
+    m_frames.clear();
+
+    for ( uint32_t i = 0; i < count; i++ ) m_frames.push_back( createPool() );
+  }
+
+  void GpuProfiler::reset( VkCommandBuffer commandBuffer, uint32_t index ) noexcept {
+    Pool &target = pool( index );
+    if ( target.timestamps != VK_NULL_HANDLE ) {
+      vkCmdResetQueryPool( commandBuffer, target.timestamps, 0, MAX_REGIONS * 2 );
+    }
+    if ( target.statistics != VK_NULL_HANDLE ) {
+      vkCmdResetQueryPool( commandBuffer, target.statistics, 0, 1 );
+    }
+
+    target.names.clear();
+    target.recordsStatistics = false;
+    target.submitted = false;
+  }
+
+  uint32_t GpuProfiler::begin( VkCommandBuffer commandBuffer, uint32_t index, const char *name,
+                               VkPipelineStageFlagBits stage ) noexcept {
+    Pool &target = pool( index );
+    if ( target.timestamps == VK_NULL_HANDLE || target.names.size() == MAX_REGIONS ) return MAX_REGIONS;
+
+    const auto region = static_cast<uint32_t>( target.names.size() );
+    target.names.push_back( name );
+    vkCmdWriteTimestamp( commandBuffer, stage, target.timestamps, region * 2 );
+    return region;
+  }
+
+  void GpuProfiler::end( VkCommandBuffer commandBuffer, uint32_t index, uint32_t region,
+                         VkPipelineStageFlagBits stage ) noexcept {
+    Pool &target = pool( index );
+    if ( region >= target.names.size() ) return;
+    vkCmdWriteTimestamp( commandBuffer, stage, target.timestamps, region * 2 + 1 );
+  }
+
+  void GpuProfiler::beginStatistics( VkCommandBuffer commandBuffer, uint32_t index ) noexcept {
+    Pool &target = pool( index );
+    if ( target.statistics == VK_NULL_HANDLE ) return;
+    vkCmdBeginQuery( commandBuffer, target.statistics, 0, 0 );
+    target.recordsStatistics = true;
+  }
+
+  void GpuProfiler::endStatistics( VkCommandBuffer commandBuffer, uint32_t index ) noexcept {
+    Pool &target = pool( index );
+    if ( !target.recordsStatistics ) return;
+    vkCmdEndQuery( commandBuffer, target.statistics, 0 );
+  }
+
+  void GpuProfiler::submitted( uint32_t index ) noexcept {
+    if ( m_device != VK_NULL_HANDLE ) pool( index ).submitted = true;
+  }
+
+  bool GpuProfiler::collect( uint32_t index ) noexcept {
+    if ( m_device == VK_NULL_HANDLE ) return false;
+    Pool &target = pool( index );
+    if ( !target.submitted ) return false;
+
+    // Value and availability of each query, VK_NOT_READY while any is pending
+    uint64_t timestamps[ MAX_REGIONS * 2 ][ 2 ];
+    const auto queries = static_cast<uint32_t>( target.names.size() * 2 );
+    if ( queries > 0 && vkGetQueryPoolResults( m_device, target.timestamps, 0, queries, sizeof( timestamps ),
+                                               timestamps, sizeof( timestamps[ 0 ] ), RESULT_FLAGS ) != VK_SUCCESS ) {
+      return false;
+    }
+
+    uint64_t statistics[ STATISTICS_COUNT + 1 ];
+    if ( target.recordsStatistics &&
+         vkGetQueryPoolResults( m_device, target.statistics, 0, 1, sizeof( statistics ), statistics,
+                                sizeof( statistics ), RESULT_FLAGS ) != VK_SUCCESS ) {
+      return false;
+    }
+
+    // Submitted again before they are read again
+    target.submitted = false;
+
+    std::lock_guard<std::mutex> lock( m_resultsMutex );
+    for ( std::size_t region = 0; region < target.names.size(); region++ ) {
+      const uint64_t ticks = ( timestamps[ region * 2 + 1 ][ 0 ] - timestamps[ region * 2 ][ 0 ] ) & m_timestampMask;
+      const double milliseconds = static_cast<double>( ticks ) * m_timestampPeriod / 1e6;
+      const char *name = target.names[ region ];
+
+      bool known = false;
+      for ( GpuRegion &result : m_regions ) {
+        if ( std::strcmp( result.name, name ) == 0 ) {
+          result.milliseconds = milliseconds;
+          known = true;
+          break;
+        }
+      }
+      if ( !known ) m_regions.push_back( {name, milliseconds} );
+      Profiler::counter( name, milliseconds );
+    }
+
+    if ( target.recordsStatistics ) {
+      m_lastStatistics.inputVertices = statistics[ 0 ];
+      m_lastStatistics.vertexInvocations = statistics[ 1 ];
+      m_lastStatistics.clippingInvocations = statistics[ 2 ];
+      m_lastStatistics.clippingPrimitives = statistics[ 3 ];
+      m_lastStatistics.fragmentInvocations = statistics[ 4 ];
+
+      Profiler::counter( "GPU vertex invocations", static_cast<double>( statistics[ 1 ] ) );
+      Profiler::counter( "GPU clipping primitives", static_cast<double>( statistics[ 3 ] ) );
+      Profiler::counter( "GPU fragment invocations", static_cast<double>( statistics[ 4 ] ) );
+    }
+
+    return true;
+  }
+
+  std::vector<GpuRegion> GpuProfiler::regions() const {
+    std::lock_guard<std::mutex> lock( m_resultsMutex );
+    return m_regions;
+  }
+
+  GpuStatistics GpuProfiler::statistics() const {
+    std::lock_guard<std::mutex> lock( m_resultsMutex );
+    return m_lastStatistics;
+  }
+
+  void GpuProfiler::report() const noexcept {
+    std::lock_guard<std::mutex> lock( m_resultsMutex );
+    for ( const GpuRegion &region : m_regions ) {
+      log::info( "%s: %.3f ms\n", region.name, region.milliseconds );
+    }
+
+    if ( m_statistics ) {
+      log::info( "GPU statistics: %llu vertices, %llu vertex invocations, %llu clipping invocations, "
+                 "%llu primitives, %llu fragment invocations\n",
+                 static_cast<unsigned long long>( m_lastStatistics.inputVertices ),
+                 static_cast<unsigned long long>( m_lastStatistics.vertexInvocations ),
+                 static_cast<unsigned long long>( m_lastStatistics.clippingInvocations ),
+                 static_cast<unsigned long long>( m_lastStatistics.clippingPrimitives ),
+                 static_cast<unsigned long long>( m_lastStatistics.fragmentInvocations ) );
+    }
+  }
+
+}    // namespace fn
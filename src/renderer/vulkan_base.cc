@@ -10,6 +10,7 @@
 #include "core/camera.hh"
 #include "core/fission.hh"
 #include "core/io_manager.hh"
+#include "core/profiler.hh"
 #include "core/settings.hh"
 #include "math/math_utils.hh"
 #include "math/matrix_transformations.hh"
@@ -17,17 +18,9 @@
 #define GLM_FORCE_DEPTH_ZERO_TO_ONE
 #include <glm/gtc/matrix_transform.hpp>
 
-#define STB_IMAGE_IMPLEMENTATION
-#include <stb/stb_image.h>
-#define TINYOBJLOADER_IMPLEMENTATION
-#include <tinyobjloader/tiny_obj_loader.h>
-
 #include <algorithm>
-#include <chrono>
 #include <cstring>
-#include <fstream>
 #include <set>
-#include <unordered_map>
 #include <vector>
 
 namespace fn {
@@ -61,31 +54,12 @@ namespace fn {
     }
   }
 
-  // TODO: move this function to seperate file
-  static std::vector<char> readFile( const std::string &filename ) {
-    std::ifstream file( filename, std::ios::ate | std::ios::binary );
-
-    if ( !file.is_open() ) {
-      log::fatal( "Faild to open file: %s\n", filename.c_str() );
-    }
-
-    auto fileSize = static_cast<size_t>( file.tellg() );
-    std::vector<char> buffer( fileSize );
-
-    file.seekg( 0 );
-    file.read( buffer.data(), fileSize );
-    file.close();
-
-    std::vector<int> a;
-
-    return buffer;
-  }
-
   VulkanBase::VulkanBase( std::shared_ptr<Settings> settings ) noexcept
       : m_window( nullptr )
       , m_settings( settings )
       , m_iomanager( IOManager::getInstnace() )
-      , m_camera( new Camera() ) {
+      , m_camera( new Camera() )
+      , m_previousCamera{m_camera->position(), m_camera->front(), m_camera->up()} {
 #ifdef NDEBUG
     m_enableValidationLayers = false;
 #else
@@ -107,11 +81,22 @@ namespace fn {
     glfwSetWindowUserPointer( m_window, this );
     glfwSetFramebufferSizeCallback( m_window, frameBufferResizedCallback );
 
+    int width = 0;
+    int height = 0;
+    glfwGetFramebufferSize( m_window, &width, &height );
+    m_framebufferSize = {static_cast<uint32_t>( width ), static_cast<uint32_t>( height )};
+
     //@fix (stel) : move this in initIOManger() method
     m_iomanager->setWindow( m_window );
   }
 
   void VulkanBase::initRenderer() noexcept {
+    // Decoded on the loader threads while the device and swap chain are created
+    m_vertexShader = p_resources->load<Shader>( "../shaders/texture.vert.spv", ResourcePriority::Critical );
+    m_fragmentShader = p_resources->load<Shader>( "../shaders/texture.frag.spv", ResourcePriority::Critical );
+    m_texture = p_resources->load<Texture>( TEXTURE_PATH, ResourcePriority::High );
+    m_model = p_resources->load<Model>( MODEL_PATH, ResourcePriority::High );
+
     createInstance();
     setupDebugMessenger();
     createSurface();
@@ -132,6 +117,8 @@ namespace fn {
     loadModel();
     createVertexBuffer();
     createIndexBuffer();
+    std::vector<Vertex>().swap( vertices );
+    std::vector<uint32_t>().swap( indices );
     createUniformBuffers();
     createDescriptorPool();
     createDescriptorSets();
@@ -139,15 +126,59 @@ namespace fn {
     createSyncObjects();
   }
 
-  void VulkanBase::render( [[maybe_unused]] float dt ) noexcept {
+  void VulkanBase::update( float dt ) noexcept {
+    p_shouldTerminate = glfwWindowShouldClose( m_window );
+    m_iomanager->update( dt );
+    m_previousCamera = {m_camera->position(), m_camera->front(), m_camera->up()};
+    moveCamera( dt );
+  }
+
+  void VulkanBase::captureFrame( FrameState &frame ) noexcept {
+    int width = 0;
+    int height = 0;
+    glfwGetFramebufferSize( m_window, &width, &height );
+
+    // Minimized, nothing is presented to pace the loop, so sleep until the
+    // window is restored or closed instead of spinning through empty frames
+    if ( width == 0 || height == 0 ) {
+      glfwWaitEvents();
+      glfwGetFramebufferSize( m_window, &width, &height );
+    }
+    frame.framebufferWidth = static_cast<uint32_t>( width );
+    frame.framebufferHeight = static_cast<uint32_t>( height );
+
+    frame.camera = {m_camera->position(), m_camera->front(), m_camera->up()};
+    frame.previousCamera = m_previousCamera;
+
+    m_iomanager->snapshot( frame.input );
+  }
+
+  void VulkanBase::render( const FrameState &frame ) noexcept {
+    // Minimized, there is no swap chain to draw to
+    if ( frame.framebufferWidth == 0 || frame.framebufferHeight == 0 ) {
+      return;
+    }
+    m_framebufferSize = {frame.framebufferWidth, frame.framebufferHeight};
 
     // Drawing
-    drawFrame();
+    drawFrame( frame );
   }
 
-  void VulkanBase::update( [[maybe_unused]] float dt ) noexcept {
-    p_shouldTerminate = glfwWindowShouldClose( m_window );
-    m_iomanager->update( 1.0f );
+  void VulkanBase::moveCamera( float dt ) noexcept {
+    glm::vec cameraPos = m_camera->position();
+    const float cameraSpeed = 2.5f * dt;
+
+    if ( m_iomanager->isKeyPressed( GLFW_KEY_W ) )
+      cameraPos += cameraSpeed * m_camera->front();
+    if ( m_iomanager->isKeyPressed( GLFW_KEY_S ) )
+      cameraPos -= cameraSpeed * m_camera->front();
+    if ( m_iomanager->isKeyPressed( GLFW_KEY_A ) )
+      cameraPos -= glm::normalize( glm::cross( m_camera->front(), m_camera->up() ) ) * cameraSpeed;
+    if ( m_iomanager->isKeyPressed( GLFW_KEY_D ) )
+      cameraPos += glm::normalize( glm::cross( m_camera->front(), m_camera->up() ) ) * cameraSpeed;
+
+    m_camera->setPositionVector( cameraPos );
+    m_camera->updateCameraVectors();
   }
 
   void VulkanBase::cleanUp() noexcept {
@@ -155,38 +186,53 @@ namespace fn {
     // Wait the logical device to finish operations before exiting mainloop
     vkDeviceWaitIdle( m_device );
 
+    // Peak transient memory per frame, to size the arenas up front
+    for ( size_t i = 0; i < m_frameArenas.size(); i++ ) {
+      const std::string name = "frame " + std::to_string( i );
+      m_frameArenas[ i ].report( name.c_str() );
+    }
+    m_gpuProfiler.report();
+
     cleanupSwapChain();
 
-    vkDestroySampler( m_device, m_textureSampler, nullptr );
-    vkDestroyImageView( m_device, m_textureImageView, nullptr );
+    // No pipeline is built after this
+    p_resources->release( m_vertexShader );
+    p_resources->release( m_fragmentShader );
 
-    vkDestroyImage( m_device, m_textureImage, nullptr );
-    vkFreeMemory( m_device, m_textureImageMemory, nullptr );
+    vkDestroySampler( m_device, m_textureSampler, hostAllocator() );
+    vkDestroyImageView( m_device, m_textureImageView, hostAllocator() );
 
-    vkDestroyDescriptorSetLayout( m_device, m_descriptorSetLayout, nullptr );
+    vkDestroyImage( m_device, m_textureImage, hostAllocator() );
+    vkFreeMemory( m_device, m_textureImageMemory, hostAllocator() );
 
-    vkDestroyBuffer( m_device, m_indexBuffer, nullptr );
-    vkFreeMemory( m_device, m_indexBufferMemory, nullptr );
+    vkDestroyDescriptorSetLayout( m_device, m_descriptorSetLayout, hostAllocator() );
 
-    vkDestroyBuffer( m_device, m_vertexBuffer, nullptr );
-    vkFreeMemory( m_device, m_vertexBufferMemory, nullptr );
+    vkDestroyBuffer( m_device, m_indexBuffer, hostAllocator() );
+    vkFreeMemory( m_device, m_indexBufferMemory, hostAllocator() );
+
+    vkDestroyBuffer( m_device, m_vertexBuffer, hostAllocator() );
+    vkFreeMemory( m_device, m_vertexBufferMemory, hostAllocator() );
 
     for ( size_t i = 0; i < MAX_FRAMES_IN_FLIGHT; i++ ) {
-      vkDestroySemaphore( m_device, m_semaphores.renderHasFinished[ i ], nullptr );
-      vkDestroySemaphore( m_device, m_semaphores.imageIsAvailable[ i ], nullptr );
-      vkDestroyFence( m_device, m_inFlightFences[ i ], nullptr );
+      vkDestroySemaphore( m_device, m_semaphores.renderHasFinished[ i ], hostAllocator() );
+      vkDestroySemaphore( m_device, m_semaphores.imageIsAvailable[ i ], hostAllocator() );
+      vkDestroyFence( m_device, m_inFlightFences[ i ], hostAllocator() );
     }
 
-    vkDestroyCommandPool( m_device, m_commandPool, nullptr );
+    vkDestroyCommandPool( m_device, m_commandPool, hostAllocator() );
 
-    vkDestroyDevice( m_device, nullptr );
+    m_gpuProfiler.destroy();
+    vkDestroyDevice( m_device, hostAllocator() );
 
     if ( m_enableValidationLayers ) {
-      DestroyDebugUtilsMessengerEXT( m_instance, m_debugMessenger, nullptr );
+      DestroyDebugUtilsMessengerEXT( m_instance, m_debugMessenger, hostAllocator() );
     }
 
-    vkDestroySurfaceKHR( m_instance, m_surface, nullptr );
-    vkDestroyInstance( m_instance, nullptr );
+    vkDestroySurfaceKHR( m_instance, m_surface, hostAllocator() );
+    vkDestroyInstance( m_instance, hostAllocator() );
+
+    // What the driver still holds now is leaked
+    m_hostAllocator.report();
     glfwDestroyWindow( m_window );
     glfwTerminate();
   }
@@ -220,7 +266,7 @@ namespace fn {
       createInfo.enabledLayerCount = 0;
     }
 
-    VK_CHECK_RESULT( vkCreateInstance( &createInfo, nullptr, &m_instance ) );
+    VK_CHECK_RESULT( vkCreateInstance( &createInfo, hostAllocator(), &m_instance ) );
   }
 
   bool VulkanBase::checkValidationLayerSupport() const noexcept {
@@ -274,7 +320,7 @@ namespace fn {
     createInfo.pfnUserCallback = debugCallback;
     createInfo.pUserData = nullptr;
 
-    if ( CreateDebugUtilsMessengerEXT( m_instance, &createInfo, nullptr, &m_debugMessenger ) !=
+    if ( CreateDebugUtilsMessengerEXT( m_instance, &createInfo, hostAllocator(), &m_debugMessenger ) !=
          VK_SUCCESS ) {
       log::error( "Failed to set up debug messenger!" );
     }
@@ -382,8 +428,13 @@ namespace fn {
       queueCreateInfos.push_back( queueCreateInfo );
     }
 
+    VkPhysicalDeviceFeatures supportedFeatures;
+    vkGetPhysicalDeviceFeatures( m_physicalDevice, &supportedFeatures );
+
     VkPhysicalDeviceFeatures deviceFeatures = {};
     deviceFeatures.samplerAnisotropy = VK_TRUE;
+    // Pipeline statistics of the GPU profiler, where there are any
+    deviceFeatures.pipelineStatisticsQuery = supportedFeatures.pipelineStatisticsQuery;
     //@note: enable sample shading feature for the device 
     // (althought this has an additional performance cost)
     deviceFeatures.sampleRateShading = VK_TRUE;
@@ -404,13 +455,16 @@ namespace fn {
       createInfo.enabledLayerCount = 0;
     }
 
-    VK_CHECK_RESULT( vkCreateDevice( m_physicalDevice, &createInfo, nullptr, &m_device ) );
+    VK_CHECK_RESULT( vkCreateDevice( m_physicalDevice, &createInfo, hostAllocator(), &m_device ) );
     vkGetDeviceQueue( m_device, indices.graphicsFamily.value(), 0, &m_graphicsQueue );
     vkGetDeviceQueue( m_device, indices.presentFamily.value(), 0, &m_presentQueue );
+
+    m_gpuProfiler.create( m_physicalDevice, m_device, indices.graphicsFamily.value(),
+                          deviceFeatures.pipelineStatisticsQuery == VK_TRUE, hostAllocator() );
   }
 
   void VulkanBase::createSurface() noexcept {
-    VK_CHECK_RESULT( glfwCreateWindowSurface( m_instance, m_window, nullptr, &m_surface ) );
+    VK_CHECK_RESULT( glfwCreateWindowSurface( m_instance, m_window, hostAllocator(), &m_surface ) );
   }
 
   bool VulkanBase::checkDeviceextensionsupport( VkPhysicalDevice device ) const noexcept {
@@ -431,9 +485,10 @@ namespace fn {
     return requiredExtensions.empty();
   }
 
-  SwapChainSupportDetails VulkanBase::querySwapChainSupport( VkPhysicalDevice device ) const
+  SwapChainSupportDetails VulkanBase::querySwapChainSupport( VkPhysicalDevice device,
+                                                             std::pmr::memory_resource *memory ) const
       noexcept {
-    SwapChainSupportDetails details;
+    SwapChainSupportDetails details( memory );
 
     vkGetPhysicalDeviceSurfaceCapabilitiesKHR( device, m_surface, &details.capabilities );
 
@@ -459,7 +514,7 @@ namespace fn {
   }
 
   VkSurfaceFormatKHR VulkanBase::chooseSwapSurfaceFormat(
-      const std::vector<VkSurfaceFormatKHR> &availableFormats ) const noexcept {
+      const std::pmr::vector<VkSurfaceFormatKHR> &availableFormats ) const noexcept {
 
     if ( availableFormats.size() == 1 && availableFormats[ 0 ].format == VK_FORMAT_UNDEFINED ) {
       // if the surface has no preferred format
@@ -487,7 +542,7 @@ namespace fn {
   }
 
   VkPresentModeKHR VulkanBase::chooseSwapPresentMode(
-      const std::vector<VkPresentModeKHR> &availablePresentModes ) const noexcept {
+      const std::pmr::vector<VkPresentModeKHR> &availablePresentModes ) const noexcept {
 
     /**
        There are four possible modes available in vulkan:
@@ -538,10 +593,7 @@ namespace fn {
     if ( capabilities.currentExtent.width != std::numeric_limits<uint32_t>::max() ) {
       return capabilities.currentExtent;
     } else {
-      int width, height;
-      glfwGetFramebufferSize( m_window, &width, &height );
-
-      VkExtent2D actualExtent = {static_cast<uint32_t>( width ), static_cast<uint32_t>( height )};
+      VkExtent2D actualExtent = m_framebufferSize;
 
       actualExtent.width = std::clamp( actualExtent.width, capabilities.minImageExtent.width,
                                        capabilities.maxImageExtent.width );
@@ -552,7 +604,7 @@ namespace fn {
   }
 
   void VulkanBase::createSwapChain() noexcept {
-    auto swapChainSupport = querySwapChainSupport( m_physicalDevice );
+    auto swapChainSupport = querySwapChainSupport( m_physicalDevice, &frameArena() );
 
     auto surfaceFormat = chooseSwapSurfaceFormat( swapChainSupport.formats );
     auto presentMode = chooseSwapPresentMode( swapChainSupport.presentModes );
@@ -608,7 +660,7 @@ namespace fn {
     createInfo.oldSwapchain = VK_NULL_HANDLE;
 
     // Create the actuall swap chain
-    VK_CHECK_RESULT( vkCreateSwapchainKHR( m_device, &createInfo, nullptr, &m_swapChain ) );
+    VK_CHECK_RESULT( vkCreateSwapchainKHR( m_device, &createInfo, hostAllocator(), &m_swapChain ) );
 
     vkGetSwapchainImagesKHR( m_device, m_swapChain, &imageCount, nullptr );
     m_swapChainImages.resize( imageCount );
@@ -625,13 +677,13 @@ namespace fn {
   }
 
   void VulkanBase::createGraphicsPipeline() noexcept {
-    // @stel -> find a better way to handle this ?
-    // maybe pass a factory object to load shaders at compile time?
-    auto vertShaderCode = readFile( "../shaders/texture.vert.spv" );
-    auto fragShaderCode = readFile( "../shaders/texture.frag.spv" );
+    // Kept resident until cleanUp(), the pipeline is rebuilt with the swap chain
+    std::shared_ptr<Shader> vertexShader = p_resources->wait( m_vertexShader );
+    std::shared_ptr<Shader> fragmentShader = p_resources->wait( m_fragmentShader );
+    FN_ASSERT_M( vertexShader && fragmentShader, "Faild to load shaders" );
 
-    auto vertexShaderModule = createShaderModule( vertShaderCode );
-    auto fragmentShaderModule = createShaderModule( fragShaderCode );
+    auto vertexShaderModule = createShaderModule( vertexShader->code() );
+    auto fragmentShaderModule = createShaderModule( fragmentShader->code() );
 
     VkPipelineShaderStageCreateInfo vertexShaderStageInfo = {};
     vertexShaderStageInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
@@ -781,7 +833,7 @@ namespace fn {
     pipelineLayoutInfo.pPushConstantRanges = nullptr;    // Optional
 
     VK_CHECK_RESULT(
-        vkCreatePipelineLayout( m_device, &pipelineLayoutInfo, nullptr, &m_pipelineLayout ) );
+        vkCreatePipelineLayout( m_device, &pipelineLayoutInfo, hostAllocator(), &m_pipelineLayout ) );
 
     VkGraphicsPipelineCreateInfo pipelineInfo = {};
     pipelineInfo.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
@@ -799,21 +851,21 @@ namespace fn {
     pipelineInfo.subpass = 0;
     pipelineInfo.basePipelineHandle = VK_NULL_HANDLE;
 
-    VK_CHECK_RESULT( vkCreateGraphicsPipelines( m_device, VK_NULL_HANDLE, 1, &pipelineInfo, nullptr,
+    VK_CHECK_RESULT( vkCreateGraphicsPipelines( m_device, VK_NULL_HANDLE, 1, &pipelineInfo, hostAllocator(),
                                                 &m_graphicsPipeline ) );
 
-    vkDestroyShaderModule( m_device, fragmentShaderModule, nullptr );
-    vkDestroyShaderModule( m_device, vertexShaderModule, nullptr );
+    vkDestroyShaderModule( m_device, fragmentShaderModule, hostAllocator() );
+    vkDestroyShaderModule( m_device, vertexShaderModule, hostAllocator() );
   }
 
-  VkShaderModule VulkanBase::createShaderModule( const std::vector<char> &code ) const noexcept {
+  VkShaderModule VulkanBase::createShaderModule( const std::vector<uint32_t> &code ) const noexcept {
     VkShaderModuleCreateInfo createInfo = {};
     createInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
-    createInfo.codeSize = code.size();
-    createInfo.pCode = reinterpret_cast<const uint32_t *>( code.data() );
+    createInfo.codeSize = code.size() * sizeof( uint32_t );
+    createInfo.pCode = code.data();
 
     VkShaderModule shaderModule;
-    VK_CHECK_RESULT( vkCreateShaderModule( m_device, &createInfo, nullptr, &shaderModule ) );
+    VK_CHECK_RESULT( vkCreateShaderModule( m_device, &createInfo, hostAllocator(), &shaderModule ) );
 
     return shaderModule;
   }
@@ -892,7 +944,7 @@ namespace fn {
     renderPassInfo.pDependencies = &dependency;
 
 
-    VK_CHECK_RESULT( vkCreateRenderPass( m_device, &renderPassInfo, nullptr, &m_renderPass ) );
+    VK_CHECK_RESULT( vkCreateRenderPass( m_device, &renderPassInfo, hostAllocator(), &m_renderPass ) );
   }
 
   void VulkanBase::createFrameBuffers() noexcept {
@@ -915,7 +967,7 @@ namespace fn {
       framebufferInfo.layers = 1;
 
 
-      VK_CHECK_RESULT( vkCreateFramebuffer( m_device, &framebufferInfo, nullptr,
+      VK_CHECK_RESULT( vkCreateFramebuffer( m_device, &framebufferInfo, hostAllocator(),
                                             &m_swapChainFrameBuffers[ i ] ) );
     }
   }
@@ -933,7 +985,7 @@ namespace fn {
     poolInfo.queueFamilyIndex = queueFamilyIndices.graphicsFamily.value();
     poolInfo.flags = 0;    // Optional
 
-    VK_CHECK_RESULT( vkCreateCommandPool( m_device, &poolInfo, nullptr, &m_commandPool ) );
+    VK_CHECK_RESULT( vkCreateCommandPool( m_device, &poolInfo, hostAllocator(), &m_commandPool ) );
   }
 
   void VulkanBase::createCommandBuffers() noexcept {
@@ -946,6 +998,7 @@ namespace fn {
     allocInfo.commandBufferCount = static_cast<uint32_t>( m_commandBuffers.size() );
 
     VK_CHECK_RESULT( vkAllocateCommandBuffers( m_device, &allocInfo, m_commandBuffers.data() ) );
+    m_gpuProfiler.setFrameCount( static_cast<uint32_t>( m_commandBuffers.size() ) );
 
     // Starting command buffer recording
     for ( size_t i = 0; i < m_commandBuffers.size(); i++ ) {
@@ -956,6 +1009,11 @@ namespace fn {
 
       VK_CHECK_RESULT( vkBeginCommandBuffer( m_commandBuffers[ i ], &beginInfo ) );
 
+      // Every submit of the command buffer writes the queries of its pool again
+      const auto pool = static_cast<uint32_t>( i );
+      m_gpuProfiler.reset( m_commandBuffers[ i ], pool );
+      const uint32_t passRegion = m_gpuProfiler.begin( m_commandBuffers[ i ], pool, "GPU render pass" );
+
       // Starting a render pass
 
       VkRenderPassBeginInfo renderPassInfo = {};
@@ -1006,17 +1064,24 @@ namespace fn {
       // 1, 0,
       //           0);
 
-      vkCmdDrawIndexed( m_commandBuffers[ i ], static_cast<uint32_t>( indices.size() ), 1, 0, 0,
-                        0 );
+      const uint32_t drawRegion = m_gpuProfiler.begin( m_commandBuffers[ i ], pool, "GPU draw" );
+      m_gpuProfiler.beginStatistics( m_commandBuffers[ i ], pool );
+
+      vkCmdDrawIndexed( m_commandBuffers[ i ], m_indexCount, 1, 0, 0, 0 );
+
+      m_gpuProfiler.endStatistics( m_commandBuffers[ i ], pool );
+      m_gpuProfiler.end( m_commandBuffers[ i ], pool, drawRegion );
 
       // The render pass now can be ended
       vkCmdEndRenderPass( m_commandBuffers[ i ] );
+      m_gpuProfiler.end( m_commandBuffers[ i ], pool, passRegion );
 
       VK_CHECK_RESULT( vkEndCommandBuffer( m_commandBuffers[ i ] ) );
     }
   }
 
-  void VulkanBase::drawFrame() noexcept {
+  void VulkanBase::drawFrame( const FrameState &frame ) noexcept {
+    FN_PROFILE_FUNCTION();
 
     // The drawFrame() function perform the following operations:
     // - Acquire an image from the swap chain
@@ -1029,13 +1094,23 @@ namespace fn {
     // going to use that index to pick the right command buffer
 
     // Wait for the frame to be finished
-    vkWaitForFences( m_device, 1, &m_inFlightFences[ m_currentFrame ], VK_TRUE,
-                     std::numeric_limits<uint64_t>::max() );
+    {
+      FN_PROFILE_SCOPE( "wait for fence" );
+      vkWaitForFences( m_device, 1, &m_inFlightFences[ m_currentFrame ], VK_TRUE,
+                       std::numeric_limits<uint64_t>::max() );
+    }
+
+    // The GPU is done with this slot, so is everything allocated for it
+    frameArena().reset();
 
     uint32_t imageIndex;
-    auto result = vkAcquireNextImageKHR(
-        m_device, m_swapChain, std::numeric_limits<uint64_t>::max(),
-        m_semaphores.imageIsAvailable[ m_currentFrame ], VK_NULL_HANDLE, &imageIndex );
+    VkResult result;
+    {
+      FN_PROFILE_SCOPE( "acquire image" );
+      result = vkAcquireNextImageKHR( m_device, m_swapChain, std::numeric_limits<uint64_t>::max(),
+                                      m_semaphores.imageIsAvailable[ m_currentFrame ], VK_NULL_HANDLE,
+                                      &imageIndex );
+    }
 
     if ( result == VK_ERROR_OUT_OF_DATE_KHR ) {
       recreateSwapChain();
@@ -1044,7 +1119,7 @@ namespace fn {
       log::fatal( "Failed to aquire swap chain image" );
     }
 
-    updateuniformbuffers( imageIndex );
+    updateuniformbuffers( imageIndex, frame );
 
     VkSubmitInfo submitInfo = {};
     submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
@@ -1066,8 +1141,13 @@ namespace fn {
 
     vkResetFences( m_device, 1, &m_inFlightFences[ m_currentFrame ] );
 
+    // Last chance for the results of the previous submit of this command
+    // buffer, taken only if the GPU is done with them
+    m_gpuProfiler.collect( imageIndex );
+
     VK_CHECK_RESULT(
         vkQueueSubmit( m_graphicsQueue, 1, &submitInfo, m_inFlightFences[ m_currentFrame ] ) );
+    m_gpuProfiler.submitted( imageIndex );
 
     VkPresentInfoKHR presentInfo = {};
     presentInfo.sType = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR;
@@ -1082,7 +1162,10 @@ namespace fn {
 
     presentInfo.pResults = nullptr;    // Optional
 
-    result = vkQueuePresentKHR( m_presentQueue, &presentInfo );
+    {
+      FN_PROFILE_SCOPE( "present" );
+      result = vkQueuePresentKHR( m_presentQueue, &presentInfo );
+    }
 
     if ( result == VK_ERROR_OUT_OF_DATE_KHR || result == VK_SUBOPTIMAL_KHR ||
          m_frameBufferHasResized ) {
@@ -1108,23 +1191,16 @@ namespace fn {
     fenceInfo.flags = VK_FENCE_CREATE_SIGNALED_BIT;
 
     for ( size_t i = 0; i < MAX_FRAMES_IN_FLIGHT; i++ ) {
-      VK_CHECK_RESULT( vkCreateSemaphore( m_device, &semaphoreInfo, nullptr,
+      VK_CHECK_RESULT( vkCreateSemaphore( m_device, &semaphoreInfo, hostAllocator(),
                                           &m_semaphores.imageIsAvailable[ i ] ) );
-      VK_CHECK_RESULT( vkCreateSemaphore( m_device, &semaphoreInfo, nullptr,
+      VK_CHECK_RESULT( vkCreateSemaphore( m_device, &semaphoreInfo, hostAllocator(),
                                           &m_semaphores.renderHasFinished[ i ] ) );
-      VK_CHECK_RESULT( vkCreateFence( m_device, &fenceInfo, nullptr, &m_inFlightFences[ i ] ) );
+      VK_CHECK_RESULT( vkCreateFence( m_device, &fenceInfo, hostAllocator(), &m_inFlightFences[ i ] ) );
     }
   }
 
   void VulkanBase::recreateSwapChain() noexcept {
 
-    int width = 0;
-    int height = 0;
-    while ( width == 0 || height == 0 ) {
-      glfwGetFramebufferSize( m_window, &width, &height );
-      glfwWaitEvents();
-    }
-
     // We call vkDeviceWaitIdle beacuse we shouldn't touch resources
     // that are still in use.
     vkDeviceWaitIdle( m_device );
@@ -1146,37 +1222,37 @@ namespace fn {
 
   void VulkanBase::cleanupSwapChain() noexcept {
 
-    vkDestroyImageView( m_device, m_colorImageView, nullptr );
-    vkDestroyImage( m_device, m_colorImage, nullptr );
-    vkFreeMemory( m_device, m_colorImageMemory, nullptr );
+    vkDestroyImageView( m_device, m_colorImageView, hostAllocator() );
+    vkDestroyImage( m_device, m_colorImage, hostAllocator() );
+    vkFreeMemory( m_device, m_colorImageMemory, hostAllocator() );
 
-    vkDestroyImageView( m_device, m_depthImageView, nullptr );
-    vkDestroyImage( m_device, m_depthImage, nullptr );
-    vkFreeMemory( m_device, m_depthImageMemory, nullptr );
+    vkDestroyImageView( m_device, m_depthImageView, hostAllocator() );
+    vkDestroyImage( m_device, m_depthImage, hostAllocator() );
+    vkFreeMemory( m_device, m_depthImageMemory, hostAllocator() );
 
     for ( auto framebuffer : m_swapChainFrameBuffers ) {
-      vkDestroyFramebuffer( m_device, framebuffer, nullptr );
+      vkDestroyFramebuffer( m_device, framebuffer, hostAllocator() );
     }
 
     vkFreeCommandBuffers( m_device, m_commandPool, static_cast<uint32_t>( m_commandBuffers.size() ),
                           m_commandBuffers.data() );
 
-    vkDestroyPipeline( m_device, m_graphicsPipeline, nullptr );
-    vkDestroyPipelineLayout( m_device, m_pipelineLayout, nullptr );
-    vkDestroyRenderPass( m_device, m_renderPass, nullptr );
+    vkDestroyPipeline( m_device, m_graphicsPipeline, hostAllocator() );
+    vkDestroyPipelineLayout( m_device, m_pipelineLayout, hostAllocator() );
+    vkDestroyRenderPass( m_device, m_renderPass, hostAllocator() );
 
     for ( auto imageView : m_swapChainImagesViews ) {
-      vkDestroyImageView( m_device, imageView, nullptr );
+      vkDestroyImageView( m_device, imageView, hostAllocator() );
     }
 
-    vkDestroySwapchainKHR( m_device, m_swapChain, nullptr );
+    vkDestroySwapchainKHR( m_device, m_swapChain, hostAllocator() );
 
     for ( size_t i = 0; i < m_swapChainImages.size(); i++ ) {
-      vkDestroyBuffer( m_device, m_uniformBuffers[ i ], nullptr );
-      vkFreeMemory( m_device, m_uniformBuffersMemory[ i ], nullptr );
+      vkDestroyBuffer( m_device, m_uniformBuffers[ i ], hostAllocator() );
+      vkFreeMemory( m_device, m_uniformBuffersMemory[ i ], hostAllocator() );
     }
 
-    vkDestroyDescriptorPool( m_device, m_descriptorPool, nullptr );
+    vkDestroyDescriptorPool( m_device, m_descriptorPool, hostAllocator() );
   }
 
   void VulkanBase::createVertexBuffer() noexcept {
@@ -1203,8 +1279,8 @@ namespace fn {
 
     copyBuffer( stagingBuffer, m_vertexBuffer, bufferSize );
 
-    vkDestroyBuffer( m_device, stagingBuffer, nullptr );
-    vkFreeMemory( m_device, stagingBufferMemory, nullptr );
+    vkDestroyBuffer( m_device, stagingBuffer, hostAllocator() );
+    vkFreeMemory( m_device, stagingBufferMemory, hostAllocator() );
   }
 
   uint32_t VulkanBase::findMemoryType( uint32_t typeFilter, VkMemoryPropertyFlags properties ) const
@@ -1235,7 +1311,7 @@ namespace fn {
     bufferInfo.usage = usage;
     bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
 
-    VK_CHECK_RESULT( vkCreateBuffer( m_device, &bufferInfo, nullptr, &buffer ) );
+    VK_CHECK_RESULT( vkCreateBuffer( m_device, &bufferInfo, hostAllocator(), &buffer ) );
 
     VkMemoryRequirements memRequirements;
     vkGetBufferMemoryRequirements( m_device, buffer, &memRequirements );
@@ -1245,7 +1321,7 @@ namespace fn {
     allocInfo.allocationSize = memRequirements.size;
     allocInfo.memoryTypeIndex = findMemoryType( memRequirements.memoryTypeBits, properties );
 
-    VK_CHECK_RESULT( vkAllocateMemory( m_device, &allocInfo, nullptr, &bufferMemory ) );
+    VK_CHECK_RESULT( vkAllocateMemory( m_device, &allocInfo, hostAllocator(), &bufferMemory ) );
 
     // If the allocation was successfull, then we can associate this memory with
     // the buffer using:
@@ -1255,7 +1331,7 @@ namespace fn {
   void VulkanBase::copyBuffer( VkBuffer srcBuffer, VkBuffer dstBuffer,
                                VkDeviceSize size ) noexcept {
 
-    VkCommandBuffer commandBuffer = beginSingleTimeCommands();
+    VkCommandBuffer commandBuffer = beginSingleTimeCommands( "GPU buffer upload" );
 
     VkBufferCopy copyRegion = {};
     copyRegion.size = size;
@@ -1266,6 +1342,7 @@ namespace fn {
 
   void VulkanBase::createIndexBuffer() noexcept {
     VkDeviceSize bufferSize = sizeof( indices[ 0 ] ) * indices.size();
+    m_indexCount = static_cast<uint32_t>( indices.size() );
 
     VkBuffer stagingBuffer;
     VkDeviceMemory stagingBufferMemory;
@@ -1283,8 +1360,8 @@ namespace fn {
 
     copyBuffer( stagingBuffer, m_indexBuffer, bufferSize );
 
-    vkDestroyBuffer( m_device, stagingBuffer, nullptr );
-    vkFreeMemory( m_device, stagingBufferMemory, nullptr );
+    vkDestroyBuffer( m_device, stagingBuffer, hostAllocator() );
+    vkFreeMemory( m_device, stagingBufferMemory, hostAllocator() );
   }
 
   void VulkanBase::createDescriptorSetLayout() noexcept {
@@ -1317,12 +1394,12 @@ namespace fn {
     layoutInfo.pBindings = bindings.data();
 
     VK_CHECK_RESULT(
-        vkCreateDescriptorSetLayout( m_device, &layoutInfo, nullptr, &m_descriptorSetLayout ) )
+        vkCreateDescriptorSetLayout( m_device, &layoutInfo, hostAllocator(), &m_descriptorSetLayout ) )
   }
 
   void VulkanBase::createUniformBuffers() noexcept {
 
-    VkDeviceSize bufferSize = sizeof( UniformBufferObject );
+    VkDeviceSize bufferSize = UniformBufferObject::size;
 
     m_uniformBuffers.resize( m_swapChainImages.size() );
     m_uniformBuffersMemory.resize( m_swapChainImages.size() );
@@ -1334,50 +1411,23 @@ namespace fn {
     }
   }
 
-  void VulkanBase::updateuniformbuffers( uint32_t currentimage ) noexcept {
-    static auto startTime = std::chrono::high_resolution_clock::now();
-
-    auto currentTime = std::chrono::high_resolution_clock::now();
-    float time =
-        std::chrono::duration<float, std::chrono::seconds::period>( currentTime - startTime )
-            .count();
-
-    glm::vec cameraPos = m_camera->position();
-    float cameraSpeed = 0.0015f;
-
-    if ( m_iomanager->isKeyPressed( GLFW_KEY_W ) )
-      cameraPos += cameraSpeed * m_camera->front();
-    if ( m_iomanager->isKeyPressed( GLFW_KEY_S ) )
-      cameraPos -= cameraSpeed * m_camera->front();
-    if ( m_iomanager->isKeyPressed( GLFW_KEY_A ) )
-      cameraPos -= glm::normalize( glm::cross( m_camera->front(), m_camera->up() ) ) * cameraSpeed;
-    if ( m_iomanager->isKeyPressed( GLFW_KEY_D ) )
-      cameraPos += glm::normalize( glm::cross( m_camera->front(), m_camera->up() ) ) * cameraSpeed;
-
-    m_camera->setPositionVector( cameraPos );
-    m_camera->updateCameraVectors();
-
-    UniformBufferObject ubo = {};
-
-    ubo.model =
-        glm::rotate( glm::mat4( 1.0f ), glm::radians( 90.0f ), glm::vec3( 0.0f, 0.0, 1.0f ) );
+  void VulkanBase::updateuniformbuffers( uint32_t currentimage, const FrameState &frame ) noexcept {
+    FN_PROFILE_FUNCTION();
+    glm::mat4 proj = glm::perspective( Math::radians( 45.0f ),
+                                       m_swapChainExtent.width / float( m_swapChainExtent.height ),
+                                       0.1f, 10.0f );
 
-    ubo.model = glm::scale( ubo.model, glm::vec3( 0.4f, 0.4f, 0.4f ) );
 
-    ubo.view = m_camera->view();
-    ubo.proj = glm::perspective( Math::radians( 45.0f ),
-                                 m_swapChainExtent.width / float( m_swapChainExtent.height ), 0.1f,
-                                 10.0f );
-
-
-    ubo.proj[ 1 ][ 1 ] *= -1;
-
-
-    std::vector<int> a;
+    proj[ 1 ][ 1 ] *= -1;
 
     void *data;
-    vkMapMemory( m_device, m_uniformBuffersMemory[ currentimage ], 0, sizeof( ubo ), 0, &data );
-    memcpy( data, &ubo, sizeof( ubo ) );
+    vkMapMemory( m_device, m_uniformBuffersMemory[ currentimage ], 0, UniformBufferObject::size, 0,
+                 &data );
+    // One model uniform for now, the first renderable of the world
+    const glm::mat4 model = frame.transforms.empty() ? glm::mat4( 1.0f ) : frame.transforms.front();
+    UniformBufferObject::write<UniformModel>( data, model );
+    UniformBufferObject::write<UniformView>( data, frame.view() );
+    UniformBufferObject::write<UniformProj>( data, proj );
     vkUnmapMemory( m_device, m_uniformBuffersMemory[ currentimage ] );
 
     // We left here
@@ -1398,11 +1448,12 @@ namespace fn {
     poolInfo.maxSets = static_cast<uint32_t>( m_swapChainImages.size() );
 
 
-    VK_CHECK_RESULT( vkCreateDescriptorPool( m_device, &poolInfo, nullptr, &m_descriptorPool ) );
+    VK_CHECK_RESULT( vkCreateDescriptorPool( m_device, &poolInfo, hostAllocator(), &m_descriptorPool ) );
   }
 
   void VulkanBase::createDescriptorSets() noexcept {
-    std::vector<VkDescriptorSetLayout> layouts( m_swapChainImages.size(), m_descriptorSetLayout );
+    std::pmr::vector<VkDescriptorSetLayout> layouts( m_swapChainImages.size(), m_descriptorSetLayout,
+                                                     &frameArena() );
     VkDescriptorSetAllocateInfo allocInfo = {};
     allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
     allocInfo.descriptorPool = m_descriptorPool;
@@ -1417,7 +1468,7 @@ namespace fn {
       VkDescriptorBufferInfo bufferInfo = {};
       bufferInfo.buffer = m_uniformBuffers[ i ];
       bufferInfo.offset = 0;
-      bufferInfo.range = sizeof( UniformBufferObject );
+      bufferInfo.range = UniformBufferObject::size;
 
       VkDescriptorImageInfo imageInfo = {};
       imageInfo.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
@@ -1448,23 +1499,17 @@ namespace fn {
   }
 
   void VulkanBase::createTextureImage() noexcept {
+    FN_PROFILE_FUNCTION();
 
-    // Load an image with STB
-    int texWidth, texHeight, texChannels;
+    // Decoded to RGBA8 by a loader thread
+    std::shared_ptr<Texture> texture = p_resources->wait( m_texture );
+    FN_ASSERT_M( texture, "Faild to load texture image" );
 
-    //@fix ofc I will chagne this in the feature
-    stbi_uc *pixels =
-        stbi_load( TEXTURE_PATH.c_str(), &texWidth, &texHeight, &texChannels, STBI_rgb_alpha );
+    const auto texWidth = static_cast<int32_t>( texture->width() );
+    const auto texHeight = static_cast<int32_t>( texture->height() );
+    m_mipLevels = texture->mipLevels();
 
-    // This calculates the number of mip-maps chain
-    // the log2 function, is used the caluclate how many times
-    // the higher dimenios can be divided by 2
-    m_mipLevels =
-        static_cast<uint32_t>( std::floor( std::log2( std::max( texWidth, texHeight ) ) ) ) + 1;
-
-    VkDeviceSize imageSize = static_cast<VkDeviceSize>( texWidth * texHeight * 4 );
-
-    FN_ASSERT_M( pixels, "Faild to load texture image" );
+    VkDeviceSize imageSize = static_cast<VkDeviceSize>( texture->pixels().size() );
 
     VkBuffer stagingBuffer;
     VkDeviceMemory stagingBufferMemory;
@@ -1475,10 +1520,11 @@ namespace fn {
 
     void *data;
     vkMapMemory( m_device, stagingBufferMemory, 0, imageSize, 0, &data );
-    memcpy( data, pixels, static_cast<size_t>( imageSize ) );
+    memcpy( data, texture->pixels().data(), static_cast<size_t>( imageSize ) );
     vkUnmapMemory( m_device, stagingBufferMemory );
 
-    stbi_image_free( pixels );
+    // The pixels live on the GPU from now on
+    p_resources->release( m_texture );
 
     // Create the Texture Image
 
@@ -1501,8 +1547,8 @@ namespace fn {
     //                        VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, m_mipLevels );
     //
     generateMipMaps( m_textureImage, VK_FORMAT_R8G8B8A8_UNORM, texWidth, texHeight, m_mipLevels );
-    vkDestroyBuffer( m_device, stagingBuffer, nullptr );
-    vkFreeMemory( m_device, stagingBufferMemory, nullptr );
+    vkDestroyBuffer( m_device, stagingBuffer, hostAllocator() );
+    vkFreeMemory( m_device, stagingBufferMemory, hostAllocator() );
   }
 
   void VulkanBase::createImage( uint32_t width, uint32_t height, uint32_t mipLevels,
@@ -1526,7 +1572,7 @@ namespace fn {
     imageInfo.samples = numSample;
     imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
 
-    VK_CHECK_RESULT( vkCreateImage( m_device, &imageInfo, nullptr, &image ) );
+    VK_CHECK_RESULT( vkCreateImage( m_device, &imageInfo, hostAllocator(), &image ) );
 
     VkMemoryRequirements memRequirements;
     vkGetImageMemoryRequirements( m_device, image, &memRequirements );
@@ -1536,12 +1582,12 @@ namespace fn {
     allocInfo.allocationSize = memRequirements.size;
     allocInfo.memoryTypeIndex = findMemoryType( memRequirements.memoryTypeBits, properties );
 
-    VK_CHECK_RESULT( vkAllocateMemory( m_device, &allocInfo, nullptr, &imageMemory ) );
+    VK_CHECK_RESULT( vkAllocateMemory( m_device, &allocInfo, hostAllocator(), &imageMemory ) );
 
     vkBindImageMemory( m_device, image, imageMemory, 0 );
   }
 
-  VkCommandBuffer VulkanBase::beginSingleTimeCommands() noexcept {
+  VkCommandBuffer VulkanBase::beginSingleTimeCommands( const char *gpuRegion ) noexcept {
     VkCommandBufferAllocateInfo allocInfo = {};
     allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
     allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
@@ -1557,10 +1603,19 @@ namespace fn {
 
     vkBeginCommandBuffer( commandBuffer, &beginInfo );
 
+    if ( gpuRegion ) {
+      m_gpuProfiler.reset( commandBuffer, GpuProfiler::IMMEDIATE );
+      m_immediateRegion = m_gpuProfiler.begin( commandBuffer, GpuProfiler::IMMEDIATE, gpuRegion );
+    }
+
     return commandBuffer;
   }
 
   void VulkanBase::endSingleTimeCommands( VkCommandBuffer commandBuffer ) noexcept {
+    const bool timed = m_immediateRegion != GpuProfiler::MAX_REGIONS;
+    if ( timed ) m_gpuProfiler.end( commandBuffer, GpuProfiler::IMMEDIATE, m_immediateRegion );
+    m_immediateRegion = GpuProfiler::MAX_REGIONS;
+
     vkEndCommandBuffer( commandBuffer );
 
     VkSubmitInfo submitInfo = {};
@@ -1571,6 +1626,12 @@ namespace fn {
     vkQueueSubmit( m_graphicsQueue, 1, &submitInfo, VK_NULL_HANDLE );
     vkQueueWaitIdle( m_graphicsQueue );
 
+    // Waited for already, the results are there
+    if ( timed ) {
+      m_gpuProfiler.submitted( GpuProfiler::IMMEDIATE );
+      m_gpuProfiler.collect( GpuProfiler::IMMEDIATE );
+    }
+
     vkFreeCommandBuffers( m_device, m_commandPool, 1, &commandBuffer );
   }
 
@@ -1657,7 +1718,7 @@ namespace fn {
 
   void VulkanBase::copyBuffertoImage( VkBuffer buffer, VkImage image, uint32_t width,
                                       uint32_t height ) noexcept {
-    VkCommandBuffer commandBuffer = beginSingleTimeCommands();
+    VkCommandBuffer commandBuffer = beginSingleTimeCommands( "GPU texture upload" );
 
     VkBufferImageCopy region = {};
     region.bufferOffset = 0;
@@ -1711,7 +1772,7 @@ namespace fn {
     viewInfo.subresourceRange.layerCount = 1;
 
     VkImageView imageView;
-    VK_CHECK_RESULT( vkCreateImageView( m_device, &viewInfo, nullptr, &imageView ) );
+    VK_CHECK_RESULT( vkCreateImageView( m_device, &viewInfo, hostAllocator(), &imageView ) );
 
     return imageView;
   }
@@ -1742,7 +1803,7 @@ namespace fn {
     samplerInfo.minLod = 0.0f;
     samplerInfo.maxLod = static_cast<float>( m_mipLevels );
 
-    VK_CHECK_RESULT( vkCreateSampler( m_device, &samplerInfo, nullptr, &m_textureSampler ) );
+    VK_CHECK_RESULT( vkCreateSampler( m_device, &samplerInfo, hostAllocator(), &m_textureSampler ) );
   }
 
   void VulkanBase::createDepthResources() noexcept {
@@ -1789,45 +1850,19 @@ namespace fn {
   }
 
   void VulkanBase::loadModel() noexcept {
-
-    tinyobj::attrib_t attrib;
-    std::vector<tinyobj::shape_t> shapes;
-    std::vector<tinyobj::material_t> materials;
-    std::string warn, err;
-
-    if ( !tinyobj::LoadObj( &attrib, &shapes, &materials, &warn, &err, MODEL_PATH.c_str() ) ) {
-      log::warning( "%s\n", warn.c_str() );
-      log::error( "%s\n", err.c_str() );
+    FN_PROFILE_FUNCTION();
+    // Parsed and deduplicated by a loader thread
+    std::shared_ptr<Model> model = p_resources->wait( m_model );
+    FN_ASSERT_M( model, "Faild to load model" );
+
+    vertices.clear();
+    vertices.reserve( model->vertices().size() );
+    for ( const Model::Vertex &vertex : model->vertices() ) {
+      vertices.push_back( {vertex.position, vertex.color, vertex.texCoord} );
     }
+    indices = model->indices();
 
-    std::unordered_map<Vertex, uint32_t> uniqueVertices = {};
-
-    for ( const auto &shape : shapes ) {
-      for ( const auto &index : shape.mesh.indices ) {
-
-        Vertex vertex = {};
-
-        vertices.push_back( vertex );
-
-
-        vertex.position = {attrib.vertices[ 3 * index.vertex_index + 0 ],
-                           attrib.vertices[ 3 * index.vertex_index + 1 ],
-                           attrib.vertices[ 3 * index.vertex_index + 2 ]};
-
-        vertex.texCoord = {attrib.texcoords[ 2 * index.texcoord_index + 0 ],
-                           1.0f - attrib.texcoords[ 2 * index.texcoord_index + 1 ]};
-
-        vertex.color = {1.0f, 1.0f, 1.0f};
-
-        if ( uniqueVertices.count( vertex ) == 0 ) {
-          uniqueVertices[ vertex ] = static_cast<uint32_t>( vertices.size() );
-          vertices.push_back( vertex );
-        }
-
-
-        indices.push_back( uniqueVertices[ vertex ] );
-      }
-    }
+    p_resources->release( m_model );
   }
 
   void VulkanBase::generateMipMaps( VkImage image, VkFormat imageFormat, int32_t texWidth,
@@ -1841,7 +1876,7 @@ namespace fn {
     FN_ASSERT( ( formatProperties.optimalTilingFeatures &
                  VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT ) );
 
-    VkCommandBuffer commandBuffer = beginSingleTimeCommands();
+    VkCommandBuffer commandBuffer = beginSingleTimeCommands( "GPU mip generation" );
 
     VkImageMemoryBarrier barrier = {};
     barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
@@ -0,0 +1,221 @@
+#include "renderer/vulkan_host_allocator.hh"
+#include "core/logger.hh"
+
+#include <cstring>
+
+namespace fn {
+
+  namespace {
+
+    enum class Source : uint8_t { Heap, Arena, Pool };
+
+    // Right before every block, in the padding that aligns it
+    struct Header {
+      std::size_t size;
+      uint32_t offset;
+      uint8_t scope;
+      Source source;
+      uint8_t sizeClass;
+    };
+
+    constexpr std::size_t HEADER_BYTES = 16;
+    static_assert( sizeof( Header ) <= HEADER_BYTES, "the header must fit before the smallest alignment" );
+
+    constexpr const char *SCOPE_NAMES[ VulkanHostAllocator::SCOPE_COUNT ] = {"command", "object", "cache",
+                                                                              "device", "instance"};
+
+    Header *header( void *memory ) noexcept {
+      return reinterpret_cast<Header *>( static_cast<unsigned char *>( memory ) - sizeof( Header ) );
+    }
+
+  }    // namespace
+
+  VulkanHostAllocator::VulkanHostAllocator( bool recycle )
+      : m_recycle( recycle )
+      , m_commandArena( recycle ? COMMAND_ARENA_BYTES : POOL_MIN_BYTES ) {
+    m_callbacks.pUserData = this;
+    m_callbacks.pfnAllocation = &VulkanHostAllocator::allocation;
+    m_callbacks.pfnReallocation = &VulkanHostAllocator::reallocation;
+    m_callbacks.pfnFree = &VulkanHostAllocator::free;
+    m_callbacks.pfnInternalAllocation = &VulkanHostAllocator::internalAllocation;
+    m_callbacks.pfnInternalFree = &VulkanHostAllocator::internalFree;
+  }
+
+  VulkanHostAllocator::~VulkanHostAllocator() noexcept {
+    for ( void *&list : m_free ) {
+      while ( list ) {
+        void *next = *static_cast<void **>( list );
+        MemoryTracker::deallocate( list );
+        list = next;
+      }
+    }
+  }
+
+  void *VulkanHostAllocator::allocate( std::size_t size, std::size_t alignment,
+                                       VkSystemAllocationScope scope ) noexcept {
+    if ( size == 0 || static_cast<std::size_t>( scope ) >= SCOPE_COUNT ) return nullptr;
+
+    // The header sits in the alignment padding, at least HEADER_BYTES of it
+    if ( alignment < HEADER_BYTES ) alignment = HEADER_BYTES;
+    if ( size > SIZE_MAX - alignment ) return nullptr;
+    const std::size_t bytes = size + alignment;
+
+    unsigned char *raw = nullptr;
+    Source source = Source::Heap;
+    uint8_t sizeClass = 0;
+    std::size_t heapBytes = bytes;
+
+    if ( m_recycle ) {
+      std::lock_guard<std::mutex> lock( m_mutex );
+      if ( scope == VK_SYSTEM_ALLOCATION_SCOPE_COMMAND &&
+           m_commandArena.used() + bytes + alignment <= m_commandArena.capacity() ) {
+        raw = static_cast<unsigned char *>( m_commandArena.allocate( bytes, alignment ) );
+        source = Source::Arena;
+        m_commandLive++;
+      } else if ( scope == VK_SYSTEM_ALLOCATION_SCOPE_OBJECT && alignment == HEADER_BYTES &&
+                  bytes <= POOL_MAX_BYTES ) {
+        source = Source::Pool;
+        heapBytes = POOL_MIN_BYTES;
+        while ( heapBytes < bytes ) {
+          heapBytes *= 2;
+          sizeClass++;
+        }
+        if ( m_free[ sizeClass ] ) {
+          raw = static_cast<unsigned char *>( m_free[ sizeClass ] );
+          m_free[ sizeClass ] = *static_cast<void **>( m_free[ sizeClass ] );
+          m_freeCount[ sizeClass ]--;
+        }
+      }
+    }
+
+    if ( raw ) {
+      m_recycled.fetch_add( 1, std::memory_order_relaxed );
+    } else {
+      raw = static_cast<unsigned char *>(
+          MemoryTracker::allocate( heapBytes, alignment, MemoryTag::Renderer ) );
+      if ( !raw ) return nullptr;
+    }
+
+    void *memory = raw + alignment;
+    const auto index = static_cast<uint8_t>( scope );
+    *header( memory ) = {size, static_cast<uint32_t>( alignment ), index, source, sizeClass};
+
+    Counters &charged = m_scopes[ index ];
+    charged.allocations.fetch_add( 1, std::memory_order_relaxed );
+    charged.live.fetch_add( 1, std::memory_order_relaxed );
+    const std::size_t current = charged.current.fetch_add( size, std::memory_order_relaxed ) + size;
+
+    std::size_t peak = charged.peak.load( std::memory_order_relaxed );
+    while ( current > peak &&
+            !charged.peak.compare_exchange_weak( peak, current, std::memory_order_relaxed ) ) {
+    }
+
+    return memory;
+  }
+
+  void VulkanHostAllocator::deallocate( void *memory ) noexcept {
+    if ( !memory ) return;
+
+    const Header block = *header( memory );
+    Counters &charged = m_scopes[ block.scope ];
+    charged.current.fetch_sub( block.size, std::memory_order_relaxed );
+    charged.live.fetch_sub( 1, std::memory_order_relaxed );
+
+    void *raw = static_cast<unsigned char *>( memory ) - block.offset;
+    if ( block.source == Source::Arena ) {
+      // Every command is done with its memory, the whole arena is free again
+      std::lock_guard<std::mutex> lock( m_mutex );
+      if ( --m_commandLive == 0 ) m_commandArena.reset();
+      return;
+    }
+
+    if ( block.source == Source::Pool ) {
+      std::lock_guard<std::mutex> lock( m_mutex );
+      if ( m_freeCount[ block.sizeClass ] < POOL_MAX_FREE ) {
+        *static_cast<void **>( raw ) = m_free[ block.sizeClass ];
+        m_free[ block.sizeClass ] = raw;
+        m_freeCount[ block.sizeClass ]++;
+        return;
+      }
+    }
+
+    MemoryTracker::deallocate( raw );
+  }
+
+  void *VulkanHostAllocator::allocation( void *userData, std::size_t size, std::size_t alignment,
+                                         VkSystemAllocationScope scope ) {
+    return static_cast<VulkanHostAllocator *>( userData )->allocate( size, alignment, scope );
+  }
+
+  void *VulkanHostAllocator::reallocation( void *userData, void *original, std::size_t size,
+                                           std::size_t alignment, VkSystemAllocationScope scope ) {
+    auto *allocator = static_cast<VulkanHostAllocator *>( userData );
+    if ( !original ) return allocator->allocate( size, alignment, scope );
+    if ( size == 0 ) {
+      allocator->deallocate( original );
+      return nullptr;
+    }
+
+    // The original stays valid when there is no memory for the new block
+    const std::size_t previous = header( original )->size;
+    void *moved = allocator->allocate( size, alignment, scope );
+    if ( !moved ) return nullptr;
+
+    std::memcpy( moved, original, previous < size ? previous : size );
+    allocator->deallocate( original );
+    return moved;
+  }
+
+  void VulkanHostAllocator::free( void *userData, void *memory ) {
+    static_cast<VulkanHostAllocator *>( userData )->deallocate( memory );
+  }
+
+  void VulkanHostAllocator::internalAllocation( void *userData, std::size_t size, VkInternalAllocationType,
+                                                VkSystemAllocationScope scope ) {
+    const auto index = static_cast<std::size_t>( scope );
+    if ( index >= SCOPE_COUNT ) return;
+    Counters &notified = static_cast<VulkanHostAllocator *>( userData )->m_scopes[ index ];
+    notified.internal.fetch_add( size, std::memory_order_relaxed );
+  }
+
+  void VulkanHostAllocator::internalFree( void *userData, std::size_t size, VkInternalAllocationType,
+                                          VkSystemAllocationScope scope ) {
+    const auto index = static_cast<std::size_t>( scope );
+    if ( index >= SCOPE_COUNT ) return;
+    Counters &notified = static_cast<VulkanHostAllocator *>( userData )->m_scopes[ index ];
+    notified.internal.fetch_sub( size, std::memory_order_relaxed );
+  }
+
+  MemoryStats VulkanHostAllocator::stats( VkSystemAllocationScope scope ) const noexcept {
+    const Counters &charged = m_scopes[ static_cast<std::size_t>( scope ) ];
+    MemoryStats stats;
+    stats.current = charged.current.load( std::memory_order_relaxed );
+    stats.peak = charged.peak.load( std::memory_order_relaxed );
+    stats.allocations = charged.allocations.load( std::memory_order_relaxed );
+    stats.live = charged.live.load( std::memory_order_relaxed );
+    return stats;
+  }
+
+  std::size_t VulkanHostAllocator::internalBytes( VkSystemAllocationScope scope ) const noexcept {
+    return m_scopes[ static_cast<std::size_t>( scope ) ].internal.load( std::memory_order_relaxed );
+  }
+
+  void VulkanHostAllocator::report() const noexcept {
+    std::size_t allocations = 0;
+    for ( std::size_t i = 0; i < SCOPE_COUNT; i++ ) {
+      const auto scope = static_cast<VkSystemAllocationScope>( i );
+      const MemoryStats held = stats( scope );
+      const std::size_t internal = internalBytes( scope );
+      allocations += held.allocations;
+      if ( held.allocations == 0 && internal == 0 ) continue;
+
+      log::info( "Vulkan %-8s %10zu bytes now, %10zu at peak, %zu allocations, %zu live, %zu internal\n",
+                 SCOPE_NAMES[ i ], held.current, held.peak, held.allocations, held.live, internal );
+    }
+
+    if ( m_recycle ) {
+      log::info( "Vulkan host allocations: %zu of %zu recycled\n", recycled(), allocations );
+    }
+  }
+
+}    // namespace fn
@@ -0,0 +1,110 @@
+/* =======================================================================
+   $File: model.cc
+   $Date: 16-10-2026
+   $Revision: 16-10-2026
+   $Creator: Orestis Ro Stelmach
+   $Email: stelmach.ro[at]gmail.com
+   $Notice:
+   ======================================================================== */
+
+#include "resources/model.hh"
+#include "core/logger.hh"
+
+#define TINYOBJLOADER_IMPLEMENTATION
+#include <tinyobjloader/tiny_obj_loader.h>
+
+#include <cstring>
+#include <istream>
+#include <streambuf>
+#include <unordered_map>
+
+namespace fn {
+
+  namespace {
+
+    // Lets tinyobj read the bytes of the file without copying them
+    struct ByteBuffer : std::streambuf {
+      explicit ByteBuffer( const std::vector<char> &bytes ) {
+        char *begin = const_cast<char *>( bytes.data() );
+        setg( begin, begin, begin + bytes.size() );
+      }
+    };
+
+    struct VertexHash {
+      std::size_t operator()( const Model::Vertex &vertex ) const noexcept {
+        float values[ 8 ];
+        std::memcpy( values, &vertex, sizeof( values ) );
+
+        std::size_t hash = 0;
+        for ( float value : values ) {
+          // -0.0f == 0.0f, so both have to hash alike
+          value = value == 0.0f ? 0.0f : value;
+          uint32_t bits;
+          std::memcpy( &bits, &value, sizeof( bits ) );
+          hash = hash * 31 + bits;
+        }
+        return hash;
+      }
+    };
+
+    struct VertexEqual {
+      bool operator()( const Model::Vertex &a, const Model::Vertex &b ) const noexcept {
+        return a.position == b.position && a.color == b.color && a.texCoord == b.texCoord;
+      }
+    };
+
+  }    // namespace
+
+  static_assert( sizeof( Model::Vertex ) == 8 * sizeof( float ), "vertices are hashed as eight floats" );
+
+  bool Model::decode( const std::vector<char> &bytes, const std::string &path ) {
+    ByteBuffer buffer( bytes );
+    std::istream stream( &buffer );
+
+    tinyobj::attrib_t attrib;
+    std::vector<tinyobj::shape_t> shapes;
+    std::vector<tinyobj::material_t> materials;
+    std::string warn, err;
+
+    if ( !tinyobj::LoadObj( &attrib, &shapes, &materials, &warn, &err, &stream ) ) {
+      log::error( "%s: %s\n", path.c_str(), err.c_str() );
+      return false;
+    }
+    if ( !warn.empty() ) {
+      log::warning( "%s: %s\n", path.c_str(), warn.c_str() );
+    }
+
+    std::unordered_map<Vertex, uint32_t, VertexHash, VertexEqual> uniqueVertices;
+
+    for ( const auto &shape : shapes ) {
+      for ( const auto &index : shape.mesh.indices ) {
+        Vertex vertex = {};
+
+        vertex.position = {attrib.vertices[ 3 * static_cast<std::size_t>( index.vertex_index ) + 0 ],
+                           attrib.vertices[ 3 * static_cast<std::size_t>( index.vertex_index ) + 1 ],
+                           attrib.vertices[ 3 * static_cast<std::size_t>( index.vertex_index ) + 2 ]};
+
+        if ( index.texcoord_index >= 0 ) {
+          vertex.texCoord = {attrib.texcoords[ 2 * static_cast<std::size_t>( index.texcoord_index ) + 0 ],
+                             1.0f - attrib.texcoords[ 2 * static_cast<std::size_t>( index.texcoord_index ) + 1 ]};
+        }
+
+        vertex.color = {1.0f, 1.0f, 1.0f};
+
+        auto inserted = uniqueVertices.emplace( vertex, static_cast<uint32_t>( m_vertices.size() ) );
+        if ( inserted.second ) {
+          m_vertices.push_back( vertex );
+        }
+
+        m_indices.push_back( inserted.first->second );
+      }
+    }
+
+    return !m_indices.empty();
+  }
+
+  std::size_t Model::memoryUsage() const noexcept {
+    return m_vertices.size() * sizeof( Vertex ) + m_indices.size() * sizeof( uint32_t );
+  }
+
+}    // namespace fn
@@ -15,4 +15,8 @@ namespace fn {
 
   Resource::~Resource() noexcept {}
 
+  std::size_t Resource::memoryUsage() const noexcept {
+    return 0;
+  }
+
 }    // namespace fn
@@ -0,0 +1,299 @@
+/* =======================================================================
+   $File: resource_manager.cc
+   $Date: 16-10-2026
+   $Revision: 16-10-2026
+   $Creator: Orestis Ro Stelmach
+   $Email: stelmach.ro[at]gmail.com
+   $Notice:
+   ======================================================================== */
+
+#include "resources/resource_manager.hh"
+#include "core/logger.hh"
+#include "core/memory_tracker.hh"
+#include "core/profiler.hh"
+
+#include <algorithm>
+#include <fstream>
+#include <unordered_set>
+
+namespace fn {
+
+  namespace {
+
+    bool readFile( const std::string &path, std::vector<char> &bytes ) {
+      std::ifstream file( path, std::ios::ate | std::ios::binary );
+      if ( !file.is_open() ) return false;
+
+      bytes.resize( static_cast<std::size_t>( file.tellg() ) );
+      file.seekg( 0 );
+      file.read( bytes.data(), static_cast<std::streamsize>( bytes.size() ) );
+      return static_cast<bool>( file );
+    }
+
+    // FNV-1a, identical files of any name hash alike
+    uint64_t contentHash( const std::vector<char> &bytes ) noexcept {
+      uint64_t hash = 14695981039346656037ull;
+      for ( char byte : bytes ) {
+        hash ^= static_cast<unsigned char>( byte );
+        hash *= 1099511628211ull;
+      }
+      return hash;
+    }
+
+  }    // namespace
+
+  ResourceManager::ResourceManager( uint32_t loaderThreads, uint64_t unloadDelay )
+      : m_unloadDelay( unloadDelay ) {
+    for ( uint32_t i = 0; i < std::max( loaderThreads, 1u ); i++ ) {
+      m_threads.emplace_back( [this] { loaderLoop(); } );
+    }
+  }
+
+  ResourceManager::~ResourceManager() noexcept {
+    {
+      std::lock_guard<std::mutex> lock( m_mutex );
+      m_stop = true;
+    }
+    m_work.notify_all();
+    for ( std::thread &thread : m_threads ) thread.join();
+  }
+
+  ResourceManager::Slot *ResourceManager::slot( Slot::Id id ) noexcept {
+    if ( id.index >= m_slots.size() ) return nullptr;
+    Slot &found = m_slots[ id.index ];
+    return found.generation == id.generation && found.state != ResourceState::Invalid ? &found : nullptr;
+  }
+
+  const ResourceManager::Slot *ResourceManager::slot( Slot::Id id ) const noexcept {
+    return const_cast<ResourceManager *>( this )->slot( id );
+  }
+
+  void ResourceManager::enqueue( Slot::Id id, ResourcePriority priority ) {
+    m_queue.push( {priority, m_sequence++, id} );
+    m_work.notify_one();
+  }
+
+  ResourceManager::Slot::Id ResourceManager::request( const std::string &path, ResourcePriority priority,
+                                                      const void *type, Factory factory ) {
+    FN_MEMORY_SCOPE( Assets );
+    std::lock_guard<std::mutex> lock( m_mutex );
+
+    auto known = m_byPath.find( path );
+    if ( known != m_byPath.end() ) {
+      Slot &found = m_slots[ known->second ];
+      const Slot::Id id = {known->second, found.generation};
+      if ( found.type != type ) {
+        log::error( "Resource %s is already loaded as another type\n", path.c_str() );
+        return {~0u, 0};
+      }
+
+      found.references++;
+      m_stats.pathHits++;
+
+      // A stale queue entry is skipped by the loaders, the new one wins
+      if ( found.state == ResourceState::Queued ) {
+        enqueue( id, priority );
+      } else if ( found.state == ResourceState::Failed ) {
+        found.state = ResourceState::Queued;
+        m_pending++;
+        enqueue( id, priority );
+      }
+      return id;
+    }
+
+    uint32_t index;
+    if ( m_freeSlots.empty() ) {
+      index = static_cast<uint32_t>( m_slots.size() );
+      m_slots.emplace_back();
+    } else {
+      index = m_freeSlots.back();
+      m_freeSlots.pop_back();
+    }
+
+    Slot &created = m_slots[ index ];
+    created.path = path;
+    created.type = type;
+    created.factory = factory;
+    created.state = ResourceState::Queued;
+    created.references = 1;
+    m_byPath.emplace( path, index );
+    m_stats.resident++;
+    m_pending++;
+
+    const Slot::Id id = {index, created.generation};
+    enqueue( id, priority );
+    return id;
+  }
+
+  std::shared_ptr<Resource> ResourceManager::find( Slot::Id id, const void *type, bool block ) const {
+    std::unique_lock<std::mutex> lock( m_mutex );
+
+    // Slots may move while waiting, look the slot up again each time
+    if ( block ) {
+      m_done.wait( lock, [this, id] {
+        const Slot *found = slot( id );
+        return !found || ( found->state != ResourceState::Queued && found->state != ResourceState::Loading );
+      } );
+    }
+
+    const Slot *found = slot( id );
+    if ( !found || found->type != type || found->state != ResourceState::Ready ) return nullptr;
+    return found->resource;
+  }
+
+  ResourceState ResourceManager::stateOf( Slot::Id id ) const {
+    std::lock_guard<std::mutex> lock( m_mutex );
+    const Slot *found = slot( id );
+    return found ? found->state : ResourceState::Invalid;
+  }
+
+  void ResourceManager::reference( Slot::Id id, bool acquire ) {
+    std::lock_guard<std::mutex> lock( m_mutex );
+    Slot *found = slot( id );
+    if ( !found ) return;
+
+    if ( acquire ) {
+      found->references++;
+    } else if ( found->references > 0 && --found->references == 0 ) {
+      found->releasedFrame = m_frame;
+      m_released.push_back( id );
+    }
+  }
+
+  void ResourceManager::waitAll() const {
+    std::unique_lock<std::mutex> lock( m_mutex );
+    m_done.wait( lock, [this] { return m_pending == 0; } );
+  }
+
+  void ResourceManager::update() {
+    std::lock_guard<std::mutex> lock( m_mutex );
+    m_frame++;
+
+    bool unloaded = false;
+    auto due = [this, &unloaded]( Slot::Id id ) {
+      Slot *found = slot( id );
+      if ( !found || found->references > 0 ) return true;
+
+      // A loader thread holds on to the slot, try again next frame
+      if ( found->state == ResourceState::Loading || m_frame - found->releasedFrame < m_unloadDelay ) {
+        return false;
+      }
+
+      if ( found->state == ResourceState::Queued ) m_pending--;
+      m_byPath.erase( found->path );
+      found->path.clear();
+      found->resource.reset();
+      found->state = ResourceState::Invalid;
+      found->generation++;
+      m_freeSlots.push_back( id.index );
+      m_stats.unloaded++;
+      m_stats.resident--;
+      unloaded = true;
+      return true;
+    };
+    m_released.erase( std::remove_if( m_released.begin(), m_released.end(), due ), m_released.end() );
+
+    if ( unloaded ) {
+      for ( auto entry = m_byContent.begin(); entry != m_byContent.end(); ) {
+        entry = entry->second.resource.expired() ? m_byContent.erase( entry ) : std::next( entry );
+      }
+      m_done.notify_all();
+    }
+  }
+
+  ResourceStats ResourceManager::stats() const {
+    std::lock_guard<std::mutex> lock( m_mutex );
+    ResourceStats stats = m_stats;
+
+    // Resources shared by content count once
+    std::unordered_set<const Resource *> counted;
+    stats.memory = 0;
+    for ( const Slot &entry : m_slots ) {
+      if ( entry.resource && counted.insert( entry.resource.get() ).second ) {
+        stats.memory += entry.resource->memoryUsage();
+      }
+    }
+    return stats;
+  }
+
+  void ResourceManager::loaderLoop() noexcept {
+    FN_PROFILE_THREAD_NAME( "resource loader" );
+    // File bytes, decoded pixels and parsed meshes
+    FN_MEMORY_SCOPE( Assets );
+    std::vector<char> bytes;
+    std::vector<char> knownBytes;
+
+    for ( ;; ) {
+      std::unique_lock<std::mutex> lock( m_mutex );
+      m_work.wait( lock, [this] { return m_stop || !m_queue.empty(); } );
+      if ( m_stop ) return;
+
+      const Request request = m_queue.top();
+      m_queue.pop();
+
+      // Unloaded, or picked up through an entry of higher priority
+      Slot *queued = slot( request.id );
+      if ( !queued || queued->state != ResourceState::Queued ) continue;
+
+      queued->state = ResourceState::Loading;
+      const std::string path = queued->path;
+      const void *type = queued->type;
+      const Factory factory = queued->factory;
+      lock.unlock();
+
+      std::shared_ptr<Resource> resource;
+      bool shared = false;
+      std::tuple<const void *, uint64_t, std::size_t> content;
+      FN_PROFILE_SCOPE( "ResourceManager::load" );
+      if ( readFile( path, bytes ) ) {
+        content = {type, contentHash( bytes ), bytes.size()};
+        std::string knownPath;
+        {
+          std::lock_guard<std::mutex> lookup( m_mutex );
+          auto known = m_byContent.find( content );
+          if ( known != m_byContent.end() ) {
+            resource = known->second.resource.lock();
+            knownPath = known->second.path;
+          }
+        }
+
+        // Equal hashes may still be different files
+        if ( resource && !( readFile( knownPath, knownBytes ) && knownBytes == bytes ) ) resource.reset();
+        shared = resource != nullptr;
+
+        if ( !shared ) {
+          try {
+            resource = factory();
+            if ( !resource->decode( bytes, path ) ) resource.reset();
+          } catch ( ... ) {
+            resource.reset();
+          }
+        }
+      }
+
+      lock.lock();
+      if ( resource && !shared ) {
+        // A resource decoded meanwhile by another loader, or from a file that
+        // only hashes alike, keeps the entry, this one is simply not shared
+        Content &known = m_byContent[ content ];
+        if ( known.resource.expired() ) known = {resource, path};
+      }
+
+      // Loading slots are never unloaded, this is still our slot
+      Slot &loaded = m_slots[ request.id.index ];
+      loaded.resource = resource;
+      loaded.state = resource ? ResourceState::Ready : ResourceState::Failed;
+      if ( !resource ) {
+        m_stats.failed++;
+        log::error( "Failed to load resource %s\n", path.c_str() );
+      } else if ( shared ) {
+        m_stats.contentHits++;
+      } else {
+        m_stats.loaded++;
+      }
+      m_pending--;
+      m_done.notify_all();
+    }
+  }
+
+}    // namespace fn
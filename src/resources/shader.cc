@@ -0,0 +1,29 @@
+/* =======================================================================
+   $File: shader.cc
+   $Date: 16-10-2026
+   $Revision: 16-10-2026
+   $Creator: Orestis Ro Stelmach
+   $Email: stelmach.ro[at]gmail.com
+   $Notice:
+   ======================================================================== */
+
+#include "resources/shader.hh"
+
+#include <cstring>
+
+namespace fn {
+
+  bool Shader::decode( const std::vector<char> &bytes, const std::string & ) {
+    // Whole words, starting with the SPIR-V magic number
+    if ( bytes.size() < sizeof( uint32_t ) || bytes.size() % sizeof( uint32_t ) != 0 ) return false;
+
+    m_code.resize( bytes.size() / sizeof( uint32_t ) );
+    std::memcpy( m_code.data(), bytes.data(), bytes.size() );
+    return m_code.front() == SPIRV_MAGIC;
+  }
+
+  std::size_t Shader::memoryUsage() const noexcept {
+    return m_code.size() * sizeof( uint32_t );
+  }
+
+}    // namespace fn
@@ -0,0 +1,65 @@
+/* =======================================================================
+   $File: texture.cc
+   $Date: 16-10-2026
+   $Revision: 16-10-2026
+   $Creator: Orestis Ro Stelmach
+   $Email: stelmach.ro[at]gmail.com
+   $Notice:
+   ======================================================================== */
+
+#include "resources/texture.hh"
+#include "core/memory_tracker.hh"
+
+// Decoded pixels are charged to Assets, whichever thread decodes them
+#if defined( FN_MEMORY_TRACKING )
+#define STBI_MALLOC( size ) fn::MemoryTracker::allocate( size, alignof( std::max_align_t ), fn::MemoryTag::Assets )
+#define STBI_REALLOC( memory, size ) fn::MemoryTracker::reallocate( memory, size, fn::MemoryTag::Assets )
+#define STBI_FREE( memory ) fn::MemoryTracker::deallocate( memory )
+#endif
+
+// The hooks expand in this file, so the C casts stb wraps them in are
+// no longer silenced as system header code
+#if defined( __GNUC__ )
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wold-style-cast"
+#endif
+#define STB_IMAGE_IMPLEMENTATION
+#include <stb/stb_image.h>
+#if defined( __GNUC__ )
+#pragma GCC diagnostic pop
+#endif
+
+#include <algorithm>
+#include <climits>
+#include <cmath>
+
+namespace fn {
+
+  bool Texture::decode( const std::vector<char> &bytes, const std::string & ) {
+    if ( bytes.size() > static_cast<std::size_t>( INT_MAX ) ) return false;
+
+    int width = 0;
+    int height = 0;
+    int channels = 0;
+    stbi_uc *pixels = stbi_load_from_memory( reinterpret_cast<const stbi_uc *>( bytes.data() ),
+                                             static_cast<int>( bytes.size() ), &width, &height, &channels,
+                                             STBI_rgb_alpha );
+    if ( !pixels ) return false;
+
+    m_width = static_cast<uint32_t>( width );
+    m_height = static_cast<uint32_t>( height );
+    m_pixels.assign( pixels, pixels + static_cast<std::size_t>( m_width ) * m_height * 4 );
+    stbi_image_free( pixels );
+    return true;
+  }
+
+  std::size_t Texture::memoryUsage() const noexcept {
+    return m_pixels.size();
+  }
+
+  uint32_t Texture::mipLevels() const noexcept {
+    // How many times the larger side halves before it reaches one
+    return static_cast<uint32_t>( std::floor( std::log2( std::max( m_width, m_height ) ) ) ) + 1;
+  }
+
+}    // namespace fn
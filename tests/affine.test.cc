@@ -0,0 +1,85 @@
+#include <catch2/catch.hpp>
+
+#include "math/affine.hh"
+#include "math/matrix_transformations.hh"
+
+#include <cmath>
+
+namespace {
+
+  constexpr double TOLERANCE = 1e-5;
+
+  bool closeTo( float value, float expected ) {
+    return std::fabs( static_cast<double>( value ) - static_cast<double>( expected ) ) <= TOLERANCE;
+  }
+
+  bool closeTo( const fn::Vec3 &a, const fn::Vec3 &b ) {
+    return closeTo( a.x, b.x ) && closeTo( a.y, b.y ) && closeTo( a.z, b.z );
+  }
+
+  bool closeTo( const fn::Matrix4 &a, const fn::Matrix4 &b ) {
+    for ( size_t c = 0; c < 4; c++ )
+      for ( unsigned r = 0; r < 4; r++ )
+        if ( !closeTo( a[ c ][ r ], b[ c ][ r ] ) )
+          return false;
+    return true;
+  }
+
+  fn::Matrix4 model( const fn::Vec3 &t, const fn::Vec3 &axis, float angle, const fn::Vec3 &s ) {
+    fn::Matrix4 m = fn::Math::translate( fn::Matrix4(), t );
+    m = fn::Math::rotate( m, axis, angle );
+    return fn::Math::scale( m, s );
+  }
+
+  constexpr fn::Affine3 shift = fn::Affine3::fromTranslation( fn::Vec3( 1.0f, 2.0f, 3.0f ) );
+  static_assert( shift.toMatrix()[ 3 ] == fn::Vec4( 1.0f, 2.0f, 3.0f, 1.0f ), "Affine3 to Matrix4" );
+  static_assert( fn::Affine3( shift.toMatrix() ) == shift, "Matrix4 to Affine3 round trip" );
+
+}    // namespace
+
+TEST_CASE( "Affine3 matches Matrix4", "[affine]" ) {
+  const fn::Vec3 axis( 1.0f, 2.0f, -0.5f );
+  const fn::Matrix4 ma = model( fn::Vec3( 3.0f, -1.0f, 2.0f ), axis, 0.8f, fn::Vec3( 2.0f, 0.5f, 1.5f ) );
+  const fn::Matrix4 mb = model( fn::Vec3( -4.0f, 0.5f, 1.0f ), fn::Vec3( 0.0f, 1.0f, 0.0f ), 2.5f,
+                                fn::Vec3( 1.0f, 3.0f, 0.25f ) );
+  const fn::Affine3 a( ma );
+  const fn::Affine3 b( mb );
+
+  REQUIRE( a.toMatrix() == ma );
+  const fn::Affine3 trs = fn::Affine3::fromTRS( fn::Vec3( 3.0f, -1.0f, 2.0f ),
+                                                fn::Quat::fromAxisAngle( axis, 0.8f ),
+                                                fn::Vec3( 2.0f, 0.5f, 1.5f ) );
+  REQUIRE( closeTo( trs.toMatrix(), ma ) );
+
+  REQUIRE( closeTo( ( a * b ).toMatrix(), ma * mb ) );
+
+  fn::Affine3 c( a );
+  c *= b;
+  REQUIRE( c == a * b );
+
+  const fn::Vec3 p( 0.5f, -2.0f, 4.0f );
+  REQUIRE( closeTo( a.transformPoint( p ), ma.transformPoint( p ) ) );
+  REQUIRE( closeTo( a.transformVector( p ), ma.transformVector( p ) ) );
+  REQUIRE( closeTo( a.determinant(), ma.determinant() ) );
+
+  REQUIRE( fn::Affine3( static_cast<glm::mat4>( a ) ) == a );
+}
+
+TEST_CASE( "Affine3 inverse", "[affine]" ) {
+  const fn::Matrix4 scaled =
+    model( fn::Vec3( 3.0f, -1.0f, 2.0f ), fn::Vec3( 1.0f, 2.0f, -0.5f ), 0.8f, fn::Vec3( 2.0f, 0.5f, 1.5f ) );
+  REQUIRE( closeTo( fn::Affine3( scaled ).inversed().toMatrix(), scaled.inversed() ) );
+
+  const fn::Matrix4 rigid =
+    model( fn::Vec3( -4.0f, 0.5f, 1.0f ), fn::Vec3( 0.0f, 1.0f, 1.0f ), 2.5f, fn::Vec3( 1.0f ) );
+  const fn::Affine3 r( rigid );
+  REQUIRE( closeTo( r.rigidInversed().toMatrix(), rigid.inversed() ) );
+  REQUIRE( closeTo( ( r * r.rigidInversed() ).toMatrix(), fn::Matrix4() ) );
+
+  // Singular transforms are left untouched
+  fn::Affine3 flat( fn::Vec4( 1.0f, 0.0f, 0.0f, 1.0f ), fn::Vec4( 0.0f, 0.0f, 0.0f, 2.0f ),
+                    fn::Vec4( 0.0f, 0.0f, 1.0f, 3.0f ) );
+  const fn::Affine3 before( flat );
+  flat.inverse();
+  REQUIRE( flat == before );
+}
@@ -0,0 +1,48 @@
+#include <catch2/catch.hpp>
+
+#include "math/aligned.hh"
+#include "math/batch.hh"
+
+#include <cstdint>
+#include <cstring>
+#include <map>
+
+namespace {
+
+  bool alignedTo( const void *p, size_t alignment ) {
+    return reinterpret_cast<std::uintptr_t>( p ) % alignment == 0;
+  }
+
+}    // namespace
+
+TEST_CASE( "AlignedAllocator honours the requested alignment", "[aligned]" ) {
+  for ( size_t n = 1; n < 64; n += 7 ) {
+    fn::AlignedVector<float, 32> floats( n );
+    fn::AlignedVector<float, 64> lines( n );
+    fn::AlignedVector<fn::Matrix4A> matrices( n );
+    REQUIRE( alignedTo( floats.data(), 32 ) );
+    REQUIRE( alignedTo( lines.data(), 64 ) );
+    for ( const fn::Matrix4A &m : matrices ) REQUIRE( alignedTo( &m, fn::simd::ALIGNMENT ) );
+  }
+
+  // Node based containers rebind to their node type and keep the alignment
+  std::map<int, fn::Vec4, std::less<int>, fn::AlignedAllocator<std::pair<const int, fn::Vec4>, 32>> map;
+  map[ 1 ] = fn::Vec4( 1.0f );
+  REQUIRE( alignedTo( &*map.begin(), 32 ) );
+}
+
+TEST_CASE( "Aligned types keep the layout and behaviour of their base", "[aligned]" ) {
+  const fn::Matrix4A m( 2.0f );
+  fn::Matrix4A product = m * m;
+  REQUIRE( product == fn::Matrix4( 4.0f ) );
+  REQUIRE( std::memcmp( m.data(), fn::Matrix4( 2.0f ).data(), sizeof( fn::Matrix4 ) ) == 0 );
+
+  fn::Vec4A v( 1.0f, 2.0f, 3.0f, 4.0f );
+  v += fn::Vec4( 1.0f );
+  REQUIRE( v.base() == fn::Vec4( 2.0f, 3.0f, 4.0f, 5.0f ) );
+
+  // Batch kernels take aligned arrays directly
+  fn::AlignedVector<fn::Matrix4A> in( 9, fn::Matrix4A( 2.0f ) ), out( 9 );
+  REQUIRE( fn::Math::inverseBatch( in.data(), out.data(), in.size() ) == 0 );
+  REQUIRE( out[ 8 ][ 1 ][ 1 ] == Approx( 0.5f ) );
+}
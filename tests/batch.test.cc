@@ -0,0 +1,168 @@
+#include <catch2/catch.hpp>
+
+#include "math/batch.hh"
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace {
+
+  constexpr double TOLERANCE = 1e-5;
+
+  // Odd count so the 8-wide, 4-wide and scalar tail loops all run
+  constexpr size_t COUNT = 37;
+
+  struct Stream {
+    explicit Stream( std::mt19937 &rng ) : x( COUNT ), y( COUNT ), z( COUNT ) {
+      std::uniform_real_distribution<float> dist( -10.0f, 10.0f );
+      for ( size_t i = 0; i < COUNT; i++ ) {
+        x[ i ] = dist( rng );
+        y[ i ] = dist( rng );
+        z[ i ] = dist( rng );
+      }
+    }
+
+    fn::Vec3 at( size_t i ) const { return fn::Vec3( x[ i ], y[ i ], z[ i ] ); }
+    fn::Math::Vec3Stream view() { return { x.data(), y.data(), z.data() }; }
+
+    std::vector<float> x, y, z;
+  };
+
+  bool closeTo( float value, float expected ) {
+    return std::fabs( static_cast<double>( value ) - static_cast<double>( expected ) ) <=
+           TOLERANCE * std::fmax( 1.0, std::fabs( static_cast<double>( expected ) ) );
+  }
+
+  bool closeTo( const fn::Vec3 &value, const fn::Vec3 &expected ) {
+    return closeTo( value.x, expected.x ) && closeTo( value.y, expected.y ) &&
+           closeTo( value.z, expected.z );
+  }
+
+}    // namespace
+
+TEST_CASE( "Batch transforms match Matrix4", "[batch]" ) {
+  std::mt19937 rng( 99 );
+  Stream in( rng );
+  Stream points( rng );
+  Stream vectors( rng );
+
+  fn::Matrix4 m( 1.0f, 2.0f, 0.5f, 0.0f,
+                 -1.0f, 0.25f, 3.0f, 0.0f,
+                 0.0f, 1.5f, -2.0f, 0.0f,
+                 4.0f, -3.0f, 7.0f, 1.0f );
+
+  fn::Math::transformPoints( m, in.view(), points.view(), COUNT );
+  fn::Math::transformVectors( m, in.view(), vectors.view(), COUNT );
+
+  for ( size_t i = 0; i < COUNT; i++ ) {
+    REQUIRE( closeTo( points.at( i ), m.transformPoint( in.at( i ) ) ) );
+    REQUIRE( closeTo( vectors.at( i ), m.transformVector( in.at( i ) ) ) );
+  }
+
+  // In place
+  fn::Math::transformPoints( m, in.view(), in.view(), COUNT );
+  for ( size_t i = 0; i < COUNT; i++ )
+    REQUIRE( closeTo( in.at( i ), points.at( i ) ) );
+}
+
+TEST_CASE( "Batch vector operations", "[batch]" ) {
+  std::mt19937 rng( 5 );
+  Stream a( rng );
+  Stream b( rng );
+  Stream c( rng );
+  std::vector<float> d( COUNT );
+
+  a.x[ 3 ] = a.y[ 3 ] = a.z[ 3 ] = 0.0f;
+
+  fn::Math::dot( a.view(), b.view(), d.data(), COUNT );
+  fn::Math::cross( a.view(), b.view(), c.view(), COUNT );
+
+  for ( size_t i = 0; i < COUNT; i++ ) {
+    REQUIRE( closeTo( d[ i ], fn::dotProduct( a.at( i ), b.at( i ) ) ) );
+    REQUIRE( closeTo( c.at( i ), fn::crossProduct( a.at( i ), b.at( i ) ) ) );
+  }
+
+  const Stream original( a );
+  fn::Math::normalize( a.view(), COUNT );
+
+  REQUIRE( a.at( 3 ) == fn::Vec3( 0.0f ) );
+  for ( size_t i = 0; i < COUNT; i++ ) {
+    if ( i == 3 )
+      continue;
+    REQUIRE( closeTo( a.at( i ).length(), 1.0f ) );
+    REQUIRE( closeTo( a.at( i ), original.at( i ).normalized() ) );
+  }
+}
+
+TEST_CASE( "Batch matrix multiply", "[batch]" ) {
+  std::vector<fn::Matrix4> lhs( 5 ), rhs( 5 ), out( 5 );
+  for ( size_t i = 0; i < lhs.size(); i++ ) {
+    lhs[ i ] = fn::Matrix4( static_cast<float>( i + 1 ) );
+    rhs[ i ] = fn::Matrix4( 1.0f, 2.0f, 3.0f, 4.0f,
+                            5.0f, 6.0f, 7.0f, 8.0f,
+                            9.0f, 10.0f, 11.0f, 12.0f,
+                            13.0f, 14.0f, 15.0f, static_cast<float>( i ) );
+  }
+
+  fn::Math::multiply( lhs.data(), rhs.data(), out.data(), lhs.size() );
+
+  for ( size_t i = 0; i < lhs.size(); i++ )
+    REQUIRE( out[ i ] == lhs[ i ] * rhs[ i ] );
+}
+
+TEST_CASE( "Batch inverse matches Matrix4 and flags singular inputs", "[batch]" ) {
+  // 8 + 4 + 1 so every lane width is used
+  constexpr size_t N = 13;
+  std::mt19937 rng( 21 );
+  std::uniform_real_distribution<float> dist( -2.0f, 2.0f );
+
+  std::vector<fn::Matrix4> general( N ), affine( N ), out( N );
+  for ( size_t n = 0; n < N; n++ ) {
+    for ( size_t c = 0; c < 4; c++ )
+      for ( unsigned r = 0; r < 4; r++ )
+        general[ n ][ c ][ r ] = dist( rng ) + ( c == r ? 4.0f : 0.0f );
+
+    affine[ n ] = general[ n ];
+    affine[ n ][ 0 ][ 3 ] = affine[ n ][ 1 ][ 3 ] = affine[ n ][ 2 ][ 3 ] = 0.0f;
+    affine[ n ][ 3 ][ 3 ] = 1.0f;
+  }
+
+  // A zero scale axis makes these two singular
+  general[ 2 ][ 1 ] = fn::Vec4( 0.0f );
+  affine[ 9 ][ 2 ] = fn::Vec4( 0.0f );
+
+  auto matches = []( const fn::Matrix4 &a, const fn::Matrix4 &b ) {
+    for ( size_t c = 0; c < 4; c++ )
+      for ( unsigned r = 0; r < 4; r++ ) {
+        const double x = static_cast<double>( a[ c ][ r ] );
+        const double y = static_cast<double>( b[ c ][ r ] );
+        if ( std::fabs( x - y ) > 1e-4 * std::fmax( 1.0, std::fabs( y ) ) )
+          return false;
+      }
+    return true;
+  };
+
+  bool singular[ N ];
+  REQUIRE( fn::Math::inverseBatch( general.data(), out.data(), N, singular ) == 1 );
+  for ( size_t n = 0; n < N; n++ ) {
+    REQUIRE( singular[ n ] == ( n == 2 ) );
+    if ( n != 2 )
+      REQUIRE( matches( out[ n ], general[ n ].inversed() ) );
+  }
+  REQUIRE( out[ 2 ] == general[ 2 ] );
+  const std::vector<fn::Matrix4> inverses( out );
+
+  REQUIRE( fn::Math::inverseAffineBatch( affine.data(), out.data(), N, singular ) == 1 );
+  for ( size_t n = 0; n < N; n++ ) {
+    REQUIRE( singular[ n ] == ( n == 9 ) );
+    if ( n != 9 )
+      REQUIRE( matches( out[ n ], affine[ n ].inversed() ) );
+  }
+  REQUIRE( out[ 9 ] == affine[ 9 ] );
+
+  // In place, without flags
+  fn::Math::inverseBatch( general.data(), general.data(), N );
+  for ( size_t n = 0; n < N; n++ )
+    REQUIRE( general[ n ] == inverses[ n ] );
+}
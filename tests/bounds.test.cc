@@ -0,0 +1,90 @@
+#include <catch2/catch.hpp>
+
+#include "math/batch.hh"
+#include "math/matrix_transformations.hh"
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace {
+
+  // Unit cube around the origin, planes at +-10 on every axis
+  const fn::Frustum box( fn::Math::ortho( -10.0f, 10.0f, -10.0f, 10.0f, -10.0f, 10.0f ) );
+
+  fn::Frustum perspective( fn::ClipDepth depth ) {
+    const glm::mat4 proj = glm::perspective( 0.8f, 1.5f, 0.1f, 100.0f );
+    const glm::mat4 view =
+      glm::lookAt( glm::vec3( 0.0f, 2.0f, 5.0f ), glm::vec3( 0.0f ), glm::vec3( 0.0f, 1.0f, 0.0f ) );
+    return fn::Frustum( proj * view, depth );
+  }
+
+}    // namespace
+
+TEST_CASE( "Frustum planes from an orthographic projection", "[bounds]" ) {
+  REQUIRE( box.isVisible( fn::Vec3( 0.0f ) ) );
+  REQUIRE( box.isVisible( fn::Vec3( 9.9f, -9.9f, 9.9f ) ) );
+  REQUIRE_FALSE( box.isVisible( fn::Vec3( 10.1f, 0.0f, 0.0f ) ) );
+
+  // Straddling a plane is visible, fully past it is not
+  REQUIRE( box.isVisible( fn::AABB( fn::Vec3( 9.0f, 0.0f, 0.0f ), fn::Vec3( 11.0f, 1.0f, 1.0f ) ) ) );
+  REQUIRE_FALSE( box.isVisible( fn::AABB( fn::Vec3( 10.5f, 0.0f, 0.0f ), fn::Vec3( 11.0f, 1.0f, 1.0f ) ) ) );
+  REQUIRE( box.isVisible( fn::Sphere( fn::Vec3( 0.0f, 0.0f, 10.5f ), 1.0f ) ) );
+  REQUIRE_FALSE( box.isVisible( fn::Sphere( fn::Vec3( 0.0f, -11.5f, 0.0f ), 1.0f ) ) );
+}
+
+TEST_CASE( "Frustum depth range only moves the near plane", "[bounds]" ) {
+  const fn::Frustum gl = perspective( fn::ClipDepth::NegativeOneToOne );
+  const fn::Frustum vk = perspective( fn::ClipDepth::ZeroToOne );
+
+  // The camera sits at ( 0, 2, 5 ) looking at the origin
+  REQUIRE( gl.isVisible( fn::Vec3( 0.0f ) ) );
+  REQUIRE_FALSE( gl.isVisible( fn::Vec3( 0.0f, 2.0f, 6.0f ) ) );
+  REQUIRE_FALSE( gl.isVisible( fn::Vec3( 50.0f, 0.0f, 0.0f ) ) );
+  REQUIRE( gl.plane( fn::Frustum::Left ) == vk.plane( fn::Frustum::Left ) );
+  REQUIRE( gl.plane( fn::Frustum::Far ) == vk.plane( fn::Frustum::Far ) );
+  REQUIRE( vk.isVisible( fn::Vec3( 0.0f ) ) );
+}
+
+TEST_CASE( "Batched culling matches the scalar tests", "[bounds][batch]" ) {
+  // 8 + 8 + 8 + 8 + 4 + 1 so every lane width is used
+  constexpr size_t COUNT = 37;
+  std::mt19937 rng( 3 );
+  std::uniform_real_distribution<float> position( -40.0f, 40.0f );
+  std::uniform_real_distribution<float> size( 0.1f, 4.0f );
+
+  const fn::Frustum frustum = perspective( fn::ClipDepth::ZeroToOne );
+
+  std::vector<fn::AABB> boxes( COUNT );
+  std::vector<fn::Sphere> spheres( COUNT );
+  for ( size_t i = 0; i < COUNT; i++ ) {
+    const fn::Vec3 c( position( rng ), position( rng ) * 0.25f, position( rng ) );
+    const fn::Vec3 e( size( rng ), size( rng ), size( rng ) );
+    boxes[ i ] = fn::AABB( c - e, c + e );
+    spheres[ i ] = fn::Sphere( c, size( rng ) );
+  }
+
+  std::vector<uint32_t> visible( COUNT );
+
+  std::vector<uint32_t> expected;
+  for ( size_t i = 0; i < COUNT; i++ )
+    if ( frustum.isVisible( boxes[ i ] ) )
+      expected.push_back( static_cast<uint32_t>( i ) );
+  REQUIRE_FALSE( expected.empty() );
+  REQUIRE( expected.size() < COUNT );
+
+  size_t found = fn::Math::cullBoxes( frustum, boxes.data(), COUNT, visible.data() );
+  REQUIRE( std::vector<uint32_t>( visible.begin(), visible.begin() + static_cast<long>( found ) ) ==
+           expected );
+
+  expected.clear();
+  for ( size_t i = 0; i < COUNT; i++ )
+    if ( frustum.isVisible( spheres[ i ] ) )
+      expected.push_back( static_cast<uint32_t>( i ) );
+
+  found = fn::Math::cullSpheres( frustum, spheres.data(), COUNT, visible.data() );
+  REQUIRE( std::vector<uint32_t>( visible.begin(), visible.begin() + static_cast<long>( found ) ) ==
+           expected );
+}
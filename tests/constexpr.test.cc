@@ -0,0 +1,53 @@
+#include <catch2/catch.hpp>
+
+#include "math/matrix_transformations.hh"
+
+namespace {
+
+  // Everything below is evaluated by the compiler, a failure breaks the build
+
+  constexpr fn::Vec2 v2 = fn::Vec2( 1.0f, 2.0f ) + fn::Vec2( 3.0f );
+  static_assert( v2.x == 4.0f && v2.y == 5.0f, "tVec2 addition" );
+  static_assert( v2[ 1 ] == 5.0f, "tVec2 indexing" );
+  static_assert( fn::dotProduct( v2, fn::Vec2( 1.0f, 1.0f ) ) == 9.0f, "tVec2 dot product" );
+
+  constexpr fn::Vec3 x( 1.0f, 0.0f, 0.0f );
+  constexpr fn::Vec3 y( 0.0f, 1.0f, 0.0f );
+  static_assert( fn::crossProduct( x, y ) == fn::Vec3( 0.0f, 0.0f, 1.0f ), "tVec3 cross product" );
+  static_assert( ( x * 2.0f - y )[ 1 ] == -1.0f, "tVec3 arithmetic and indexing" );
+  static_assert( fn::Vec3( 2.0f, 3.0f, 6.0f ).squaredLength() == 49.0f, "tVec3 squared length" );
+
+  constexpr fn::Vec4 compound() {
+    fn::Vec4 v( 1.0f, 2.0f, 3.0f, 4.0f );
+    v -= fn::Vec4( 1.0f, 1.0f, 1.0f, 2.0f );
+    v *= 2.0f;
+    return v;
+  }
+  static_assert( compound() == fn::Vec4( 0.0f, 2.0f, 4.0f, 4.0f ), "tVec4 compound assignment" );
+  static_assert( fn::dotProduct( fn::Vec4( 1.0f ), fn::Vec4( 1.0f, 2.0f, 3.0f, 4.0f ) ) == 10.0f,
+                 "tVec4 dot product" );
+
+  constexpr fn::Matrix4 identity;
+  static_assert( identity[ 2 ][ 2 ] == 1.0f && identity[ 2 ][ 1 ] == 0.0f, "Matrix4 identity" );
+  static_assert( identity * 2.0f == fn::Matrix4( 2.0f ), "Matrix4 scalar multiply" );
+  static_assert( identity + identity - identity == identity, "Matrix4 element-wise ops" );
+  static_assert( ( -identity )[ 3 ][ 3 ] == -1.0f, "Matrix4 unary minus" );
+
+  constexpr fn::Matrix4 model =
+    fn::Math::translate( fn::Math::scale( identity, fn::Vec3( 2.0f ) ), fn::Vec3( 1.0f, 2.0f, 3.0f ) );
+  static_assert( model[ 0 ][ 0 ] == 2.0f && model[ 3 ] == fn::Vec4( 2.0f, 4.0f, 6.0f, 1.0f ),
+                 "Math::scale and Math::translate" );
+
+  constexpr fn::Matrix4 projection = fn::Math::ortho( 0.0f, 800.0f, 0.0f, 600.0f, -1.0f, 1.0f );
+  static_assert( projection[ 0 ][ 0 ] == 2.0f / 800.0f && projection[ 3 ][ 0 ] == -1.0f,
+                 "Math::ortho" );
+
+}    // namespace
+
+TEST_CASE( "constexpr matrices match their runtime counterparts", "[constexpr]" ) {
+  fn::Matrix4 runtime = fn::Math::ortho( 0.0f, 800.0f, 0.0f, 600.0f, -1.0f, 1.0f );
+  REQUIRE( runtime == projection );
+
+  // Constant folded matrices still feed the SIMD paths
+  REQUIRE( model.transformPoint( fn::Vec3( 1.0f ) ) == fn::Vec3( 4.0f, 6.0f, 8.0f ) );
+}
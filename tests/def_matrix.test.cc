@@ -0,0 +1,87 @@
+#include <catch2/catch.hpp>
+
+#include "math/def_matrix.hh"
+#include "math/matrix_transformations.hh"
+
+#include <cstring>
+
+namespace {
+
+  template <size_t R, size_t C>
+  void requireClose( const fn::tMat<R, C> &a, const fn::tMat<R, C> &b ) {
+    for ( size_t c = 0; c < C; c++ )
+      for ( unsigned r = 0; r < R; r++ ) REQUIRE( a[ c ][ r ] == Approx( b[ c ][ r ] ).margin( 1e-5 ) );
+  }
+
+  fn::Matrix4 model() {
+    fn::Matrix4 m = fn::Math::translate( fn::Matrix4(), fn::Vec3( 1.0f, -2.0f, 3.0f ) );
+    m = fn::Math::rotate( m, fn::Vec3( 0.0f, 0.6f, 0.8f ), 0.7f );
+    return fn::Math::scale( m, fn::Vec3( 2.0f, 1.0f, 0.5f ) );
+  }
+
+  constexpr fn::Matrix3 rotZ( 0.0f, 1.0f, 0.0f, -1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f );
+  static_assert( rotZ * fn::Vec3( 1.0f, 0.0f, 0.0f ) == fn::Vec3( 0.0f, 1.0f, 0.0f ), "constexpr product" );
+  static_assert( rotZ.transposed() * rotZ == fn::Matrix3(), "constexpr transpose" );
+  static_assert( fn::Matrix2( 2.0f ).determinant() == 4.0f, "constexpr determinant" );
+
+}    // namespace
+
+TEST_CASE( "tMat narrows from and widens to Matrix4", "[def_matrix]" ) {
+  const fn::Matrix4 m = model();
+  const fn::Matrix3x4 affine( m );
+
+  // Matrix3x4 and Affine3 hold the same transform
+  REQUIRE( affine.toAffine3() == fn::Affine3( m ) );
+  REQUIRE( fn::Matrix3x4( fn::Affine3( m ) ) == affine );
+  REQUIRE( affine.toMatrix4() == m );
+
+  const fn::Matrix3 linear( m );
+  REQUIRE( linear[ 2 ] == m.getZVector() );
+  REQUIRE( linear.toMatrix4()[ 3 ] == fn::Vec4( 0.0f, 0.0f, 0.0f, 1.0f ) );
+
+  // Matrix3 * Matrix3x4 is Matrix3x4, the same as the 4x4 product
+  const fn::Matrix3x4 composed = linear * affine;
+  const fn::Matrix4 expected = linear.toMatrix4() * m;
+  requireClose( composed, fn::Matrix3x4( expected ) );
+}
+
+TEST_CASE( "Matrix2 and Matrix3 inverse and normal matrix", "[def_matrix]" ) {
+  const fn::Matrix3 a( 2.0f, 1.0f, 0.0f, -1.0f, 3.0f, 0.5f, 0.0f, 4.0f, 1.0f );
+  REQUIRE( a.determinant() == Approx( a.toMatrix4().determinant() ) );
+  requireClose( a * a.inversed(), fn::Matrix3() );
+  requireClose( a.inversed(), fn::Matrix3( a.toMatrix4().inversed() ) );
+
+  const fn::Matrix2 b( 3.0f, 1.0f, 2.0f, 4.0f );
+  requireClose( b.inversed() * b, fn::Matrix2() );
+
+  const fn::Matrix3 singular( 0.0f );
+  REQUIRE( singular.inversed() == singular );
+
+  // Normals stay perpendicular to transformed tangents under non uniform scale
+  const fn::Matrix4 m = model();
+  const fn::Matrix3 normal = fn::Math::normalMatrix( m );
+  const fn::Vec3 tangent( 1.0f, 1.0f, 0.0f ), n( 1.0f, -1.0f, 0.0f );
+  REQUIRE( fn::dotProduct( normal * n, m.transformVector( tangent ) ) == Approx( 0.0f ).margin( 1e-5 ) );
+}
+
+TEST_CASE( "tMat packs into std140 and std430 layouts", "[def_matrix]" ) {
+  const fn::Matrix3x4 affine( model() );
+
+  float rows[ 12 ];
+  affine.packRows<fn::GpuLayout::Std140>( rows );
+  REQUIRE( std::memcmp( rows, fn::Affine3( model() ).data(), sizeof( rows ) ) == 0 );
+
+  float cols[ 12 ] = {};
+  const fn::Matrix3 linear( model() );
+  linear.pack<fn::GpuLayout::Std140>( cols );
+  for ( size_t c = 0; c < 3; c++ )
+    for ( unsigned r = 0; r < 3; r++ ) REQUIRE( cols[ c * 4 + r ] == linear[ c ][ r ] );
+  REQUIRE( cols[ 3 ] == 0.0f );
+
+  float mat2[ 8 ] = {};
+  const fn::Matrix2 b( 1.0f, 2.0f, 3.0f, 4.0f );
+  b.pack<fn::GpuLayout::Std430>( mat2 );
+  REQUIRE( std::memcmp( mat2, b.data(), 4 * sizeof( float ) ) == 0 );
+  b.pack<fn::GpuLayout::Std140>( mat2 );
+  REQUIRE( ( mat2[ 0 ] == 1.0f && mat2[ 1 ] == 2.0f && mat2[ 4 ] == 3.0f && mat2[ 5 ] == 4.0f ) );
+}
@@ -0,0 +1,225 @@
+#include <catch2/catch.hpp>
+
+#include "core/job_system.hh"
+#include "ecs/components.hh"
+#include "ecs/scheduler.hh"
+#include "ecs/systems.hh"
+#include "ecs/world.hh"
+#include "math/matrix_transformations.hh"
+
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+  struct Health {
+    int value;
+  };
+
+  struct Velocity {
+    float x, y, z;
+  };
+
+  // Counts live instances, to see that moves between chunks leak nothing
+  struct Tracked {
+    static int live;
+
+    explicit Tracked( int v ) noexcept : value( v ) {
+      live++;
+    }
+    Tracked( Tracked &&other ) noexcept : value( other.value ) {
+      live++;
+    }
+    Tracked &operator=( Tracked &&other ) noexcept {
+      value = other.value;
+      return *this;
+    }
+    ~Tracked() noexcept {
+      live--;
+    }
+
+    int value;
+  };
+
+  int Tracked::live = 0;
+
+}    // namespace
+
+TEST_CASE( "World creates and destroys entities", "[ecs]" ) {
+  fn::ecs::World world;
+
+  fn::ecs::Entity a = world.create( Health{10} );
+  fn::ecs::Entity b = world.create( Health{20}, Velocity{1.0f, 0.0f, 0.0f} );
+  REQUIRE( world.entityCount() == 2 );
+  REQUIRE( world.get<Health>( a )->value == 10 );
+  REQUIRE( world.get<Health>( b )->value == 20 );
+  REQUIRE( world.has<Velocity>( b ) );
+  REQUIRE_FALSE( world.has<Velocity>( a ) );
+  REQUIRE( world.get<Velocity>( a ) == nullptr );
+
+  world.destroy( a );
+  REQUIRE_FALSE( world.isAlive( a ) );
+  REQUIRE( world.get<Health>( a ) == nullptr );
+
+  // The index comes back with a new generation, the old handle stays dead
+  fn::ecs::Entity c = world.create( Health{30} );
+  REQUIRE( c.index == a.index );
+  REQUIRE( c != a );
+  REQUIRE_FALSE( world.isAlive( a ) );
+  REQUIRE( world.get<Health>( c )->value == 30 );
+  REQUIRE( world.entityCount() == 2 );
+}
+
+TEST_CASE( "World moves entities between archetypes", "[ecs]" ) {
+  Tracked::live = 0;
+  {
+    fn::ecs::World world;
+    std::vector<fn::ecs::Entity> entities;
+    for ( int i = 0; i < 2000; i++ ) entities.push_back( world.create( Health{i}, Tracked( i ) ) );
+    REQUIRE( Tracked::live == 2000 );
+
+    // Every third gets a velocity, every fifth loses its health
+    for ( std::size_t i = 0; i < entities.size(); i += 3 ) {
+      world.add( entities[ i ], Velocity{static_cast<float>( i ), 0.0f, 0.0f} );
+    }
+    for ( std::size_t i = 0; i < entities.size(); i += 5 ) world.remove<Health>( entities[ i ] );
+    for ( std::size_t i = 1; i < entities.size(); i += 7 ) world.destroy( entities[ i ] );
+
+    for ( std::size_t i = 0; i < entities.size(); i++ ) {
+      const fn::ecs::Entity e = entities[ i ];
+      if ( i % 7 == 1 ) {
+        REQUIRE_FALSE( world.isAlive( e ) );
+        continue;
+      }
+      REQUIRE( world.get<Tracked>( e )->value == static_cast<int>( i ) );
+      REQUIRE( world.has<Velocity>( e ) == ( i % 3 == 0 ) );
+      REQUIRE( world.has<Health>( e ) == ( i % 5 != 0 ) );
+      if ( i % 5 != 0 ) REQUIRE( world.get<Health>( e )->value == static_cast<int>( i ) );
+    }
+    REQUIRE( Tracked::live == static_cast<int>( world.entityCount() ) );
+
+    // Adding what is already there assigns it
+    world.add( entities[ 0 ], Tracked( -1 ) );
+    REQUIRE( world.get<Tracked>( entities[ 0 ] )->value == -1 );
+    REQUIRE( Tracked::live == static_cast<int>( world.entityCount() ) );
+  }
+  REQUIRE( Tracked::live == 0 );
+}
+
+TEST_CASE( "World queries visit every matching chunk", "[ecs]" ) {
+  fn::ecs::World world;
+  for ( int i = 0; i < 5000; i++ ) world.create( Health{1} );
+  for ( int i = 0; i < 3000; i++ ) world.create( Health{2}, Velocity{} );
+  for ( int i = 0; i < 1000; i++ ) world.create( Velocity{} );
+
+  int sum = 0;
+  world.each<const Health>( [&sum]( const Health &health ) { sum += health.value; } );
+  REQUIRE( sum == 5000 + 6000 );
+
+  // Archetypes created after a query ran join its cache
+  std::size_t count = 0;
+  world.each<Velocity>( [&count]( Velocity & ) { count++; } );
+  REQUIRE( count == 4000 );
+  world.create( Velocity{}, Tracked( 0 ) );
+  count = 0;
+  world.each<Velocity>( [&count]( Velocity & ) { count++; } );
+  REQUIRE( count == 4001 );
+
+  // Bodies may take the entity, chunks hold rows of one archetype only
+  world.each<Health, Velocity>( [&world]( fn::ecs::Entity e, Health &health, Velocity & ) {
+    REQUIRE( world.get<Health>( e ) == &health );
+  } );
+  world.eachChunk<Health>( []( const fn::ecs::ChunkView &chunk ) {
+    REQUIRE( chunk.count() > 0 );
+    REQUIRE( chunk.column<Health>() != nullptr );
+    REQUIRE( reinterpret_cast<std::uintptr_t>( chunk.column<Health>() ) % alignof( Health ) == 0 );
+  } );
+}
+
+TEST_CASE( "World updates 100k transforms in parallel", "[ecs]" ) {
+  fn::JobSystem jobs( 4 );
+  fn::ecs::World world;
+
+  constexpr int COUNT = 100000;
+  std::vector<fn::ecs::Entity> entities;
+  entities.reserve( COUNT );
+  for ( int i = 0; i < COUNT; i++ ) {
+    fn::ecs::LocalTransform local;
+    local.position = fn::Vec3( static_cast<float>( i ), 0.0f, 0.0f );
+    local.scale = fn::Vec3( 2.0f );
+    if ( i % 2 ) {
+      entities.push_back( world.create( local, fn::ecs::WorldTransform{}, fn::ecs::Renderable{} ) );
+    } else {
+      entities.push_back( world.create( local, fn::ecs::WorldTransform{} ) );
+    }
+  }
+
+  fn::ecs::updateTransforms( world, jobs );
+  for ( int i = 0; i < COUNT; i += 997 ) {
+    const fn::Affine3 &m = world.get<fn::ecs::WorldTransform>( entities[ static_cast<std::size_t>( i ) ] )->matrix;
+    REQUIRE( m.translation() == fn::Vec3( static_cast<float>( i ), 0.0f, 0.0f ) );
+    REQUIRE( m[ 0 ].x == 2.0f );
+  }
+
+  std::vector<glm::mat4> transforms;
+  REQUIRE( fn::ecs::gatherRenderables( world, nullptr, transforms ) == 0 );
+  REQUIRE( transforms.size() == COUNT / 2 );
+}
+
+TEST_CASE( "World bounds cull renderables", "[ecs]" ) {
+  fn::JobSystem jobs( 4 );
+  fn::ecs::World world;
+  fn::ecs::SystemScheduler systems;
+  fn::ecs::addTransformSystems( systems );
+
+  // A row of small boxes along x, the camera sees x in [ -10, 10 ]
+  for ( int i = -50; i <= 50; i++ ) {
+    fn::ecs::LocalTransform local;
+    local.position = fn::Vec3( static_cast<float>( i ), 0.0f, -5.0f );
+    world.create( local, fn::ecs::WorldTransform{}, fn::ecs::Renderable{},
+                  fn::ecs::LocalBounds{fn::AABB( fn::Vec3( -0.25f ), fn::Vec3( 0.25f ) )}, fn::ecs::WorldBounds{} );
+  }
+  // Without bounds, never culled
+  world.create( fn::ecs::LocalTransform{}, fn::ecs::WorldTransform{}, fn::ecs::Renderable{} );
+
+  systems.run( world, jobs );
+
+  const fn::Frustum frustum( fn::Math::ortho( -10.0f, 10.0f, -10.0f, 10.0f, 0.1f, 100.0f ) );
+  std::vector<glm::mat4> transforms;
+  const std::size_t culled = fn::ecs::gatherRenderables( world, &frustum, transforms );
+  REQUIRE( transforms.size() == 21 + 1 );
+  REQUIRE( culled == 80 );
+}
+
+TEST_CASE( "SystemScheduler runs non conflicting systems together", "[ecs]" ) {
+  fn::JobSystem jobs( 4 );
+  fn::ecs::World world;
+  for ( int i = 0; i < 10000; i++ ) world.create( Health{0}, Velocity{}, fn::ecs::LocalTransform{} );
+
+  using fn::ecs::componentMask;
+  fn::ecs::SystemScheduler systems;
+  systems.add( "health", 0, componentMask<Health>(), []( fn::ecs::World &w, fn::JobSystem &j ) {
+    w.parallelEach<Health>( j, []( Health &health ) { health.value += 1; } );
+  } );
+  systems.add( "velocity", 0, componentMask<Velocity>(), []( fn::ecs::World &w, fn::JobSystem &j ) {
+    w.parallelEach<Velocity>( j, []( Velocity &velocity ) { velocity.x += 1.0f; } );
+  } );
+  // Writes what the first one writes and reads what the second one writes, so it runs after both
+  systems.add( "double", componentMask<Velocity>(), componentMask<Health>(), []( fn::ecs::World &w, fn::JobSystem & ) {
+    w.each<const Velocity, Health>( []( const Velocity &velocity, Health &health ) {
+      health.value *= static_cast<int>( velocity.x ) + 1;
+    } );
+  } );
+  // Touches neither
+  systems.add( "transforms", componentMask<fn::ecs::LocalTransform>(), componentMask<fn::ecs::WorldTransform>(),
+               fn::ecs::updateTransforms );
+
+  REQUIRE( systems.phaseCount() == 2 );
+  REQUIRE( systems.phaseOf( 0 ) == 0 );
+  REQUIRE( systems.phaseOf( 1 ) == 0 );
+  REQUIRE( systems.phaseOf( 2 ) == 1 );
+  REQUIRE( systems.phaseOf( 3 ) == 0 );
+
+  systems.run( world, jobs );
+  world.each<const Health>( []( const Health &health ) { REQUIRE( health.value == 2 ); } );
+}
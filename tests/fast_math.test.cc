@@ -0,0 +1,137 @@
+#include <catch2/catch.hpp>
+
+#include "math/batch.hh"
+#include "math/math_utils.hh"
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace {
+
+  // Error bounds documented in math_utils.hh
+  constexpr double TRIG_ERROR = 4e-7;
+  constexpr double ATAN_ERROR = 4e-7;
+  constexpr double ACOS_ERROR = 5e-7;
+  constexpr double RSQRT_ERROR = 4e-7;
+
+  // Odd count so the 8-wide, 4-wide and scalar tail loops all run
+  constexpr size_t COUNT = 1037;
+
+  std::vector<float> uniform( std::mt19937 &rng, float lo, float hi, size_t n = COUNT ) {
+    std::uniform_real_distribution<float> dist( lo, hi );
+    std::vector<float> v( n );
+    for ( float &x : v ) x = dist( rng );
+    return v;
+  }
+
+  double error( float value, double expected ) {
+    return std::fabs( static_cast<double>( value ) - expected );
+  }
+
+}    // namespace
+
+TEST_CASE( "Fast sin and cos stay within the documented error", "[fast_math]" ) {
+  double worst = 0.0;
+  size_t mismatches = 0;
+  for ( int i = -200000; i <= 200000; i++ ) {
+    const float x = static_cast<float>( i ) * 5e-4f;
+    const double xd = static_cast<double>( x );
+    float s, c;
+    fn::Math::fastSinCos( x, s, c );
+    worst = std::fmax( worst, error( s, std::sin( xd ) ) );
+    worst = std::fmax( worst, error( c, std::cos( xd ) ) );
+    mismatches += s != fn::Math::fastSin( x ) || c != fn::Math::fastCos( x );
+  }
+  REQUIRE( worst <= TRIG_ERROR );
+  REQUIRE( mismatches == 0 );
+}
+
+TEST_CASE( "Fast atan2 and acos stay within the documented error", "[fast_math]" ) {
+  std::mt19937 rng( 3 );
+  const std::vector<float> y = uniform( rng, -10.0f, 10.0f, 100000 );
+  const std::vector<float> x = uniform( rng, -10.0f, 10.0f, 100000 );
+
+  double worst = 0.0;
+  for ( size_t i = 0; i < y.size(); i++ ) {
+    const double expected = std::atan2( static_cast<double>( y[ i ] ), static_cast<double>( x[ i ] ) );
+    worst = std::fmax( worst, error( fn::Math::fastAtan2( y[ i ], x[ i ] ), expected ) );
+  }
+  REQUIRE( worst <= ATAN_ERROR );
+
+  // Axes and quadrant boundaries
+  REQUIRE( fn::Math::fastAtan2( 0.0f, 0.0f ) == 0.0f );
+  REQUIRE( error( fn::Math::fastAtan2( 1.0f, 0.0f ), std::atan2( 1.0, 0.0 ) ) <= ATAN_ERROR );
+  REQUIRE( error( fn::Math::fastAtan2( -1.0f, 0.0f ), std::atan2( -1.0, 0.0 ) ) <= ATAN_ERROR );
+  REQUIRE( error( fn::Math::fastAtan2( 0.0f, -1.0f ), std::atan2( 0.0, -1.0 ) ) <= ATAN_ERROR );
+  REQUIRE( error( fn::Math::fastAtan2( 2.0f, 2.0f ), std::atan2( 2.0, 2.0 ) ) <= ATAN_ERROR );
+
+  worst = 0.0;
+  for ( int i = -100000; i <= 100000; i++ ) {
+    const float v = static_cast<float>( i ) * 1e-5f;
+    worst = std::fmax( worst, error( fn::Math::fastAcos( v ), std::acos( static_cast<double>( v ) ) ) );
+  }
+  REQUIRE( worst <= ACOS_ERROR );
+}
+
+TEST_CASE( "Fast rsqrt stays within the documented relative error", "[fast_math]" ) {
+  double worst = 0.0;
+  for ( float x = 1e-6f; x < 1e6f; x *= 1.001f ) {
+    const double expected = 1.0 / std::sqrt( static_cast<double>( x ) );
+    worst = std::fmax( worst, error( fn::Math::fastRsqrt( x ), expected ) / expected );
+  }
+  REQUIRE( worst <= RSQRT_ERROR );
+}
+
+TEST_CASE( "Precision pins the implementation per call site", "[fast_math]" ) {
+  using fn::Math::Precision;
+  const float x = 0.7f;
+  REQUIRE( fn::Math::sin<Precision::Precise>( x ) == std::sin( x ) );
+  REQUIRE( fn::Math::sin<Precision::Fast>( x ) == fn::Math::fastSin( x ) );
+  REQUIRE( fn::Math::acos<Precision::Fast>( x ) == fn::Math::fastAcos( x ) );
+  REQUIRE( fn::Math::rsqrt<Precision::Precise>( x ) == 1.0f / std::sqrt( x ) );
+  REQUIRE( fn::Math::sin( x ) == fn::Math::sin<fn::Math::DEFAULT_PRECISION>( x ) );
+
+  fn::Vec3 v( 3.0f, 0.0f, 4.0f );
+  v.normalize();
+  REQUIRE( error( v.x, 0.6 ) <= 1e-6 );
+  REQUIRE( error( v.z, 0.8 ) <= 1e-6 );
+}
+
+TEST_CASE( "Batched fast math matches the scalar versions", "[fast_math][batch]" ) {
+  std::mt19937 rng( 11 );
+  const std::vector<float> angles = uniform( rng, -50.0f, 50.0f );
+  const std::vector<float> y = uniform( rng, -5.0f, 5.0f );
+  const std::vector<float> x = uniform( rng, -5.0f, 5.0f );
+  const std::vector<float> unit = uniform( rng, -1.0f, 1.0f );
+  const std::vector<float> positive = uniform( rng, 1e-3f, 1e3f );
+  std::vector<float> s( COUNT ), c( COUNT ), out( COUNT );
+
+  // SIMD lanes may differ from the scalar code by a rounding step when FMA is used
+  constexpr double LANE_ERROR = 1e-6;
+
+  fn::Math::sinCosBatch( angles.data(), s.data(), c.data(), COUNT );
+  for ( size_t i = 0; i < COUNT; i++ ) {
+    REQUIRE( error( s[ i ], static_cast<double>( fn::Math::fastSin( angles[ i ] ) ) ) <= LANE_ERROR );
+    REQUIRE( error( c[ i ], static_cast<double>( fn::Math::fastCos( angles[ i ] ) ) ) <= LANE_ERROR );
+  }
+
+  fn::Math::atan2Batch( y.data(), x.data(), out.data(), COUNT );
+  for ( size_t i = 0; i < COUNT; i++ )
+    REQUIRE( error( out[ i ], static_cast<double>( fn::Math::fastAtan2( y[ i ], x[ i ] ) ) ) <= LANE_ERROR );
+
+  fn::Math::acosBatch( unit.data(), out.data(), COUNT );
+  for ( size_t i = 0; i < COUNT; i++ )
+    REQUIRE( error( out[ i ], static_cast<double>( fn::Math::fastAcos( unit[ i ] ) ) ) <= LANE_ERROR );
+
+  fn::Math::rsqrtBatch( positive.data(), out.data(), COUNT );
+  for ( size_t i = 0; i < COUNT; i++ ) {
+    const double expected = static_cast<double>( fn::Math::fastRsqrt( positive[ i ] ) );
+    REQUIRE( error( out[ i ], expected ) <= LANE_ERROR * expected );
+  }
+
+  // In place
+  std::vector<float> inplace = angles;
+  fn::Math::sinCosBatch( inplace.data(), inplace.data(), c.data(), COUNT );
+  REQUIRE( inplace == s );
+}
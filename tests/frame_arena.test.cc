@@ -0,0 +1,89 @@
+#include <catch2/catch.hpp>
+
+#include "core/frame_arena.hh"
+
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+  bool aligned( const void *p, std::size_t alignment ) {
+    return reinterpret_cast<std::uintptr_t>( p ) % alignment == 0;
+  }
+
+}    // namespace
+
+TEST_CASE( "FrameArena bumps and resets", "[frame_arena]" ) {
+  fn::FrameArena arena( 1024 );
+  REQUIRE( arena.capacity() == 1024 );
+
+  char *a = arena.allocateArray<char>( 3 );
+  double *b = arena.allocateArray<double>( 4 );
+  void *c = arena.allocate( 64, 64 );
+  REQUIRE( aligned( b, alignof( double ) ) );
+  REQUIRE( aligned( c, 64 ) );
+  REQUIRE( reinterpret_cast<char *>( b ) > a );
+  REQUIRE( arena.used() >= 3 + 4 * sizeof( double ) + 64 );
+
+  // Everything comes back at once, the next frame starts at the same place
+  const std::size_t used = arena.used();
+  arena.reset();
+  REQUIRE( arena.used() == 0 );
+  REQUIRE( arena.highWaterMark() == used );
+  REQUIRE( arena.allocateArray<char>( 1 ) == a );
+  REQUIRE( arena.overflowCount() == 0 );
+}
+
+TEST_CASE( "FrameArena spills and grows to the high water mark", "[frame_arena]" ) {
+  fn::FrameArena arena( 256 );
+
+  // Three times the capacity, in pieces larger than the leftovers
+  std::vector<int *> pieces;
+  for ( int i = 0; i < 12; i++ ) {
+    int *piece = arena.allocateArray<int>( 16 );
+    for ( int j = 0; j < 16; j++ ) piece[ j ] = i;
+    pieces.push_back( piece );
+  }
+  for ( int i = 0; i < 12; i++ ) REQUIRE( pieces[ static_cast<std::size_t>( i ) ][ 15 ] == i );
+  REQUIRE( arena.overflowCount() == 1 );
+
+  arena.reset();
+  REQUIRE( arena.capacity() >= 12 * 16 * sizeof( int ) );
+
+  // The same frame now fits
+  for ( int i = 0; i < 12; i++ ) ( void )arena.allocateArray<int>( 16 );
+  arena.reset();
+  REQUIRE( arena.overflowCount() == 1 );
+}
+
+TEST_CASE( "FrameArena backs pmr containers", "[frame_arena]" ) {
+  alignas( std::max_align_t ) unsigned char stack[ 512 ];
+  fn::FrameArena arena( stack, sizeof( stack ) );
+
+  std::pmr::vector<int> numbers( &arena );
+  for ( int i = 0; i < 32; i++ ) numbers.push_back( i );
+  std::pmr::string text( "transient data of this frame", &arena );
+
+  REQUIRE( numbers[ 31 ] == 31 );
+  REQUIRE( text.size() == 28 );
+  REQUIRE( static_cast<const void *>( numbers.data() ) >= stack );
+  REQUIRE( static_cast<const void *>( numbers.data() ) < stack + sizeof( stack ) );
+
+  // Growing a vector leaves its old storage behind, the arena keeps it all
+  REQUIRE( arena.used() > 32 * sizeof( int ) );
+  REQUIRE( arena.overflowCount() == 0 );
+  REQUIRE( arena.is_equal( arena ) );
+}
+
+TEST_CASE( "FrameArena poisons memory in debug builds", "[frame_arena]" ) {
+  if ( !fn::FrameArena::poisoning() ) return;
+
+  fn::FrameArena arena( 128 );
+  auto *bytes = arena.allocateArray<uint8_t>( 16 );
+  REQUIRE( bytes[ 0 ] == fn::FrameArena::ALLOCATED_BYTE );
+  REQUIRE( bytes[ 15 ] == fn::FrameArena::ALLOCATED_BYTE );
+
+  bytes[ 0 ] = 1;
+  arena.reset();
+  REQUIRE( bytes[ 0 ] == fn::FrameArena::RELEASED_BYTE );
+}
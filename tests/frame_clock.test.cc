@@ -0,0 +1,72 @@
+#include <catch2/catch.hpp>
+
+#include "core/frame_clock.hh"
+
+#include <chrono>
+
+namespace {
+
+  using namespace std::chrono_literals;
+
+  unsigned runSteps( fn::FrameClock &clock, fn::FrameClock::duration elapsed ) {
+    clock.beginFrame( elapsed );
+    unsigned steps = 0;
+    while ( clock.step() ) steps++;
+    return steps;
+  }
+
+}    // namespace
+
+TEST_CASE( "FrameClock consumes frame time in fixed steps", "[frame_clock]" ) {
+  fn::FrameClock clock( 0.01 );
+
+  // 25ms frames at a 10ms step: 2, 3, 2, 3 steps and the phase carries over
+  REQUIRE( runSteps( clock, 25ms ) == 2 );
+  REQUIRE( clock.alpha() == Approx( 0.5 ) );
+  REQUIRE( runSteps( clock, 25ms ) == 3 );
+  REQUIRE( clock.alpha() == Approx( 0.0 ).margin( 1e-9 ) );
+  REQUIRE( runSteps( clock, 25ms ) == 2 );
+  REQUIRE( runSteps( clock, 25ms ) == 3 );
+
+  REQUIRE( clock.simulationTime() == Approx( 0.1 ) );
+  REQUIRE( clock.frameIndex() == 4 );
+
+  // Frames shorter than a step only move alpha
+  REQUIRE( runSteps( clock, 4ms ) == 0 );
+  REQUIRE( clock.alpha() == Approx( 0.4 ) );
+  REQUIRE( runSteps( clock, 4ms ) == 0 );
+  REQUIRE( clock.alpha() == Approx( 0.8 ) );
+  REQUIRE( runSteps( clock, 4ms ) == 1 );
+}
+
+TEST_CASE( "FrameClock clamps long frames", "[frame_clock]" ) {
+  fn::FrameClock clock( 0.01 );
+  clock.setMaxFrameTime( 0.1 );
+  clock.setMaxSteps( 5 );
+
+  // A 2s stall is clamped to 100ms, of which only 5 steps run
+  REQUIRE( runSteps( clock, 2s ) == 5 );
+  REQUIRE( clock.frameTime() == Approx( 2.0 ) );
+  REQUIRE( clock.droppedTime() == Approx( 1.95 ) );
+  REQUIRE( clock.alpha() < 1.0 );
+
+  // The next frame is back to normal
+  REQUIRE( runSteps( clock, 10ms ) == 1 );
+}
+
+TEST_CASE( "FrameClock caps the frame rate", "[frame_clock]" ) {
+  fn::FrameClock clock;
+  clock.setTargetFrameRate( 200.0 );
+
+  const auto start = fn::FrameClock::clock::now();
+  clock.reset();
+  for ( int i = 0; i < 4; i++ ) {
+    clock.beginFrame();
+    clock.endFrame();
+  }
+  const auto elapsed = fn::FrameClock::clock::now() - start;
+
+  // Every frame is held to at least 5ms
+  REQUIRE( elapsed >= 15ms );
+  REQUIRE( clock.frameTime() >= 0.005 - 1e-9 );
+}
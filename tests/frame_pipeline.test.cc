@@ -0,0 +1,101 @@
+#include <catch2/catch.hpp>
+
+#include "core/frame_pipeline.hh"
+#include "core/frame_state.hh"
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+TEST_CASE( "FramePipeline hands frames over in order", "[frame_pipeline]" ) {
+  fn::FramePipeline<int> pipeline;
+
+  // Both slots can be filled before anything is read
+  *pipeline.beginWrite() = 1;
+  pipeline.endWrite();
+  *pipeline.beginWrite() = 2;
+  pipeline.endWrite();
+  REQUIRE( pipeline.written() == 2 );
+
+  REQUIRE( *pipeline.beginRead() == 1 );
+  pipeline.endRead();
+
+  // The released slot is the next one written
+  *pipeline.beginWrite() = 3;
+  pipeline.endWrite();
+
+  REQUIRE( *pipeline.beginRead() == 2 );
+  pipeline.endRead();
+
+  // Closing still drains what was published
+  pipeline.close();
+  REQUIRE( pipeline.beginWrite() == nullptr );
+  REQUIRE( *pipeline.beginRead() == 3 );
+  pipeline.endRead();
+  REQUIRE( pipeline.beginRead() == nullptr );
+  REQUIRE( pipeline.read() == 3 );
+
+  pipeline.reset();
+  REQUIRE( pipeline.beginWrite() != nullptr );
+}
+
+TEST_CASE( "FramePipeline between two threads", "[frame_pipeline]" ) {
+  fn::FramePipeline<fn::FrameState, 3> pipeline;
+  constexpr uint64_t FRAMES = 2000;
+
+  std::vector<uint64_t> seen;
+  uint64_t maxAhead = 0;
+  bool intact = true;
+
+  std::thread renderer( [&] {
+    while ( const fn::FrameState *frame = pipeline.beginRead() ) {
+      seen.push_back( frame->frameIndex );
+      maxAhead = std::max( maxAhead, pipeline.written() - pipeline.read() );
+
+      // A frame is never written while it is read
+      for ( const glm::mat4 &m : frame->transforms ) {
+        intact = intact && m[ 3 ][ 0 ] == static_cast<float>( frame->frameIndex );
+      }
+      pipeline.endRead();
+    }
+  } );
+
+  for ( uint64_t i = 0; i < FRAMES; i++ ) {
+    fn::FrameState *frame = pipeline.beginWrite();
+    frame->frameIndex = i;
+    frame->transforms.assign( 16, glm::mat4( 1.0f ) );
+    for ( glm::mat4 &m : frame->transforms ) m[ 3 ][ 0 ] = static_cast<float>( i );
+    pipeline.endWrite();
+  }
+  pipeline.close();
+  renderer.join();
+
+  REQUIRE( seen.size() == FRAMES );
+  for ( uint64_t i = 0; i < FRAMES; i++ ) REQUIRE( seen[ i ] == i );
+  REQUIRE( maxAhead <= pipeline.slotCount() );
+  REQUIRE( intact );
+}
+
+TEST_CASE( "InputSnapshot key lookup", "[frame_pipeline]" ) {
+  fn::InputSnapshot input;
+  input.heldKeys = {87, 65};
+  REQUIRE( input.isKeyHeld( 65 ) );
+  REQUIRE_FALSE( input.isKeyHeld( 83 ) );
+}
+
+TEST_CASE( "FrameState interpolates the camera by alpha", "[frame_pipeline]" ) {
+  fn::FrameState frame;
+  frame.previousCamera.position = glm::vec3( 0.0f, 0.0f, 3.0f );
+  frame.camera.position = glm::vec3( 2.0f, 0.0f, 3.0f );
+
+  const auto viewFrom = []( const glm::vec3 &position ) {
+    return glm::lookAt( position, position + glm::vec3( 0.0f, 0.0f, -1.0f ), glm::vec3( 0.0f, 1.0f, 0.0f ) );
+  };
+
+  frame.alpha = 0.0f;
+  REQUIRE( frame.view() == viewFrom( frame.previousCamera.position ) );
+
+  // A quarter of the way through the step, a quarter of the way along
+  frame.alpha = 0.25f;
+  REQUIRE( frame.view() == viewFrom( glm::vec3( 0.5f, 0.0f, 3.0f ) ) );
+}
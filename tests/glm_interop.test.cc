@@ -0,0 +1,114 @@
+#include <catch2/catch.hpp>
+
+#include "math/glm_interop.hh"
+#include "math/aligned.hh"
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+namespace {
+
+  glm::mat4 sampleModel( float i ) {
+    glm::mat4 m = glm::translate( glm::mat4( 1.0f ), glm::vec3( i, -2.0f * i, 0.5f ) );
+    m = glm::rotate( m, 0.1f * i, glm::vec3( 0.0f, 0.6f, 0.8f ) );
+    return glm::scale( m, glm::vec3( 1.0f + 0.01f * i ) );
+  }
+
+  void requireSame( const glm::mat4 &a, const glm::mat4 &b, float eps = 1e-4f ) {
+    for ( int c = 0; c < 4; c++ )
+      for ( int r = 0; r < 4; r++ ) REQUIRE( a[ c ][ r ] == Approx( b[ c ][ r ] ).margin( eps ) );
+  }
+
+}    // namespace
+
+TEST_CASE( "Matrix4 and glm::mat4 share one memory layout", "[glm]" ) {
+  const fn::Matrix4 m( 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f,
+                       9.0f, 10.0f, 11.0f, 12.0f, 13.0f, 14.0f, 15.0f, 16.0f );
+  const glm::mat4 &view = fn::Math::asGlm( m );
+
+  REQUIRE( static_cast<const void *>( &view ) == static_cast<const void *>( &m ) );
+  for ( int c = 0; c < 4; c++ )
+    for ( int r = 0; r < 4; r++ ) REQUIRE( view[ c ][ r ] == m[ c ][ r ] );
+
+  // Conversions are plain copies of the same bytes, both ways
+  const glm::mat4 converted( m );
+  REQUIRE( std::memcmp( &converted, &m, sizeof( m ) ) == 0 );
+  REQUIRE( fn::Matrix4( converted ) == m );
+
+  fn::Vec4 v( 1.0f, 2.0f, 3.0f, 4.0f );
+  fn::Math::asGlm( v ).z = 9.0f;
+  REQUIRE( v.z == 9.0f );
+  glm::vec3 g( 1.0f, 2.0f, 3.0f );
+  REQUIRE( fn::Math::asVec3( g ) == fn::Vec3( 1.0f, 2.0f, 3.0f ) );
+}
+
+TEST_CASE( "Aligned glm arrays are viewed as Matrix4 arrays", "[glm]" ) {
+  fn::AlignedVector<glm::mat4, 16> models( 5 );
+  for ( size_t i = 0; i < models.size(); i++ ) models[ i ] = sampleModel( static_cast<float>( i ) );
+
+  REQUIRE( fn::Math::isMatrix4Aligned( models.data() ) );
+  const fn::Matrix4 *view = fn::Math::asMatrix4( models.data() );
+  REQUIRE( view[ 3 ][ 3 ][ 0 ] == models[ 3 ][ 3 ][ 0 ] );
+  requireSame( models[ 2 ] * models[ 4 ], fn::Math::asGlm( view[ 2 ] * view[ 4 ] ) );
+}
+
+TEST_CASE( "Batch operations take glm arrays at any alignment", "[glm]" ) {
+  // 150 crosses the 64 matrix staging chunks, the offset breaks 16 byte alignment
+  constexpr size_t count = 150;
+  struct Unaligned {
+    float pad;
+    glm::mat4 m[ 2 * count ];
+  };
+  static_assert( offsetof( Unaligned, m ) % 16 != 0 );
+  const std::unique_ptr<Unaligned> storage( new Unaligned() );
+  glm::mat4 *lhs = storage->m;
+  glm::mat4 *rhs = lhs + count;
+  REQUIRE_FALSE( fn::Math::isMatrix4Aligned( lhs ) );
+
+  for ( size_t i = 0; i < count; i++ ) {
+    lhs[ i ] = sampleModel( static_cast<float>( i ) );
+    rhs[ i ] = sampleModel( 0.5f * static_cast<float>( i ) );
+  }
+  lhs[ 70 ] = glm::mat4( 0.0f );
+
+  std::vector<glm::mat4> product( count ), inverse( count ), affine( count );
+  bool singular[ count ] = {};
+  fn::Math::multiply( lhs, rhs, product.data(), count );
+  REQUIRE( fn::Math::inverseBatch( lhs, inverse.data(), count, singular ) == 1 );
+  REQUIRE( fn::Math::inverseAffineBatch( lhs, affine.data(), count ) == 1 );
+
+  for ( size_t i = 0; i < count; i++ ) {
+    requireSame( product[ i ], lhs[ i ] * rhs[ i ] );
+    REQUIRE( singular[ i ] == ( i == 70 ) );
+    if ( i == 70 ) {
+      requireSame( inverse[ i ], lhs[ i ] );
+      continue;
+    }
+    requireSame( inverse[ i ], glm::inverse( lhs[ i ] ) );
+    requireSame( affine[ i ], glm::inverse( lhs[ i ] ) );
+  }
+}
+
+TEST_CASE( "Streams are transformed by a glm::mat4", "[glm]" ) {
+  const glm::mat4 m = sampleModel( 3.0f );
+  float x[] = { 1.0f, 0.0f, -2.0f }, y[] = { 0.0f, 1.0f, 4.0f }, z[] = { 0.0f, 2.0f, 0.5f };
+  float px[ 3 ], py[ 3 ], pz[ 3 ], vx[ 3 ], vy[ 3 ], vz[ 3 ];
+
+  fn::Math::transformPoints( m, { x, y, z }, { px, py, pz }, 3 );
+  fn::Math::transformVectors( m, { x, y, z }, { vx, vy, vz }, 3 );
+
+  for ( int i = 0; i < 3; i++ ) {
+    const glm::vec4 p = m * glm::vec4( x[ i ], y[ i ], z[ i ], 1.0f );
+    const glm::vec4 v = m * glm::vec4( x[ i ], y[ i ], z[ i ], 0.0f );
+    REQUIRE( px[ i ] == Approx( p.x ) );
+    REQUIRE( py[ i ] == Approx( p.y ) );
+    REQUIRE( pz[ i ] == Approx( p.z ) );
+    REQUIRE( vx[ i ] == Approx( v.x ).margin( 1e-6 ) );
+    REQUIRE( vy[ i ] == Approx( v.y ).margin( 1e-6 ) );
+    REQUIRE( vz[ i ] == Approx( v.z ).margin( 1e-6 ) );
+  }
+}
@@ -0,0 +1,84 @@
+#include <catch2/catch.hpp>
+
+#include "renderer/gpu_layout.hh"
+
+#include <cstring>
+#include <vector>
+
+namespace {
+
+  using fn::GpuLayout;
+  using fn::GpuStruct;
+
+  // Offsets below are the ones glslang reports for the same GLSL blocks
+  enum LightField { LightPosition, LightRange, LightColor, LightIntensity };
+  using Light140 = GpuStruct<GpuLayout::Std140, fn::Vec3, float, glm::vec3, float>;
+  static_assert( Light140::hasOffsets<0, 12, 16, 28>() && Light140::size == 32, "vec3 + float share a vec4" );
+
+  using Scalars140 = GpuStruct<GpuLayout::Std140, float, float[ 3 ], fn::Vec2, fn::Matrix3>;
+  using Scalars430 = GpuStruct<GpuLayout::Std430, float, float[ 3 ], fn::Vec2, fn::Matrix3>;
+  static_assert( Scalars140::hasOffsets<0, 16, 64, 80>() && Scalars140::size == 128, "std140 pads arrays to vec4" );
+  static_assert( Scalars430::hasOffsets<0, 4, 16, 32>() && Scalars430::size == 80, "std430 packs scalar arrays" );
+
+  using Mat2s = GpuStruct<GpuLayout::Std430, fn::Matrix2, float>;
+  static_assert( Mat2s::hasOffsets<0, 16>() && Mat2s::alignment == 8 && Mat2s::size == 24, "std430 mat2" );
+
+  // A block nested in another one, and an array of them
+  enum SceneField { SceneViewProj, SceneLightCount, SceneLights };
+  using Scene = GpuStruct<GpuLayout::Std140, glm::mat4, std::uint32_t, Light140[ 4 ]>;
+  static_assert( Scene::hasOffsets<0, 64, 80>() && Scene::size == 80 + 4 * 32, "nested blocks" );
+
+  // 48 byte model transforms, read by the shader as mat3x4
+  using Bones = GpuStruct<GpuLayout::Std430, fn::Affine3[ 64 ]>;
+  static_assert( Bones::size == 64 * 48, "Affine3 packs into three vec4" );
+
+  float floatAt( const std::vector<unsigned char> &memory, std::size_t offset ) {
+    float value;
+    std::memcpy( &value, memory.data() + offset, sizeof( value ) );
+    return value;
+  }
+
+}    // namespace
+
+TEST_CASE( "GpuStruct writes fields at their std140 offsets", "[gpu_layout]" ) {
+  std::vector<unsigned char> memory( Scene::size, 0xff );
+
+  glm::mat4 viewProj( 1.0f );
+  viewProj[ 3 ] = glm::vec4( 1.0f, 2.0f, 3.0f, 1.0f );
+  Scene::write<SceneViewProj>( memory.data(), viewProj );
+  Scene::write<SceneLightCount>( memory.data(), std::uint32_t( 2 ) );
+  REQUIRE( std::memcmp( memory.data(), &viewProj, 64 ) == 0 );
+
+  for ( std::size_t i = 0; i < 2; i++ ) {
+    void *light = static_cast<unsigned char *>( Scene::field<SceneLights>( memory.data() ) ) + i * Light140::size;
+    Light140::write<LightPosition>( light, fn::Vec3( 1.0f, 2.0f, 3.0f ) );
+    Light140::write<LightRange>( light, 10.0f + static_cast<float>( i ) );
+    Light140::write<LightColor>( light, glm::vec3( 0.5f ) );
+    Light140::write<LightIntensity>( light, 4.0f );
+  }
+
+  REQUIRE( floatAt( memory, 80 + 8 ) == 3.0f );
+  REQUIRE( floatAt( memory, 80 + 12 ) == 10.0f );
+  REQUIRE( floatAt( memory, 80 + 32 + 12 ) == 11.0f );
+  REQUIRE( floatAt( memory, 80 + 32 + 28 ) == 4.0f );
+
+  // Padding is not written
+  REQUIRE( memory[ 68 ] == 0xff );
+}
+
+TEST_CASE( "GpuStruct pads matrix columns and array elements", "[gpu_layout]" ) {
+  std::vector<unsigned char> memory( Scalars140::size, 0 );
+  const fn::Matrix3 m( 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f );
+
+  Scalars140::write<1>( memory.data(), 2, 5.0f );
+  Scalars140::write<3>( memory.data(), m );
+  REQUIRE( floatAt( memory, 16 + 2 * 16 ) == 5.0f );
+  for ( std::size_t c = 0; c < 3; c++ )
+    for ( std::size_t r = 0; r < 3; r++ )
+      REQUIRE( floatAt( memory, 80 + c * 16 + r * 4 ) == m[ c ][ static_cast<unsigned>( r ) ] );
+
+  std::vector<unsigned char> bones( Bones::size, 0 );
+  const fn::Affine3 bone = fn::Affine3::fromTranslation( fn::Vec3( 1.0f, 2.0f, 3.0f ) );
+  Bones::write<0>( bones.data(), 5, bone );
+  REQUIRE( std::memcmp( bones.data() + 5 * 48, bone.data(), 48 ) == 0 );
+}
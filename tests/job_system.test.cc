@@ -0,0 +1,91 @@
+#include <catch2/catch.hpp>
+
+#include "core/job_system.hh"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+TEST_CASE( "parallelFor visits every index once", "[job_system]" ) {
+  for ( uint32_t threads : {1u, 2u, 4u} ) {
+    fn::JobSystem jobs( threads );
+    REQUIRE( jobs.threadCount() == threads );
+    REQUIRE( jobs.currentThread() == 0 );
+
+    std::vector<int> hits( 100003, 0 );
+    jobs.parallelFor( hits.size(), 64, [&hits]( std::size_t i ) { hits[ i ]++; } );
+    REQUIRE( std::all_of( hits.begin(), hits.end(), []( int h ) { return h == 1; } ) );
+
+    // Range bodies see disjoint pieces of at most `grain` elements
+    std::atomic<std::size_t> covered{0};
+    std::atomic<std::size_t> largest{0};
+    jobs.parallelFor( 10000, 100, [&]( std::size_t begin, std::size_t end ) {
+      covered += end - begin;
+      std::size_t seen = largest.load();
+      while ( end - begin > seen && !largest.compare_exchange_weak( seen, end - begin ) ) {
+      }
+    } );
+    REQUIRE( covered == 10000 );
+    REQUIRE( largest <= 100 );
+  }
+}
+
+TEST_CASE( "Jobs run on several threads and nest", "[job_system]" ) {
+  fn::JobSystem jobs( 4 );
+
+  // Outer jobs schedule inner ones on their own worker and wait for them
+  std::atomic<int> sum{0};
+  fn::JobCounter outer;
+  for ( int i = 0; i < 64; i++ ) {
+    jobs.schedule( outer, [&jobs, &sum, i] {
+      fn::JobCounter inner;
+      for ( int j = 0; j < 16; j++ ) jobs.schedule( inner, [&sum, i] { sum += i; } );
+      jobs.wait( inner );
+    } );
+  }
+  jobs.wait( outer );
+  REQUIRE( outer.done() );
+  REQUIRE( sum == 16 * ( 63 * 64 / 2 ) );
+
+  // Blocking jobs force the work to spread over the workers
+  std::vector<std::atomic<int>> perThread( jobs.threadCount() + 1 );
+  std::atomic<int> started{0};
+  fn::JobCounter spread;
+  jobs.parallelFor( spread, 4, 1, [&]( std::size_t ) {
+    perThread[ jobs.currentThread() ]++;
+    started++;
+    while ( started < 2 ) std::this_thread::yield();
+  } );
+  jobs.wait( spread );
+
+  int busyThreads = 0;
+  for ( auto &count : perThread ) busyThreads += count > 0;
+  REQUIRE( busyThreads >= 2 );
+  REQUIRE( perThread[ jobs.threadCount() ] == 0 );
+}
+
+TEST_CASE( "More jobs than a worker can queue", "[job_system]" ) {
+  fn::JobSystem jobs( 2 );
+  std::atomic<int> count{0};
+  fn::JobCounter counter;
+
+  // Past the queue capacity jobs run inline on the scheduling thread
+  for ( int i = 0; i < 20000; i++ ) jobs.schedule( counter, [&count] { count++; } );
+  jobs.wait( counter );
+  REQUIRE( count == 20000 );
+
+  // Foreign threads run their jobs inline too
+  uint32_t foreignIndex = 0;
+  bool ranInline = false;
+  std::thread foreign( [&] {
+    foreignIndex = jobs.currentThread();
+    fn::JobCounter local;
+    jobs.schedule( local, [&count] { count++; } );
+    ranInline = local.done();
+  } );
+  foreign.join();
+  REQUIRE( foreignIndex == jobs.threadCount() );
+  REQUIRE( ranInline );
+  REQUIRE( count == 20001 );
+}
@@ -0,0 +1,188 @@
+#include <catch2/catch.hpp>
+
+#include "math/matrix.hh"
+
+#include <cmath>
+#include <random>
+
+namespace {
+
+  // Reference implementations in double precision, the SIMD kernels are
+  // checked against these with the tolerances documented in matrix.hh
+
+  constexpr double MULTIPLY_TOLERANCE = 1e-5;
+  constexpr double INVERSE_TOLERANCE = 1e-4;
+
+  struct RefMatrix {
+    double m[4][4];
+  };
+
+  RefMatrix toRef( const fn::Matrix4 &mat ) {
+    RefMatrix r;
+    for ( int c = 0; c < 4; c++ )
+      for ( int i = 0; i < 4; i++ )
+        r.m[ c ][ i ] = static_cast<double>( mat[ static_cast<size_t>( c ) ][ static_cast<unsigned>( i ) ] );
+    return r;
+  }
+
+  RefMatrix refMultiply( const RefMatrix &a, const RefMatrix &b ) {
+    RefMatrix r;
+    for ( int c = 0; c < 4; c++ )
+      for ( int i = 0; i < 4; i++ ) {
+        r.m[ c ][ i ] = 0.0;
+        for ( int k = 0; k < 4; k++ )
+          r.m[ c ][ i ] += a.m[ k ][ i ] * b.m[ c ][ k ];
+      }
+    return r;
+  }
+
+  // Gauss-Jordan with partial pivoting
+  RefMatrix refInverse( const RefMatrix &a ) {
+    double w[ 4 ][ 8 ];
+    for ( int r = 0; r < 4; r++ )
+      for ( int c = 0; c < 4; c++ ) {
+        w[ r ][ c ] = a.m[ c ][ r ];
+        w[ r ][ c + 4 ] = ( r == c ) ? 1.0 : 0.0;
+      }
+
+    for ( int col = 0; col < 4; col++ ) {
+      int pivot = col;
+      for ( int r = col + 1; r < 4; r++ )
+        if ( std::fabs( w[ r ][ col ] ) > std::fabs( w[ pivot ][ col ] ) )
+          pivot = r;
+      for ( int c = 0; c < 8; c++ )
+        std::swap( w[ col ][ c ], w[ pivot ][ c ] );
+
+      const double p = w[ col ][ col ];
+      for ( int c = 0; c < 8; c++ )
+        w[ col ][ c ] /= p;
+
+      for ( int r = 0; r < 4; r++ ) {
+        if ( r == col )
+          continue;
+        const double f = w[ r ][ col ];
+        for ( int c = 0; c < 8; c++ )
+          w[ r ][ c ] -= f * w[ col ][ c ];
+      }
+    }
+
+    RefMatrix r;
+    for ( int row = 0; row < 4; row++ )
+      for ( int c = 0; c < 4; c++ )
+        r.m[ c ][ row ] = w[ row ][ c + 4 ];
+    return r;
+  }
+
+  double refDeterminant( const RefMatrix &a ) {
+    auto minor3 = []( const RefMatrix &m, int skipCol ) {
+      int cols[ 3 ];
+      for ( int c = 0, n = 0; c < 4; c++ )
+        if ( c != skipCol )
+          cols[ n++ ] = c;
+      auto e = [&]( int r, int c ) { return m.m[ cols[ c ] ][ r ]; };
+      return e( 1, 0 ) * ( e( 2, 1 ) * e( 3, 2 ) - e( 3, 1 ) * e( 2, 2 ) ) -
+             e( 1, 1 ) * ( e( 2, 0 ) * e( 3, 2 ) - e( 3, 0 ) * e( 2, 2 ) ) +
+             e( 1, 2 ) * ( e( 2, 0 ) * e( 3, 1 ) - e( 3, 0 ) * e( 2, 1 ) );
+    };
+
+    double det = 0.0;
+    for ( int c = 0; c < 4; c++ ) {
+      const double sign = ( c % 2 == 0 ) ? 1.0 : -1.0;
+      det += sign * a.m[ c ][ 0 ] * minor3( a, c );
+    }
+    return det;
+  }
+
+  bool closeTo( double value, double expected, double tolerance ) {
+    return std::fabs( value - expected ) <= tolerance * std::fmax( 1.0, std::fabs( expected ) );
+  }
+
+  bool matches( const fn::Matrix4 &mat, const RefMatrix &ref, double tolerance ) {
+    for ( int c = 0; c < 4; c++ )
+      for ( int i = 0; i < 4; i++ ) {
+        const double v = static_cast<double>(
+            mat[ static_cast<size_t>( c ) ][ static_cast<unsigned>( i ) ] );
+        if ( !closeTo( v, ref.m[ c ][ i ], tolerance ) )
+          return false;
+      }
+    return true;
+  }
+
+  fn::Matrix4 randomMatrix( std::mt19937 &rng ) {
+    std::uniform_real_distribution<float> dist( -2.0f, 2.0f );
+    fn::Matrix4 mat;
+    for ( size_t c = 0; c < 4; c++ )
+      for ( unsigned i = 0; i < 4; i++ )
+        mat[ c ][ i ] = dist( rng ) + ( c == i ? 4.0f : 0.0f );
+    return mat;
+  }
+
+}    // namespace
+
+TEST_CASE( "Matrix4 multiply matches the scalar reference", "[matrix]" ) {
+  std::mt19937 rng( 1234 );
+
+  for ( int n = 0; n < 256; n++ ) {
+    const fn::Matrix4 a = randomMatrix( rng );
+    const fn::Matrix4 b = randomMatrix( rng );
+
+    REQUIRE( matches( a * b, refMultiply( toRef( a ), toRef( b ) ), MULTIPLY_TOLERANCE ) );
+  }
+}
+
+TEST_CASE( "Matrix4 transpose and transform", "[matrix]" ) {
+  std::mt19937 rng( 42 );
+  const fn::Matrix4 a = randomMatrix( rng );
+  const fn::Matrix4 t = a.transposed();
+
+  for ( size_t c = 0; c < 4; c++ )
+    for ( unsigned i = 0; i < 4; i++ )
+      REQUIRE( t[ c ][ i ] == a[ i ][ static_cast<unsigned>( c ) ] );
+
+  fn::Matrix4 b( a );
+  b.transpose();
+  REQUIRE( b == t );
+
+  const fn::Vec3 p( 1.0f, -2.0f, 0.5f );
+  const fn::Vec3 tp = a.transformPoint( p );
+  const fn::Vec3 tv = a.transformVector( p );
+  const fn::Vec4 t4 = a * fn::Vec4( p, 1.0f );
+
+  for ( unsigned i = 0; i < 3; i++ ) {
+    const double point = static_cast<double>( a[ 0 ][ i ] * p.x + a[ 1 ][ i ] * p.y +
+                                              a[ 2 ][ i ] * p.z + a[ 3 ][ i ] );
+    const double vector = point - static_cast<double>( a[ 3 ][ i ] );
+    REQUIRE( closeTo( static_cast<double>( tp[ i ] ), point, MULTIPLY_TOLERANCE ) );
+    REQUIRE( closeTo( static_cast<double>( tv[ i ] ), vector, MULTIPLY_TOLERANCE ) );
+    REQUIRE( closeTo( static_cast<double>( t4[ i ] ), point, MULTIPLY_TOLERANCE ) );
+  }
+}
+
+TEST_CASE( "Matrix4 determinant and inverse match the scalar reference", "[matrix]" ) {
+  std::mt19937 rng( 7 );
+
+  for ( int n = 0; n < 256; n++ ) {
+    const fn::Matrix4 a = randomMatrix( rng );
+    const RefMatrix ref = toRef( a );
+
+    REQUIRE( closeTo( static_cast<double>( a.determinant() ), refDeterminant( ref ),
+                      INVERSE_TOLERANCE ) );
+
+    fn::Matrix4 inv( a );
+    inv.inverse();
+    REQUIRE( matches( inv, refInverse( ref ), INVERSE_TOLERANCE ) );
+    REQUIRE( matches( a.inversed(), refInverse( ref ), INVERSE_TOLERANCE ) );
+  }
+}
+
+TEST_CASE( "Matrix4 inverse leaves singular matrices untouched", "[matrix]" ) {
+  fn::Matrix4 singular( 1.0f, 2.0f, 3.0f, 4.0f,
+                        2.0f, 4.0f, 6.0f, 8.0f,
+                        0.0f, 1.0f, 0.0f, 1.0f,
+                        5.0f, 0.0f, 1.0f, 2.0f );
+  const fn::Matrix4 copy( singular );
+
+  REQUIRE( singular.determinant() == 0.0f );
+  singular.inverse();
+  REQUIRE( singular == copy );
+}
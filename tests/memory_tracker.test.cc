@@ -0,0 +1,107 @@
+#include <catch2/catch.hpp>
+
+#include "core/memory_tracker.hh"
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+TEST_CASE( "MemoryTracker charges blocks to their tag", "[memory_tracker]" ) {
+  const fn::MemoryStats before = fn::MemoryTracker::stats( fn::MemoryTag::Math );
+
+  void *small = fn::MemoryTracker::allocate( 100, 16, fn::MemoryTag::Math );
+  void *aligned = fn::MemoryTracker::allocate( 1000, 256, fn::MemoryTag::Math );
+  REQUIRE( small );
+  REQUIRE( aligned );
+  REQUIRE( reinterpret_cast<std::uintptr_t>( small ) % 16 == 0 );
+  REQUIRE( reinterpret_cast<std::uintptr_t>( aligned ) % 256 == 0 );
+  std::memset( aligned, 0xab, 1000 );
+
+  fn::MemoryStats during = fn::MemoryTracker::stats( fn::MemoryTag::Math );
+  REQUIRE( during.current == before.current + 1100 );
+  REQUIRE( during.allocations == before.allocations + 2 );
+  REQUIRE( during.live == before.live + 2 );
+  REQUIRE( during.peak >= during.current );
+
+  // Freed from any scope, credited to the tag it was charged to
+  {
+    fn::MemoryScope scope( fn::MemoryTag::Renderer );
+    fn::MemoryTracker::deallocate( aligned );
+  }
+  fn::MemoryTracker::deallocate( small );
+  fn::MemoryTracker::deallocate( nullptr );
+
+  const fn::MemoryStats after = fn::MemoryTracker::stats( fn::MemoryTag::Math );
+  REQUIRE( after.current == before.current );
+  REQUIRE( after.live == before.live );
+  REQUIRE( after.peak >= before.current + 1100 );
+}
+
+TEST_CASE( "MemoryTracker reallocates in place of realloc", "[memory_tracker]" ) {
+  const std::size_t before = fn::MemoryTracker::stats( fn::MemoryTag::Assets ).current;
+
+  auto *bytes = static_cast<unsigned char *>( fn::MemoryTracker::reallocate( nullptr, 4, fn::MemoryTag::Assets ) );
+  REQUIRE( bytes );
+  std::memcpy( bytes, "abcd", 4 );
+
+  // Keeps the tag it was allocated with
+  bytes = static_cast<unsigned char *>( fn::MemoryTracker::reallocate( bytes, 64, fn::MemoryTag::Logging ) );
+  REQUIRE( std::memcmp( bytes, "abcd", 4 ) == 0 );
+  REQUIRE( fn::MemoryTracker::stats( fn::MemoryTag::Assets ).current == before + 64 );
+
+  fn::MemoryTracker::deallocate( bytes );
+  REQUIRE( fn::MemoryTracker::stats( fn::MemoryTag::Assets ).current == before );
+}
+
+TEST_CASE( "MemoryScope nests and restores the tag of the thread", "[memory_tracker]" ) {
+  REQUIRE( fn::MemoryTracker::currentTag() == fn::MemoryTag::General );
+  {
+    fn::MemoryScope renderer( fn::MemoryTag::Renderer );
+    {
+      fn::MemoryScope assets( fn::MemoryTag::Assets );
+      REQUIRE( fn::MemoryTracker::currentTag() == fn::MemoryTag::Assets );
+    }
+    REQUIRE( fn::MemoryTracker::currentTag() == fn::MemoryTag::Renderer );
+  }
+  REQUIRE( fn::MemoryTracker::currentTag() == fn::MemoryTag::General );
+  REQUIRE( std::strcmp( fn::memoryTagName( fn::MemoryTag::Assets ), "Assets" ) == 0 );
+}
+
+#if defined( FN_MEMORY_TRACKING )
+TEST_CASE( "Global new is charged to the scope of the thread", "[memory_tracker]" ) {
+  const std::size_t before = fn::MemoryTracker::stats( fn::MemoryTag::Ecs ).current;
+
+  std::vector<int> *numbers;
+  {
+    FN_MEMORY_SCOPE( Ecs );
+    numbers = new std::vector<int>( 1000 );
+  }
+  REQUIRE( fn::MemoryTracker::stats( fn::MemoryTag::Ecs ).current >= before + 1000 * sizeof( int ) );
+
+  delete numbers;
+  REQUIRE( fn::MemoryTracker::stats( fn::MemoryTag::Ecs ).current == before );
+}
+#endif
+
+TEST_CASE( "MemoryTracker reports budgets and leaks", "[memory_tracker]" ) {
+  const std::size_t current = fn::MemoryTracker::stats( fn::MemoryTag::Logging ).current;
+  fn::MemoryTracker::setBudget( fn::MemoryTag::Logging, current + 512 );
+  REQUIRE( fn::MemoryTracker::checkBudgets() );
+
+  const fn::MemoryTracker::Snapshot start = fn::MemoryTracker::snapshot();
+  void *within = fn::MemoryTracker::allocate( 256, 16, fn::MemoryTag::Logging );
+  REQUIRE( fn::MemoryTracker::checkBudgets() );
+
+  void *over = fn::MemoryTracker::allocate( 512, 16, fn::MemoryTag::Logging );
+  REQUIRE_FALSE( fn::MemoryTracker::checkBudgets() );
+  REQUIRE( fn::MemoryTracker::reportLeaks( start ) >= 768 );
+
+  // Back under budget, the overrun has been reported already
+  fn::MemoryTracker::deallocate( over );
+  REQUIRE( fn::MemoryTracker::checkBudgets() );
+  fn::MemoryTracker::deallocate( within );
+
+  fn::MemoryTracker::setBudget( fn::MemoryTag::Logging, 0 );
+  REQUIRE( fn::MemoryTracker::stats( fn::MemoryTag::Logging ).budget == 0 );
+}
@@ -0,0 +1,135 @@
+#include <catch2/catch.hpp>
+
+#include "core/object.hh"
+#include "core/pool_allocator.hh"
+
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace {
+
+  struct alignas( 32 ) Particle {
+    float position[ 3 ];
+    float velocity[ 3 ];
+  };
+
+  int g_destroyed = 0;
+
+  class Texture : public fn::Object {
+  public:
+    FN_POOLED( Texture )
+
+    explicit Texture( int id ) noexcept : m_id( id ) {}
+    ~Texture() noexcept override {
+      g_destroyed++;
+    }
+
+    int id() const noexcept {
+      return m_id;
+    }
+
+  private:
+    int m_id;
+  };
+
+  // Larger than Texture, inherits its operator new and falls back to the heap
+  class StreamedTexture : public Texture {
+  public:
+    using Texture::Texture;
+    char mips[ 256 ] = {};
+  };
+
+}    // namespace
+
+TEST_CASE( "PoolAllocator reuses slots and grows by chunks", "[pool_allocator]" ) {
+  fn::PoolAllocator<Particle> pool( 8 );
+  REQUIRE( pool.stats().chunks == 0 );
+
+  std::vector<Particle *> particles;
+  for ( int i = 0; i < 20; i++ ) {
+    particles.push_back( pool.create() );
+    REQUIRE( reinterpret_cast<std::uintptr_t>( particles.back() ) % alignof( Particle ) == 0 );
+  }
+  fn::PoolStats stats = pool.stats();
+  REQUIRE( stats.chunks == 3 );
+  REQUIRE( stats.capacity == 24 );
+  REQUIRE( stats.outstanding == 20 );
+
+  // The most recently freed slot is handed out next
+  Particle *freed = particles[ 5 ];
+  pool.destroy( freed );
+  REQUIRE( pool.create() == freed );
+
+  for ( Particle *p : particles ) pool.destroy( p );
+  stats = pool.stats();
+  REQUIRE( stats.outstanding == 0 );
+  REQUIRE( stats.peakOutstanding == 20 );
+  REQUIRE( stats.chunks == 3 );
+
+  pool.reserve( 100 );
+  REQUIRE( pool.stats().capacity >= 100 );
+}
+
+TEST_CASE( "FN_POOLED classes live in the pool of their type", "[pool_allocator]" ) {
+  g_destroyed = 0;
+  const std::size_t before = fn::PoolAllocator<Texture>::shared().stats().outstanding;
+
+  std::vector<fn::Object *> objects;
+  for ( int i = 0; i < 1000; i++ ) objects.push_back( new Texture( i ) );
+  REQUIRE( static_cast<Texture *>( objects[ 999 ] )->id() == 999 );
+  REQUIRE( fn::PoolAllocator<Texture>::shared().stats().outstanding > before );
+
+  // Deleting through the base reaches the pool of the dynamic type
+  for ( fn::Object *object : objects ) delete object;
+  REQUIRE( g_destroyed == 1000 );
+
+  fn::Object *streamed = new StreamedTexture( 7 );
+  REQUIRE( static_cast<StreamedTexture *>( streamed )->id() == 7 );
+  delete streamed;
+  REQUIRE( g_destroyed == 1001 );
+
+  // allocate_shared puts the control block and the object in one pool slot
+  auto shared = std::allocate_shared<Texture>( fn::PoolStdAllocator<Texture>(), 42 );
+  REQUIRE( shared->id() == 42 );
+  shared.reset();
+  REQUIRE( g_destroyed == 1002 );
+}
+
+TEST_CASE( "PoolAllocator shared pool across threads", "[pool_allocator]" ) {
+  fn::PoolAllocator<Particle> &pool = fn::PoolAllocator<Particle>::shared();
+  const std::size_t before = pool.stats().outstanding;
+
+  // Every thread frees what its neighbour allocated
+  constexpr int THREADS = 4;
+  constexpr int COUNT = 5000;
+  std::vector<std::vector<Particle *>> made( THREADS );
+  std::vector<std::thread> threads;
+  for ( int t = 0; t < THREADS; t++ ) {
+    threads.emplace_back( [&made, &pool, t] {
+      auto &mine = made[ static_cast<std::size_t>( t ) ];
+      for ( int i = 0; i < COUNT; i++ ) {
+        Particle *p = pool.create();
+        p->position[ 0 ] = static_cast<float>( t );
+        mine.push_back( p );
+        if ( i % 3 == 0 ) {
+          pool.destroy( mine.back() );
+          mine.pop_back();
+        }
+      }
+    } );
+  }
+  for ( auto &thread : threads ) thread.join();
+  threads.clear();
+
+  for ( int t = 0; t < THREADS; t++ ) {
+    threads.emplace_back( [&made, &pool, t] {
+      for ( Particle *p : made[ static_cast<std::size_t>( ( t + 1 ) % THREADS ) ] ) pool.destroy( p );
+    } );
+  }
+  for ( auto &thread : threads ) thread.join();
+
+  // Exited threads handed their cached slots back
+  REQUIRE( pool.stats().outstanding == before );
+}
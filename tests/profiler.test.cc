@@ -0,0 +1,179 @@
+#include <catch2/catch.hpp>
+
+#include "core/job_system.hh"
+#include "core/memory_tracker.hh"
+#include "core/profiler.hh"
+
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+  std::string trace() {
+    std::ostringstream out;
+    fn::Profiler::writeTrace( out );
+    return out.str();
+  }
+
+  std::size_t count( const std::string &text, const std::string &pattern ) {
+    std::size_t found = 0;
+    for ( std::size_t at = text.find( pattern ); at != std::string::npos; at = text.find( pattern, at + 1 ) ) {
+      found++;
+    }
+    return found;
+  }
+
+  std::string event( const char *name ) {
+    return std::string( "{\"name\":\"" ) + name + "\",\"cat\":\"cpu\",\"ph\":\"X\"";
+  }
+
+}    // namespace
+
+TEST_CASE( "Profiler records nested scopes as complete events", "[profiler]" ) {
+  fn::Profiler::start();
+  {
+    fn::ProfileScope outer( "outer" );
+    for ( int i = 0; i < 3; i++ ) {
+      fn::ProfileScope inner( "inner \"quoted\"" );
+    }
+  }
+  fn::Profiler::stop();
+
+  // Closed after the capture, not recorded
+  {
+    fn::ProfileScope late( "late" );
+  }
+
+  const std::string json = trace();
+  REQUIRE( json.rfind( "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[", 0 ) == 0 );
+  REQUIRE( json.find( "\n]}\n" ) == json.size() - 4 );
+  REQUIRE( count( json, event( "outer" ) ) == 1 );
+  REQUIRE( count( json, event( "inner \\\"quoted\\\"" ) ) == 3 );
+  REQUIRE( count( json, event( "late" ) ) == 0 );
+  REQUIRE( count( json, "\"ph\":\"M\"" ) >= 1 );
+
+  // A new capture starts empty
+  fn::Profiler::start();
+  fn::Profiler::stop();
+  REQUIRE( count( trace(), "\"ph\":\"X\"" ) == 0 );
+}
+
+TEST_CASE( "Profiler records counter samples", "[profiler]" ) {
+  fn::Profiler::counter( "before", 1.0 );
+
+  fn::Profiler::start();
+  fn::Profiler::counter( "GPU frame", 1.5 );
+  fn::Profiler::counter( "GPU frame", 0.25 );
+  fn::Profiler::stop();
+
+  const std::string json = trace();
+  REQUIRE( count( json, "{\"name\":\"GPU frame\",\"ph\":\"C\"" ) == 2 );
+  REQUIRE( count( json, "\"args\":{\"value\":1.5}}" ) == 1 );
+  REQUIRE( count( json, "\"args\":{\"value\":0.25}}" ) == 1 );
+  REQUIRE( count( json, "\"before\"" ) == 0 );
+  REQUIRE( count( json, "\"ph\":\"X\"" ) == 0 );
+}
+
+TEST_CASE( "Profiler macros", "[profiler]" ) {
+  fn::Profiler::start();
+  {
+    FN_PROFILE_FUNCTION();
+    FN_PROFILE_SCOPE( "macro scope" );
+  }
+  fn::Profiler::stop();
+
+  const std::string json = trace();
+#if defined( FN_PROFILE )
+  REQUIRE( count( json, event( "macro scope" ) ) == 1 );
+  REQUIRE( count( json, "\"ph\":\"X\"" ) == 2 );
+#else
+  REQUIRE( count( json, "\"ph\":\"X\"" ) == 0 );
+#endif
+}
+
+TEST_CASE( "Profiler keeps the last events of every thread", "[profiler]" ) {
+  fn::Profiler::start();
+  const std::size_t extra = 100;
+  for ( std::size_t i = 0; i < fn::Profiler::EVENTS_PER_THREAD + extra; i++ ) {
+    fn::Profiler::record( i < extra ? "dropped" : "kept", fn::Profiler::now(), fn::Profiler::now() );
+  }
+  fn::Profiler::stop();
+
+  const std::string json = trace();
+  REQUIRE( count( json, event( "dropped" ) ) == 0 );
+  REQUIRE( count( json, event( "kept" ) ) == fn::Profiler::EVENTS_PER_THREAD );
+}
+
+TEST_CASE( "Profiler records threads while a trace is written", "[profiler]" ) {
+  constexpr int THREADS = 4;
+  constexpr int SCOPES = 20000;
+
+  fn::Profiler::start();
+  std::atomic<int> running{THREADS};
+  std::vector<std::thread> threads;
+  for ( int t = 0; t < THREADS; t++ ) {
+    threads.emplace_back( [t, &running] {
+      fn::Profiler::setThreadName( "recorder " + std::to_string( t ) );
+      for ( int i = 0; i < SCOPES; i++ ) {
+        fn::ProfileScope scope( "work" );
+      }
+      running--;
+    } );
+  }
+
+  // Exports race with the writers, and may only drop what is overwritten
+  while ( running > 0 ) {
+    REQUIRE( trace().find( "\n]}\n" ) != std::string::npos );
+  }
+  for ( std::thread &thread : threads ) thread.join();
+  fn::Profiler::stop();
+
+  const std::string json = trace();
+  for ( int t = 0; t < THREADS; t++ ) {
+    REQUIRE( count( json, "{\"name\":\"recorder " + std::to_string( t ) + "\"}" ) == 1 );
+  }
+  REQUIRE( count( json, event( "work" ) ) == THREADS * SCOPES );
+}
+
+TEST_CASE( "Profiler names threads without allocating their events", "[profiler]" ) {
+  const fn::MemoryStats before = fn::MemoryTracker::stats( fn::MemoryTag::General );
+  std::thread named( [] {
+    fn::Profiler::setThreadName( "idle" );
+    fn::ProfileScope scope( "outside of a capture" );
+  } );
+  named.join();
+
+  // The ring of a thread is allocated by its first event during a capture
+  if ( fn::MemoryTracker::enabled ) {
+    REQUIRE( fn::MemoryTracker::stats( fn::MemoryTag::General ).current - before.current <
+             fn::Profiler::EVENTS_PER_THREAD );
+  }
+
+  const std::string json = trace();
+  REQUIRE( count( json, "{\"name\":\"idle\"}" ) == 1 );
+  REQUIRE( count( json, event( "outside of a capture" ) ) == 0 );
+}
+
+TEST_CASE( "Profiler writes a trace after a number of frames", "[profiler]" ) {
+  const std::string path = ( std::filesystem::temp_directory_path() / "fn_profiler_trace.json" ).string();
+  std::filesystem::remove( path );
+
+  fn::Profiler::captureFrames( 3, path );
+  for ( int frame = 0; frame < 5; frame++ ) {
+    fn::ProfileScope scope( "frame" );
+    REQUIRE( std::filesystem::exists( path ) == ( frame >= 3 ) );
+    fn::Profiler::endFrame();
+  }
+  REQUIRE_FALSE( fn::Profiler::isCapturing() );
+
+  std::ifstream file( path );
+  std::stringstream json;
+  json << file.rdbuf();
+  // The scope of the last frame closes after the trace is written
+  REQUIRE( count( json.str(), event( "frame" ) ) == 2 );
+}
@@ -0,0 +1,113 @@
+#include <catch2/catch.hpp>
+
+#include "math/batch.hh"
+#include "math/matrix_transformations.hh"
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace {
+
+  constexpr double TOLERANCE = 1e-5;
+
+  bool closeTo( float value, float expected ) {
+    return std::fabs( static_cast<double>( value ) - static_cast<double>( expected ) ) <= TOLERANCE;
+  }
+
+  bool closeTo( const fn::Vec3 &a, const fn::Vec3 &b ) {
+    return closeTo( a.x, b.x ) && closeTo( a.y, b.y ) && closeTo( a.z, b.z );
+  }
+
+  // q and -q are the same rotation
+  bool sameRotation( const fn::Quat &a, const fn::Quat &b ) {
+    const float s = fn::dotProduct( a, b ) < 0.0f ? -1.0f : 1.0f;
+    return closeTo( a.x, s * b.x ) && closeTo( a.y, s * b.y ) && closeTo( a.z, s * b.z ) &&
+           closeTo( a.w, s * b.w );
+  }
+
+  bool closeTo( const fn::Matrix4 &a, const fn::Matrix4 &b ) {
+    for ( size_t c = 0; c < 4; c++ )
+      for ( unsigned r = 0; r < 4; r++ )
+        if ( !closeTo( a[ c ][ r ], b[ c ][ r ] ) )
+          return false;
+    return true;
+  }
+
+  fn::Quat randomQuat( std::mt19937 &rng ) {
+    std::uniform_real_distribution<float> dist( -1.0f, 1.0f );
+    return fn::Quat( dist( rng ), dist( rng ), dist( rng ), dist( rng ) ).normalized();
+  }
+
+}    // namespace
+
+TEST_CASE( "Quat matches the matrix rotation", "[quaternion]" ) {
+  const fn::Vec3 axis( 1.0f, 2.0f, -0.5f );
+  const float angle = 0.8f;
+
+  const fn::Quat q = fn::Quat::fromAxisAngle( axis, angle );
+  const fn::Matrix4 m = fn::Math::rotate( fn::Matrix4(), axis, angle );
+
+  REQUIRE( closeTo( q.toMatrix(), m ) );
+  REQUIRE( sameRotation( fn::Quat::fromMatrix( m ), q ) );
+
+  const fn::Vec3 v( 3.0f, -1.0f, 2.0f );
+  REQUIRE( closeTo( q.rotate( v ), m.transformVector( v ) ) );
+
+  // Composition applies the right hand side first, like matrices
+  const fn::Quat r = fn::Quat::fromAxisAngle( fn::Vec3( 0.0f, 1.0f, 0.0f ), 2.5f );
+  REQUIRE( closeTo( ( q * r ).toMatrix(), q.toMatrix() * r.toMatrix() ) );
+  REQUIRE( sameRotation( q * q.conjugate(), fn::Quat() ) );
+}
+
+TEST_CASE( "Quat fromMatrix handles every pivot", "[quaternion]" ) {
+  // Half turns give a negative trace and exercise the x, y and z branches
+  const fn::Vec3 axes[] = { fn::Vec3( 1.0f, 0.0f, 0.0f ), fn::Vec3( 0.0f, 1.0f, 0.0f ),
+                            fn::Vec3( 0.0f, 0.0f, 1.0f ), fn::Vec3( 1.0f, 1.0f, 1.0f ) };
+  for ( const fn::Vec3 &axis : axes ) {
+    const fn::Quat q = fn::Quat::fromAxisAngle( axis, 3.1f );
+    REQUIRE( sameRotation( fn::Quat::fromMatrix( q.toMatrix() ), q ) );
+  }
+}
+
+TEST_CASE( "Quat interpolation", "[quaternion]" ) {
+  const fn::Vec3 up( 0.0f, 0.0f, 1.0f );
+  const fn::Quat a = fn::Quat::fromAxisAngle( up, 0.0f );
+  const fn::Quat b = fn::Quat::fromAxisAngle( up, 2.0f );
+
+  REQUIRE( sameRotation( fn::Math::slerp( a, b, 0.0f ), a ) );
+  REQUIRE( sameRotation( fn::Math::slerp( a, b, 1.0f ), b ) );
+  REQUIRE( sameRotation( fn::Math::slerp( a, b, 0.25f ), fn::Quat::fromAxisAngle( up, 0.5f ) ) );
+  REQUIRE( sameRotation( fn::Math::nlerp( a, b, 0.5f ), fn::Quat::fromAxisAngle( up, 1.0f ) ) );
+
+  // Opposite sign input still takes the shortest arc
+  const fn::Quat nb( -b.x, -b.y, -b.z, -b.w );
+  REQUIRE( sameRotation( fn::Math::slerp( a, nb, 0.25f ), fn::Quat::fromAxisAngle( up, 0.5f ) ) );
+}
+
+TEST_CASE( "Batched nlerp and slerp match the scalar versions", "[quaternion][batch]" ) {
+  // 8 + 4 + 1 so every lane width is used
+  constexpr size_t N = 13;
+  std::mt19937 rng( 17 );
+  std::uniform_real_distribution<float> dist( 0.0f, 1.0f );
+
+  std::vector<fn::Quat> a( N ), b( N ), out( N );
+  std::vector<float> t( N );
+  for ( size_t i = 0; i < N; i++ ) {
+    a[ i ] = randomQuat( rng );
+    b[ i ] = randomQuat( rng );
+    t[ i ] = dist( rng );
+  }
+  // Nearly parallel pair, where the scalar slerp falls back to nlerp
+  b[ 5 ] = fn::Math::nlerp( a[ 5 ], b[ 5 ], 1e-3f );
+
+  fn::Math::nlerpBatch( a.data(), b.data(), t.data(), out.data(), N );
+  for ( size_t i = 0; i < N; i++ )
+    REQUIRE( sameRotation( out[ i ], fn::Math::nlerp( a[ i ], b[ i ], t[ i ] ) ) );
+
+  fn::Math::slerpBatch( a.data(), b.data(), t.data(), out.data(), N );
+  for ( size_t i = 0; i < N; i++ ) {
+    REQUIRE( sameRotation( out[ i ], fn::Math::slerp( a[ i ], b[ i ], t[ i ] ) ) );
+    REQUIRE( closeTo( out[ i ].length(), 1.0f ) );
+  }
+}
@@ -0,0 +1,213 @@
+#include <catch2/catch.hpp>
+
+#include "resources/resource_manager.hh"
+#include "resources/shader.hh"
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace {
+
+  std::atomic<int> g_decoded{0};
+
+  // Guards the order in which the loader thread decoded things
+  std::mutex g_orderMutex;
+  std::vector<std::string> g_order;
+
+  // Holds the loader thread until released
+  std::atomic<bool> g_gateOpen{true};
+
+  class Text : public fn::Resource {
+  public:
+    bool decode( const std::vector<char> &bytes, const std::string &path ) override {
+      while ( !g_gateOpen.load() ) {
+      }
+      g_decoded++;
+      {
+        std::lock_guard<std::mutex> lock( g_orderMutex );
+        g_order.push_back( path.substr( path.find_last_of( '/' ) + 1 ) );
+      }
+      text.assign( bytes.begin(), bytes.end() );
+      return text != "invalid";
+    }
+
+    std::size_t memoryUsage() const noexcept override {
+      return text.size();
+    }
+
+    std::string text;
+  };
+
+  std::string writeFile( const std::string &name, const std::string &contents ) {
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / ( "fn_resource_" + name );
+    std::ofstream( path, std::ios::binary ) << contents;
+    return path.string();
+  }
+
+}    // namespace
+
+TEST_CASE( "ResourceManager loads in the background and shares paths", "[resource_manager]" ) {
+  fn::ResourceManager resources( 2 );
+  g_decoded = 0;
+
+  const std::string path = writeFile( "a.txt", "first" );
+  fn::Handle<Text> a = resources.load<Text>( path );
+  REQUIRE( a.isValid() );
+
+  std::shared_ptr<Text> text = resources.wait( a );
+  REQUIRE( text );
+  REQUIRE( text->text == "first" );
+  REQUIRE( resources.state( a ) == fn::ResourceState::Ready );
+
+  // The same path is the same resource, read once
+  fn::Handle<Text> again = resources.load<Text>( path );
+  REQUIRE( again == a );
+  REQUIRE( resources.get( again ) == text );
+  REQUIRE( g_decoded == 1 );
+
+  fn::ResourceStats stats = resources.stats();
+  REQUIRE( stats.loaded == 1 );
+  REQUIRE( stats.pathHits == 1 );
+  REQUIRE( stats.resident == 1 );
+  REQUIRE( stats.memory == 5 );
+
+  // Missing and invalid files fail without taking anything down
+  fn::Handle<Text> missing = resources.load<Text>( "/nonexistent/fn_resource.txt" );
+  fn::Handle<Text> invalid = resources.load<Text>( writeFile( "invalid.txt", "invalid" ) );
+  resources.waitAll();
+  REQUIRE( resources.get( missing ) == nullptr );
+  REQUIRE( resources.state( missing ) == fn::ResourceState::Failed );
+  REQUIRE( resources.state( invalid ) == fn::ResourceState::Failed );
+  REQUIRE( resources.stats().failed == 2 );
+}
+
+TEST_CASE( "ResourceManager decodes identical files once", "[resource_manager]" ) {
+  fn::ResourceManager resources( 1 );
+  g_decoded = 0;
+
+  fn::Handle<Text> a = resources.load<Text>( writeFile( "same_a.txt", "shared bytes" ) );
+  fn::Handle<Text> b = resources.load<Text>( writeFile( "same_b.txt", "shared bytes" ) );
+  fn::Handle<Text> c = resources.load<Text>( writeFile( "other.txt", "other bytes" ) );
+  resources.waitAll();
+
+  REQUIRE( a != b );
+  REQUIRE( resources.get( a ) == resources.get( b ) );
+  REQUIRE( resources.get( a ) != resources.get( c ) );
+  REQUIRE( g_decoded == 2 );
+
+  const fn::ResourceStats stats = resources.stats();
+  REQUIRE( stats.contentHits == 1 );
+  REQUIRE( stats.memory == 12 + 11 );
+}
+
+TEST_CASE( "ResourceManager compares the bytes of files that hash alike", "[resource_manager]" ) {
+  fn::ResourceManager resources( 1 );
+  g_decoded = 0;
+
+  const std::string first = writeFile( "compared_a.txt", "hashed bytes" );
+  std::shared_ptr<Text> a = resources.wait( resources.load<Text>( first ) );
+
+  // The hash of b finds a, whose file no longer holds the same bytes
+  writeFile( "compared_a.txt", "edited bytes" );
+  std::shared_ptr<Text> b = resources.wait( resources.load<Text>( writeFile( "compared_b.txt", "hashed bytes" ) ) );
+
+  REQUIRE( a != b );
+  REQUIRE( b->text == "hashed bytes" );
+  REQUIRE( g_decoded == 2 );
+  REQUIRE( resources.stats().contentHits == 0 );
+}
+
+TEST_CASE( "ResourceManager unloads released resources after a delay", "[resource_manager]" ) {
+  fn::ResourceManager resources( 1, 3 );
+
+  const std::string path = writeFile( "unload.txt", "transient" );
+  fn::Handle<Text> handle = resources.load<Text>( path );
+  std::shared_ptr<Text> kept = resources.wait( handle );
+
+  resources.acquire( handle );
+  resources.release( handle );
+  resources.release( handle );
+  resources.update();
+  resources.update();
+  REQUIRE( resources.state( handle ) == fn::ResourceState::Ready );
+
+  // Loaded again within the delay, nothing is read again
+  REQUIRE( resources.load<Text>( path ) == handle );
+  for ( int i = 0; i < 5; i++ ) resources.update();
+  REQUIRE( resources.state( handle ) == fn::ResourceState::Ready );
+
+  resources.release( handle );
+  for ( int i = 0; i < 3; i++ ) resources.update();
+  REQUIRE( resources.state( handle ) == fn::ResourceState::Invalid );
+  REQUIRE( resources.get( handle ) == nullptr );
+  REQUIRE( resources.stats().unloaded == 1 );
+  REQUIRE( resources.stats().resident == 0 );
+
+  // Whoever still holds the resource keeps it
+  REQUIRE( kept->text == "transient" );
+
+  // The slot is reused, the stale handle stays dead
+  fn::Handle<Text> reloaded = resources.load<Text>( path );
+  REQUIRE( reloaded.index == handle.index );
+  REQUIRE( reloaded != handle );
+  REQUIRE( resources.wait( reloaded )->text == "transient" );
+  REQUIRE( resources.get( handle ) == nullptr );
+}
+
+TEST_CASE( "ResourceManager serves higher priorities first", "[resource_manager]" ) {
+  fn::ResourceManager resources( 1 );
+  {
+    std::lock_guard<std::mutex> lock( g_orderMutex );
+    g_order.clear();
+  }
+
+  // The only loader thread is stuck in the first file while the rest queue up
+  g_gateOpen = false;
+  fn::Handle<Text> first = resources.load<Text>( writeFile( "first.txt", "0" ) );
+  while ( resources.state( first ) != fn::ResourceState::Loading ) {
+  }
+
+  resources.load<Text>( writeFile( "low.txt", "1" ), fn::ResourcePriority::Low );
+  resources.load<Text>( writeFile( "normal.txt", "2" ) );
+  resources.load<Text>( writeFile( "critical.txt", "3" ), fn::ResourcePriority::Critical );
+  const std::string late = writeFile( "late.txt", "4" );
+  resources.load<Text>( late, fn::ResourcePriority::Low );
+  resources.load<Text>( writeFile( "high.txt", "5" ), fn::ResourcePriority::High );
+
+  // Asking again with a higher priority moves it up
+  resources.load<Text>( late, fn::ResourcePriority::Critical );
+
+  g_gateOpen = true;
+  resources.waitAll();
+
+  const std::vector<std::string> expected = {"fn_resource_first.txt",  "fn_resource_critical.txt",
+                                             "fn_resource_late.txt",   "fn_resource_high.txt",
+                                             "fn_resource_normal.txt", "fn_resource_low.txt"};
+  std::lock_guard<std::mutex> lock( g_orderMutex );
+  REQUIRE( g_order == expected );
+}
+
+TEST_CASE( "Shader accepts SPIR-V words only", "[resource_manager]" ) {
+  std::vector<char> bytes( 8, 0 );
+  const uint32_t magic = fn::Shader::SPIRV_MAGIC;
+  std::memcpy( bytes.data(), &magic, sizeof( magic ) );
+
+  fn::Shader shader;
+  REQUIRE( shader.decode( bytes, "valid.spv" ) );
+  REQUIRE( shader.code().size() == 2 );
+  REQUIRE( shader.code()[ 0 ] == fn::Shader::SPIRV_MAGIC );
+
+  fn::Shader truncated;
+  bytes.pop_back();
+  REQUIRE_FALSE( truncated.decode( bytes, "truncated.spv" ) );
+
+  fn::Shader text;
+  const std::string glsl = "#version 450";
+  REQUIRE_FALSE( text.decode( std::vector<char>( glsl.begin(), glsl.end() ), "shader.vert" ) );
+}
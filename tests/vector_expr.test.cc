@@ -0,0 +1,68 @@
+#include <catch2/catch.hpp>
+
+#include "math/matrix_transformations.hh"
+#include "math/vector_expr.hh"
+
+#include <cmath>
+#include <type_traits>
+
+namespace {
+
+  using namespace fn;
+
+  constexpr Vec4 a( 1.0f, 2.0f, 3.0f, 4.0f );
+  constexpr Vec4 b( 0.5f, -1.0f, 2.0f, 0.0f );
+  constexpr Vec4 c( 10.0f );
+
+  static_assert( expr::eval( expr::ref( a ) * 2.0f + b - c ) == a * 2.0f + b - c,
+                 "fused expression matches the operators" );
+  static_assert( expr::eval( -expr::ref( a ) / 2.0f ) == Vec4( -0.5f, -1.0f, -1.5f, -2.0f ),
+                 "unary minus and scalar division" );
+  constexpr Vec2 d( 1.0f, 3.0f );
+  static_assert( expr::eval( 1.0f - expr::ref( d ) ) == Vec2( 0.0f, -2.0f ), "scalars on the left" );
+  static_assert( expr::dot( expr::ref( a ) + b, expr::ref( c ) ) == dotProduct( a + b, c ),
+                 "fused dot product" );
+
+  constexpr Vec3 inPlace() {
+    Vec3 v( 1.0f, 2.0f, 3.0f );
+    expr::assign( v, expr::ref( v ) * expr::ref( v ) + 1.0f );
+    return v;
+  }
+  static_assert( inPlace() == Vec3( 2.0f, 5.0f, 10.0f ), "destination inside the expression" );
+
+  // Plain tVec arithmetic is unchanged and still returns vectors
+  static_assert( std::is_same_v<decltype( a + b ), Vec4>, "operators are not hijacked" );
+
+}    // namespace
+
+TEST_CASE( "Vector expressions evaluate like the operators", "[vector_expr]" ) {
+  const Vec3 p( 1.5f, -2.0f, 0.25f );
+  const Vec3 q( 4.0f, 0.5f, -3.0f );
+  const float s = 0.75f;
+
+  REQUIRE( expr::eval( expr::ref( p ) * s + q / 2.0f - p ) == p * s + q / 2.0f - p );
+
+  Vec3 r;
+  expr::assign( r, ( expr::ref( p ) - q ) * ( expr::ref( q ) + 1.0f ) );
+  REQUIRE( r == ( p - q ) * ( q + 1.0f ) );
+
+  const iVec2 i( 3, -4 );
+  REQUIRE( expr::eval( expr::ref( i ) * 2 + 1 ) == iVec2( 7, -7 ) );
+}
+
+TEST_CASE( "translate and rotate keep their results", "[vector_expr]" ) {
+  const Matrix4 m( 1.0f, 2.0f, 0.5f, 0.0f,
+                   -1.0f, 0.25f, 3.0f, 0.0f,
+                   0.0f, 1.5f, -2.0f, 0.0f,
+                   4.0f, -3.0f, 7.0f, 1.0f );
+  const Vec3 t( 2.0f, -1.0f, 0.5f );
+
+  const Matrix4 translated = Math::translate( m, t );
+  REQUIRE( translated[ 3 ] == m[ 0 ] * t[ 0 ] + m[ 1 ] * t[ 1 ] + m[ 2 ] * t[ 2 ] + m[ 3 ] );
+
+  const Matrix4 rotated = Math::rotate( m, Vec3( 0.0f, 0.0f, 1.0f ), 0.5f );
+  const float cs = std::cos( 0.5f );
+  const float sn = std::sin( 0.5f );
+  REQUIRE( rotated[ 0 ][ 0 ] == Approx( m[ 0 ][ 0 ] * cs + m[ 1 ][ 0 ] * sn ) );
+  REQUIRE( rotated[ 3 ] == m[ 3 ] );
+}
@@ -0,0 +1,117 @@
+#include <catch2/catch.hpp>
+
+#include "renderer/vulkan_host_allocator.hh"
+
+#include <cstdint>
+#include <cstring>
+
+namespace {
+
+  void *allocate( const VkAllocationCallbacks *callbacks, std::size_t size, std::size_t alignment,
+                  VkSystemAllocationScope scope ) {
+    return callbacks->pfnAllocation( callbacks->pUserData, size, alignment, scope );
+  }
+
+  void free( const VkAllocationCallbacks *callbacks, void *memory ) {
+    callbacks->pfnFree( callbacks->pUserData, memory );
+  }
+
+  bool aligned( void *memory, std::size_t alignment ) {
+    return reinterpret_cast<std::uintptr_t>( memory ) % alignment == 0;
+  }
+
+}    // namespace
+
+TEST_CASE( "VulkanHostAllocator counts blocks per allocation scope", "[vulkan_host_allocator]" ) {
+  fn::VulkanHostAllocator allocator( false );
+  const VkAllocationCallbacks *callbacks = allocator.callbacks();
+  const std::size_t renderer = fn::MemoryTracker::stats( fn::MemoryTag::Renderer ).current;
+
+  void *device = allocate( callbacks, 1000, 64, VK_SYSTEM_ALLOCATION_SCOPE_DEVICE );
+  void *object = allocate( callbacks, 24, 8, VK_SYSTEM_ALLOCATION_SCOPE_OBJECT );
+  REQUIRE( aligned( device, 64 ) );
+  REQUIRE( aligned( object, 8 ) );
+  std::memset( device, 0xab, 1000 );
+
+  REQUIRE( allocator.stats( VK_SYSTEM_ALLOCATION_SCOPE_DEVICE ).current == 1000 );
+  REQUIRE( allocator.stats( VK_SYSTEM_ALLOCATION_SCOPE_OBJECT ).current == 24 );
+  REQUIRE( allocator.stats( VK_SYSTEM_ALLOCATION_SCOPE_OBJECT ).live == 1 );
+  REQUIRE( fn::MemoryTracker::stats( fn::MemoryTag::Renderer ).current >= renderer + 1024 );
+
+  free( callbacks, device );
+  free( callbacks, object );
+  free( callbacks, nullptr );
+
+  REQUIRE( allocator.stats( VK_SYSTEM_ALLOCATION_SCOPE_DEVICE ).current == 0 );
+  REQUIRE( allocator.stats( VK_SYSTEM_ALLOCATION_SCOPE_DEVICE ).peak == 1000 );
+  REQUIRE( allocator.stats( VK_SYSTEM_ALLOCATION_SCOPE_OBJECT ).allocations == 1 );
+  REQUIRE( fn::MemoryTracker::stats( fn::MemoryTag::Renderer ).current == renderer );
+  REQUIRE( allocator.recycled() == 0 );
+}
+
+TEST_CASE( "VulkanHostAllocator reallocates like realloc", "[vulkan_host_allocator]" ) {
+  fn::VulkanHostAllocator allocator;
+  const VkAllocationCallbacks *callbacks = allocator.callbacks();
+
+  auto *bytes = static_cast<unsigned char *>(
+      callbacks->pfnReallocation( callbacks->pUserData, nullptr, 4, 16, VK_SYSTEM_ALLOCATION_SCOPE_CACHE ) );
+  REQUIRE( bytes );
+  std::memcpy( bytes, "abcd", 4 );
+
+  bytes = static_cast<unsigned char *>(
+      callbacks->pfnReallocation( callbacks->pUserData, bytes, 8192, 16, VK_SYSTEM_ALLOCATION_SCOPE_CACHE ) );
+  REQUIRE( std::memcmp( bytes, "abcd", 4 ) == 0 );
+  REQUIRE( allocator.stats( VK_SYSTEM_ALLOCATION_SCOPE_CACHE ).current == 8192 );
+
+  // A size of 0 frees
+  REQUIRE( callbacks->pfnReallocation( callbacks->pUserData, bytes, 0, 16, VK_SYSTEM_ALLOCATION_SCOPE_CACHE ) ==
+           nullptr );
+  REQUIRE( allocator.stats( VK_SYSTEM_ALLOCATION_SCOPE_CACHE ).live == 0 );
+}
+
+TEST_CASE( "VulkanHostAllocator recycles command and object blocks", "[vulkan_host_allocator]" ) {
+  fn::VulkanHostAllocator allocator;
+  const VkAllocationCallbacks *callbacks = allocator.callbacks();
+
+  // The arena starts over once no command block is live
+  void *first = allocate( callbacks, 200, 16, VK_SYSTEM_ALLOCATION_SCOPE_COMMAND );
+  void *second = allocate( callbacks, 300, 16, VK_SYSTEM_ALLOCATION_SCOPE_COMMAND );
+  REQUIRE( first != second );
+  free( callbacks, first );
+  free( callbacks, second );
+  void *third = allocate( callbacks, 200, 16, VK_SYSTEM_ALLOCATION_SCOPE_COMMAND );
+  REQUIRE( third == first );
+  REQUIRE( allocator.stats( VK_SYSTEM_ALLOCATION_SCOPE_COMMAND ).live == 1 );
+  free( callbacks, third );
+
+  // Destroyed objects hand their blocks to the next ones of the same size
+  void *view = allocate( callbacks, 100, 8, VK_SYSTEM_ALLOCATION_SCOPE_OBJECT );
+  free( callbacks, view );
+  void *sampler = allocate( callbacks, 90, 8, VK_SYSTEM_ALLOCATION_SCOPE_OBJECT );
+  REQUIRE( sampler == view );
+  REQUIRE( allocator.recycled() == 4 );
+  free( callbacks, sampler );
+
+  // Too large, or aligned past the header, blocks come from the heap
+  void *large = allocate( callbacks, 8192, 16, VK_SYSTEM_ALLOCATION_SCOPE_OBJECT );
+  void *wide = allocate( callbacks, 100, 256, VK_SYSTEM_ALLOCATION_SCOPE_OBJECT );
+  REQUIRE( aligned( wide, 256 ) );
+  free( callbacks, large );
+  free( callbacks, wide );
+  REQUIRE( allocator.recycled() == 4 );
+  REQUIRE( allocator.stats( VK_SYSTEM_ALLOCATION_SCOPE_OBJECT ).live == 0 );
+}
+
+TEST_CASE( "VulkanHostAllocator counts internal allocations", "[vulkan_host_allocator]" ) {
+  fn::VulkanHostAllocator allocator;
+  const VkAllocationCallbacks *callbacks = allocator.callbacks();
+
+  callbacks->pfnInternalAllocation( callbacks->pUserData, 4096, VK_INTERNAL_ALLOCATION_TYPE_EXECUTABLE,
+                                    VK_SYSTEM_ALLOCATION_SCOPE_DEVICE );
+  REQUIRE( allocator.internalBytes( VK_SYSTEM_ALLOCATION_SCOPE_DEVICE ) == 4096 );
+
+  callbacks->pfnInternalFree( callbacks->pUserData, 4096, VK_INTERNAL_ALLOCATION_TYPE_EXECUTABLE,
+                              VK_SYSTEM_ALLOCATION_SCOPE_DEVICE );
+  REQUIRE( allocator.internalBytes( VK_SYSTEM_ALLOCATION_SCOPE_DEVICE ) == 0 );
+  REQUIRE( allocator.stats( VK_SYSTEM_ALLOCATION_SCOPE_DEVICE ).allocations == 0 );
+}